@@ -68,7 +68,7 @@ namespace ndn{
 	//eg: /lambda/Function/func-one/Data/data1  will return Name("/func-one")
 	shared_ptr<Name>
 	NfnInterestResolutionEngine::ExtractFunctionName(shared_ptr<const Interest> interest){
-		Name interest_name=interest->getName();
+		Name interest_name=StripParametersDigest(interest->getName());
 		Name func_prefix = Name("/Function");
 		Name funcName;
 		for(u_int32_t i=0;i<interest_name.size();i++){
@@ -87,7 +87,8 @@ namespace ndn{
 	//eg: /lambda/Function/func-one/Data/data1/data2  will return Name("/data1"),Name("/data2")
     std::vector<Name>
     NfnInterestResolutionEngine::ExtractDataNames(shared_ptr<const Interest> interest){
-    	Name interest_name=interest->getName();
+    	//the digest of a deadline would otherwise be taken for a data name when the sequence number is not recognized
+    	Name interest_name=StripParametersDigest(interest->getName());
 		vector<Name> data_names;
 		bool isData=false;
 		for(u_int32_t i=0;i<interest_name.size();i++){
@@ -111,7 +112,7 @@ namespace ndn{
 				 * the reason is still unclear.
 				 */
 
-				if(t_name.toUri().find("/%FE")!=string::npos){
+				if(interest_name.at(i).isSequenceNumber() || t_name.toUri().find("/%FE")!=string::npos){
 					return data_names;
 				}else{
 					NS_LOG_INFO("[NFN Resolution Engine] Extract data name from: "<<interest_name.toUri()<< ". Add: "<<t_name.toUri());
@@ -212,7 +213,7 @@ namespace ndn{
 		if(((func_flag == false)&&(data_miss_counter == parameter_list.size())) || (check_result))
 		{
 			//Neither function nor data is available
-			func->AddMissExecCounter();
+			computeNode->AddMissExecCounter(func);
 			result.first=FORWARD;
 			result.second = fetch_decisions_ptr;
 			return result;
@@ -229,5 +230,74 @@ namespace ndn{
 		return result;
 	}
 
+	//steps pos over the next TLV element of the parameters, false if it is malformed
+	static bool
+	NextParameter(const uint8_t*& pos, const uint8_t* end, uint64_t& type, const uint8_t*& value, uint64_t& length){
+		if(!::ndn::tlv::readVarNumber(pos, end, type) || !::ndn::tlv::readVarNumber(pos, end, length) ||
+		   length>static_cast<uint64_t>(end-pos))
+			return false;
+		value=pos;
+		pos+=length;
+		return true;
+	}
+
+	void
+	NfnInterestResolutionEngine::SetDeadline(Interest& interest, Time deadline){
+		//the deadline goes first, so that it is found even if the parameters behind it are no TLV elements
+		Block element=::ndn::makeNonNegativeIntegerBlock(DeadlineType, deadline.GetMilliSeconds());
+		std::vector<uint8_t> parameters(element.wire(), element.wire()+element.size());
+		if(interest.hasApplicationParameters()){
+			const Block& existing=interest.getApplicationParameters();
+			const uint8_t* pos=existing.value();
+			const uint8_t* end=pos+existing.value_size();
+			while(pos<end){
+				const uint8_t* start=pos;
+				uint64_t type;
+				uint64_t length;
+				const uint8_t* value;
+				if(!NextParameter(pos, end, type, value, length)){
+					parameters.insert(parameters.end(), start, end);
+					break;
+				}
+				if(type!=DeadlineType)
+					parameters.insert(parameters.end(), start, pos);
+			}
+		}
+		interest.setApplicationParameters(parameters.data(), parameters.size());
+	}
+
+	Time
+	NfnInterestResolutionEngine::ExtractDeadline(shared_ptr<const Interest> interest){
+		if(!interest->hasApplicationParameters())
+			return Time();
+		//walk the parameters in place, a malformed element is treated as no deadline instead of throwing
+		const Block& parameters=interest->getApplicationParameters();
+		const uint8_t* pos=parameters.value();
+		const uint8_t* end=pos+parameters.value_size();
+		while(pos<end){
+			uint64_t type;
+			uint64_t length;
+			const uint8_t* value;
+			if(!NextParameter(pos, end, type, value, length))
+				return Time();
+			if(type==DeadlineType){
+				if(length==0 || length>8)
+					return Time();
+				uint64_t deadline=0;
+				for(uint64_t i=0;i<length;i++)
+					deadline=(deadline<<8)|value[i];
+				return MilliSeconds(deadline);
+			}
+		}
+		return Time();
+	}
+
+	Name
+	NfnInterestResolutionEngine::StripParametersDigest(const Name& name){
+		if(!name.empty() && name.at(-1).isParametersSha256Digest())
+			return name.getPrefix(-1);
+		return name;
+	}
+
   } // namespace ndn
 } // namespace ns3
@@ -31,6 +31,7 @@
 #include "ns3/ptr.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/INC-Computation.hpp"
+#include "ns3/nstime.h"
 
 
 
@@ -51,6 +52,23 @@ namespace ndn{
       std::pair<NRE_Decision, shared_ptr<vector<Name>>>
       GetFetchDecisions(shared_ptr<const Interest> interest, Ptr<ndn::inc::IncOrchestrationComputeNode> computeNode);
 
+      //TLV-TYPE of the optional deadline in the ApplicationParameters of a compute interest,
+      //its value is the absolute simulation time in milliseconds after which the result is useless
+      static const uint32_t DeadlineType = 250;
+
+      //attaches an absolute deadline to a compute interest, next to the parameters it already carries and in place of an
+      //earlier deadline. This appends the parameters digest to its name, see StripParametersDigest
+      static void
+      SetDeadline(Interest& interest, Time deadline);
+
+      //absolute deadline of a compute interest, zero if it carries none or its parameters are malformed
+      static Time
+      ExtractDeadline(shared_ptr<const Interest> interest);
+
+      //name without the trailing parameters digest, the name compute interests and their results are parsed by
+      static Name
+      StripParametersDigest(const Name& name);
+
     private:
 
     bool DataCacheAvailable =true;
@@ -37,6 +37,7 @@
 #include "./NFN-producer-app.hpp"
 #include <pthread.h>
 
+#include <algorithm>
 #include <memory>
 
 /*
@@ -128,6 +129,16 @@ NfnProducerApp::GetTypeId (void)
                             "Trace called when interest is pushes into queue",
                             MakeTraceSourceAccessor( &NfnProducerApp::m_onQueueInterestTrace),
                             "ns3::ndn::inc::NfnProducerApp::nfnQueueInterestCallback")
+          .AddTraceSource ("NFN_Deadline",
+                           "Trace called when an interest with a deadline starts executing, or is "
+                           "dropped because it cannot meet its deadline anymore",
+                           MakeTraceSourceAccessor (&NfnProducerApp::m_onDeadlineTrace),
+                           "ns3::ndn::inc::NfnProducerApp::nfnDeadlineCallback")
+          .AddTraceSource ("NFN_Abandoned",
+                           "Trace called when an interest nobody waits for anymore is dropped before "
+                           "executing, or finishes executing",
+                           MakeTraceSourceAccessor (&NfnProducerApp::m_onAbandonedTrace),
+                           "ns3::ndn::inc::NfnProducerApp::nfnAbandonedCallback")
           .AddTraceSource ("NFN_FuncEnabled", "Trace called when NFN performs a code drag",
                            MakeTraceSourceAccessor (&NfnProducerApp::m_nfnFuncEnabledTrace),
                            "ns3::ndn::inc::NfnProducerApp::nfnFuncEnabledCallback");
@@ -245,6 +256,12 @@ void
 NfnProducerApp::ScheduledExecutionEnd (shared_ptr<Data> data, Ptr<INC_Computation> func)
 {
   ReleaseResource (func);
+  //the execution was wasted if the requester got its result elsewhere or gave up meanwhile
+  Ptr<L3Protocol> L3protocol = m_compute_node->GetNode ()->GetObject<L3Protocol> ();
+  nfd::pit::DataMatchResult matches = L3protocol->getForwarder ()->getPit ().findAllDataMatches (*data);
+  if (std::none_of (matches.begin (), matches.end (),
+                    [] (const shared_ptr<nfd::pit::Entry> &entry) { return entry->hasInRecords (); }))
+    this->m_onAbandonedTrace (func->getName ().toUri (), true);
   this->m_onOutgoingDataTrace (data);
   NS_LOG_DEBUG ("[NFN producer: " << m_compute_node->GetName () << "] Execute Function: "
                                  << func->getName () << " success , will send response");
@@ -258,20 +275,104 @@ NfnProducerApp::ScheduledExecutionEnd (shared_ptr<Data> data, Ptr<INC_Computatio
   if (!(m_compute_node->IsQueueEmpty()))
     {
       NS_LOG_DEBUG ("Checking pending interests in queue!" << std::endl);
-      InterestComponentStruct t_ics = m_waiting_list.front ();
-      if (CheckResource (t_ics.m_func))
+      DropLateWaitingEntries ();
+      auto next = GetNextWaitingEntry ();
+      if (next != m_waiting_list.end () && CheckResource (next->m_func))
         {
+          InterestComponentStruct t_ics = *next;
           NS_LOG_DEBUG ("popped interest from queue:" << t_ics.m_interest.toUri () << std::endl);
           m_compute_node->DecrementQueueFill();
-          m_waiting_list.pop ();
+          m_waiting_list.erase (next);
           DoExecution (t_ics);
         }
     }
 }
 
+bool
+NfnProducerApp::MissesDeadline (const InterestComponentStruct &entry)
+{
+  return !entry.m_deadline.IsZero () &&
+         Simulator::Now () + Seconds (entry.m_func->GetExecTime ()) > entry.m_deadline;
+}
+
+void
+NfnProducerApp::DropLate (const InterestComponentStruct &entry)
+{
+  Time slack = entry.m_deadline - Simulator::Now () - Seconds (entry.m_func->GetExecTime ());
+  NS_LOG_DEBUG ("[NFN producer: " << m_compute_node->GetName () << "] Drop interest "
+                                 << entry.m_interest.toUri () << ", it misses its deadline by "
+                                 << -slack.GetSeconds () << "s" << std::endl);
+  this->m_onDeadlineTrace (entry.m_func->getName ().toUri (), slack, true);
+  DeletePendingContentTableEntry (entry);
+}
+
+bool
+NfnProducerApp::IsAbandoned (const InterestComponentStruct &entry)
+{
+  //a satisfied entry lingers without in-records until its straggler timer erases it
+  Ptr<L3Protocol> L3protocol = m_compute_node->GetNode ()->GetObject<L3Protocol> ();
+  shared_ptr<nfd::pit::Entry> pitEntry =
+      L3protocol->getForwarder ()->getPit ().find (*(entry.interest_ptr));
+  return pitEntry == NULL || !pitEntry->hasInRecords ();
+}
+
+void
+NfnProducerApp::DropAbandoned (const InterestComponentStruct &entry)
+{
+  NS_LOG_DEBUG ("[NFN producer: " << m_compute_node->GetName () << "] Drop interest "
+                                 << entry.m_interest.toUri ()
+                                 << ", nobody waits for its result anymore" << std::endl);
+  this->m_onAbandonedTrace (entry.m_func->getName ().toUri (), false);
+  DeletePendingContentTableEntry (entry);
+}
+
+void
+NfnProducerApp::DropLateWaitingEntries ()
+{
+  for (auto it = m_waiting_list.begin (); it != m_waiting_list.end ();)
+    {
+      if (MissesDeadline (*it))
+        {
+          m_compute_node->DecrementQueueFill ();
+          DropLate (*it);
+          it = m_waiting_list.erase (it);
+        }
+      else if (IsAbandoned (*it))
+        {
+          m_compute_node->DecrementQueueFill ();
+          DropAbandoned (*it);
+          it = m_waiting_list.erase (it);
+        }
+      else
+        {
+          it++;
+        }
+    }
+}
+
+std::deque<NfnProducerApp::InterestComponentStruct>::iterator
+NfnProducerApp::GetNextWaitingEntry ()
+{
+  auto next = m_waiting_list.begin ();
+  for (auto it = m_waiting_list.begin (); it != m_waiting_list.end (); it++)
+    {
+      if (!it->m_deadline.IsZero () &&
+          (next->m_deadline.IsZero () || it->m_deadline < next->m_deadline))
+        next = it;
+    }
+  return next;
+}
+
 void
 NfnProducerApp::DoExecution (InterestComponentStruct ics)
 {
+  if (!ics.m_deadline.IsZero ())
+    {
+      this->m_onDeadlineTrace (ics.m_func->getName ().toUri (),
+                               ics.m_deadline - Simulator::Now () -
+                                   Seconds (ics.m_func->GetExecTime ()),
+                               false);
+    }
   BookResource (ics.m_func);
   //scheduled packet sending time
   double scheduled_sending_time = Simulator::Now ().GetSeconds () + ics.m_func->GetExecTime ();
@@ -455,6 +556,18 @@ NfnProducerApp::ResolveAndHandleDecisions (InterestComponentStruct t_ics)
                                      << Simulator::Now ().GetSeconds () << std::endl);
     }
 
+  else if (MissesDeadline (t_ics))
+    {
+      //the consumer cannot use the result anymore, neither fetch, forward nor execute it
+      DropLate (t_ics);
+    }
+
+  else if (IsAbandoned (t_ics))
+    {
+      //e.g. the losing copy of a hedged request whose arguments arrived after the winner answered
+      DropAbandoned (t_ics);
+    }
+
   else if (result.first == NfnInterestResolutionEngine::FETCH)
     {
       //store the pending content in a map, and send interests to fetch the content
@@ -509,13 +622,14 @@ NfnProducerApp::ResolveAndHandleDecisions (InterestComponentStruct t_ics)
         }
       else
         {
-          //added to waiting queue
+          //added to waiting queue, after making room by dropping the waiting interests that became late
+          DropLateWaitingEntries ();
           if (!( m_compute_node->IsQueueFull() ))
             {
               NS_LOG_DEBUG ("Resources not available for execution, adding interest to queue:"
                            << t_ics.m_interest.toUri () << std::endl);
               m_compute_node->IncrementQueueFill();
-              m_waiting_list.push (t_ics);
+              m_waiting_list.push_back (t_ics);
               this->m_onQueueInterestTrace(t_ics.m_interest.toUri());
             }
           else
@@ -525,8 +639,8 @@ NfnProducerApp::ResolveAndHandleDecisions (InterestComponentStruct t_ics)
               if (std::string ("push").compare (QUEUE_ACTION) == 0)
                 {
                   NS_LOG_DEBUG ("The size of the queue is " << m_waiting_list.size ());
-                  m_waiting_list.pop ();
-                  m_waiting_list.push (t_ics);
+                  m_waiting_list.pop_front ();
+                  m_waiting_list.push_back (t_ics);
                 }
               else if (std::string ("nack").compare (QUEUE_ACTION) == 0)
                 {
@@ -660,6 +774,8 @@ NfnProducerApp::ForwardInterest(InterestComponentStruct t_ics)
   ptr_fwd_interest->setMustBeFresh (t_ics.interest_ptr->getMustBeFresh ());
   ptr_fwd_interest->setInterestLifetime(t_ics.interest_ptr->getInterestLifetime());
   ptr_fwd_interest->setHopLimit(t_ics.interest_ptr->getHopLimit());
+  if(t_ics.interest_ptr->hasApplicationParameters())
+    ptr_fwd_interest->setApplicationParameters(t_ics.interest_ptr->getApplicationParameters());
 
   m_transmittedInterests(ptr_fwd_interest, this, m_face);
   m_appLink->onReceiveInterest(*ptr_fwd_interest);
@@ -769,6 +885,7 @@ NfnProducerApp::OnInterest (shared_ptr<const Interest> interest)
       InterestComponentStruct new_ics;
       new_ics.m_interest = interest_name;
       new_ics.interest_ptr = interest;
+      new_ics.m_deadline = NfnInterestResolutionEngine::ExtractDeadline (interest);
       //Find the function to be executed
       for (u_int32_t i = 0; i < interest_name.size (); i++)
         {
@@ -45,7 +45,7 @@
 #include "ns3/ptr.h"
 #include "ns3/NFN-interest-resolution-engine.hpp"
 #include "ns3/simple-ref-count.h"
-#include <queue>
+#include <deque>
 #include "model/null-transport.hpp"
 
 #define MAX_QUEUE_SIZE 10
@@ -68,6 +68,7 @@ namespace ns3{
           Ptr<INC_Computation> m_func;
           std::unordered_map<Name, bool> m_pending_args;
           shared_ptr<const Interest> interest_ptr;
+          Time m_deadline;  //absolute deadline carried in the interest, zero if it has none
           bool operator == (const InterestComponentStruct &rhs) const
           {
             return m_interest.toUri()==rhs.m_interest.toUri();
@@ -100,6 +101,8 @@ namespace ns3{
         typedef void ( *nfnForwardInterestCallback)(std::string);
         typedef void ( *nfnQueueInterestCallback)(std::string);
         typedef void ( *FuncExecutingCallback)(std::vector<std::string>);
+        typedef void ( *nfnDeadlineCallback)(std::string function, Time slack, bool dropped);
+        typedef void ( *nfnAbandonedCallback)(std::string function, bool executed);
 
         //resolve the interest with the help of resolution engine and handle the returned decisions
     	  virtual void
@@ -142,6 +145,31 @@ namespace ns3{
         void
         ForwardInterest(InterestComponentStruct t_ics);
 
+        //true if the interest carries a deadline that an execution started now would not meet
+        bool
+        MissesDeadline(const InterestComponentStruct& entry);
+
+        //drops an interest that cannot meet its deadline anymore, before any resource is spent on it
+        void
+        DropLate(const InterestComponentStruct& entry);
+
+        //true if nobody waits for the result of the interest anymore: its PIT entry expired or was satisfied by the Data
+        //of another copy, e.g. the winner of a hedged request
+        bool
+        IsAbandoned(const InterestComponentStruct& entry);
+
+        //drops an interest nobody waits for anymore, before any resource is spent on it
+        void
+        DropAbandoned(const InterestComponentStruct& entry);
+
+        //drops the entries of the waiting list that cannot meet their deadline anymore or nobody waits for anymore
+        void
+        DropLateWaitingEntries();
+
+        //entry of the waiting list to execute next, earliest deadline first, interests without deadline last
+        std::deque<InterestComponentStruct>::iterator
+        GetNextWaitingEntry();
+
         /**
          * @brief  in simulation scenario function execution takes almost 0 time,
          * however we want to simulate INC computations that may take a specific period of time.
@@ -161,7 +189,7 @@ namespace ns3{
         //used to keep track of interest sent to network, avoid repetitive sending when multiple interests request for same data simultaneously
         //boolean flag set to true when the interest has been sent
         unordered_set<Name> m_sending_interest_list;
-        std::queue<InterestComponentStruct> m_waiting_list;
+        std::deque<InterestComponentStruct> m_waiting_list;
         uint32_t m_signature;
         Name m_keyLocator;
         NfnInterestResolutionEngine m_engine;
@@ -179,6 +207,8 @@ namespace ns3{
         TracedCallback<std::string> m_onForwardInterestTrace;
         TracedCallback<std::string> m_onQueueInterestTrace;
         TracedCallback<std::vector<std::string>> m_onFuncExecutionTrace;
+        TracedCallback<std::string, Time, bool> m_onDeadlineTrace;     ///< @brief function, slack and drop of interests with a deadline
+        TracedCallback<std::string, bool> m_onAbandonedTrace;          ///< @brief function of abandoned interests, executed or dropped before
       };
     }//namespace inc
   } // namespace ndn
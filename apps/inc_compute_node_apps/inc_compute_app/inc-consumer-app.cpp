@@ -39,6 +39,7 @@
 #include "ns3/uinteger.h"
 #include "ns3/integer.h"
 #include "ns3/double.h"
+#include "ns3/inc-random-streams.hpp"
 
 #include "utils/ndn-ns3-packet-tag.hpp"
 #include "utils/ndn-rtt-mean-deviation.hpp"
@@ -69,7 +70,8 @@ ConsumerApp::GetTypeId(void)
                     MakeDoubleAccessor(&ConsumerApp::m_interval), MakeDoubleChecker<double>())
 
       .AddAttribute("Randomize",
-                    "Type of send time randomization: none (default), uniform, exponential",
+                    "Arrival process of the requests: none (default), uniform, exponential, mmpp, diurnal, on-off, "
+                    "flash-crowd, optionally with attributes, e.g. mmpp[RateFactors=1,8]",
                     StringValue("none"),
                     MakeStringAccessor(&ConsumerApp::SetRandomize, &ConsumerApp::GetRandomize),
                     MakeStringChecker())
@@ -77,6 +79,10 @@ ConsumerApp::GetTypeId(void)
       .AddAttribute("MaxSeq", "Maximum sequence number to request",
                     IntegerValue(std::numeric_limits<uint32_t>::max()),
                     MakeIntegerAccessor(&ConsumerApp::m_seqMax), MakeIntegerChecker<uint32_t>())
+
+      .AddTraceSource("ArrivalInc", "Trace called at every arrival of the arrival process that sends a new request",
+                      MakeTraceSourceAccessor(&ConsumerApp::m_arrivalTrace),
+                      "ns3::ndn::inc::ConsumerApp::ArrivalCallback")
     ;
 
   return tid;
@@ -101,31 +107,33 @@ ConsumerApp::ScheduleNextPacket()
   // std::cout << "next: " << Simulator::Now().ToDouble(Time::S) + mean << "s\n";
 
   if (m_firstTime) {
-    m_sendEvent = Simulator::Schedule(Seconds(0.0), &INC_ConsumerBaseApp::SendPacket, this);
+    m_sendEvent = Simulator::Schedule(Seconds(0.0), &ConsumerApp::SendArrival, this);
     m_firstTime = false;
   }
   else if (!m_sendEvent.IsRunning())
-    m_sendEvent = Simulator::Schedule((m_random == 0) ? Seconds(m_interval)
-                                                      : Seconds(m_random->GetValue()),
-                                      &INC_ConsumerBaseApp::SendPacket, this);
+    m_sendEvent = Simulator::Schedule(m_arrivals->GetNextGap(m_interval), &ConsumerApp::SendArrival, this);
 }
 
 void
-ConsumerApp::SetRandomize(const std::string& value)
+ConsumerApp::SendArrival()
 {
-  if (value == "uniform") {
-    m_random = CreateObject<UniformRandomVariable>();
-    m_random->SetAttribute("Min", DoubleValue(0.0));
-    m_random->SetAttribute("Max", DoubleValue(2 * m_interval));
-  }
-  else if (value == "exponential") {
-    m_random = CreateObject<ExponentialRandomVariable>();
-    m_random->SetAttribute("Mean", DoubleValue(m_interval));
-    m_random->SetAttribute("Bound", DoubleValue(50 * m_interval));
-  }
-  else
-    m_random = 0;
+  // a pending retransmission takes the slot of an arrival, only a new sequence number is an arrival of the process
+  uint32_t seq = m_seq;
+  SendPacket();
+  if (m_active && m_seq != seq)
+    m_arrivalTrace(this);
+}
+
+double
+ConsumerApp::GetOfferedRate() const
+{
+  return m_active ? m_arrivals->GetRate(m_interval) : 0;
+}
 
+void
+ConsumerApp::SetRandomize(const std::string& value)
+{
+  m_arrivals = IncArrivalProcess::CreateProcess(value);
   m_randomType = value;
 }
 
@@ -135,6 +143,13 @@ ConsumerApp::GetRandomize() const
   return m_randomType;
 }
 
+void
+ConsumerApp::AssignStreams(uint64_t index)
+{
+  INC_ConsumerBaseApp::AssignStreams(index);
+  m_arrivals->AssignStreams(index);
+}
+
 } //namespace inc
 } // namespace ndn
 } // namespace ns3
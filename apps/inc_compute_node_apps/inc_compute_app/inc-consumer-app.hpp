@@ -34,6 +34,7 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ns3/incSIM-module.h"
+#include "ns3/inc-arrival-process.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -41,6 +42,8 @@ namespace inc {
 /**
  * @ingroup ndn-apps
  * @brief Ndn application for sending out Interest packets at a "constant" rate (Poisson process)
+ *
+ * The send times follow an IncArrivalProcess around the mean Interval, selected with Randomize.
  */
 class ConsumerApp : public INC_ConsumerBaseApp {
 public:
@@ -54,6 +57,15 @@ public:
   ConsumerApp();
   virtual ~ConsumerApp();
 
+  /**
+   * @brief Request rate the arrival process currently offers, in requests per second, 0 while the app is not running
+   */
+  double
+  GetOfferedRate() const;
+
+public:
+  typedef void (*ArrivalCallback)(Ptr<App> app);
+
 protected:
   /**
    * \brief Constructs the Interest packet and sends it using a callback to the underlying NDN
@@ -64,24 +76,39 @@ protected:
 
   /**
    * @brief Set type of frequency randomization
-   * @param value Either 'none', 'uniform', or 'exponential'
+   * @param value Arrival process, e.g. 'none', 'uniform', 'exponential', 'mmpp', 'diurnal', 'on-off' or
+   *        'flash-crowd', see IncArrivalProcess::CreateProcess
    */
   void
   SetRandomize(const std::string& value);
 
   /**
    * @brief Get type of frequency randomization
-   * @returns either 'none', 'uniform', or 'exponential'
    */
   std::string
   GetRandomize() const;
 
+  /**
+   * \brief The send time randomization draws from the "consumers" stream of the app
+   */
+  virtual void
+  AssignStreams(uint64_t index);
+
+  /**
+   * \brief Send at an arrival of the process, a new request or a pending retransmission, ArrivalInc only fires for
+   * a new request
+   */
+  void
+  SendArrival();
+
 protected:
   double m_interval; // Frequency of interest packets (in hertz)
   bool m_firstTime;
-  Ptr<RandomVariableStream> m_random;
+  Ptr<IncArrivalProcess> m_arrivals;
   std::string m_randomType;
 
+  TracedCallback<Ptr<App>> m_arrivalTrace;
+
 };
 
 } // namespace inc
@@ -38,13 +38,18 @@
 #include "ns3/boolean.h"
 #include "ns3/uinteger.h"
 #include "ns3/integer.h"
+#include "ns3/inc-random-streams.hpp"
 #include "ns3/double.h"
+#include "ns3/NFN-interest-resolution-engine.hpp"
 
 #include "utils/ndn-ns3-packet-tag.hpp"
 #include "utils/ndn-rtt-mean-deviation.hpp"
 
 #include <ndn-cxx/lp/tags.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/ref.hpp>
 
@@ -69,10 +74,30 @@ INC_ConsumerBaseApp::GetTypeId(void)
                     MakeNameAccessor(&INC_ConsumerBaseApp::m_interestName), MakeNameChecker())
       .AddAttribute("LifeTime", "LifeTime for interest packet", StringValue("20s"),
                     MakeTimeAccessor(&INC_ConsumerBaseApp::m_interestLifeTime), MakeTimeChecker())
+      .AddAttribute("Deadline",
+                    "Time after the first transmission of a request its result is useless after, "
+                    "carried in the interest so that compute nodes can drop late work, 0 for none",
+                    StringValue("0s"),
+                    MakeTimeAccessor(&INC_ConsumerBaseApp::m_deadline),
+                    MakeTimeChecker())
+      .AddAttribute("HedgePercentile",
+                    "Percentile of the recent response times after which an unanswered request is sent again "
+                    "to another next hop, 0 disables hedging",
+                    DoubleValue(0),
+                    MakeDoubleAccessor(&INC_ConsumerBaseApp::m_hedgePercentile),
+                    MakeDoubleChecker<double>(0, 100))
+      .AddAttribute("HedgeWindow", "Number of recent response times the hedge percentile is taken over",
+                    UintegerValue(100),
+                    MakeUintegerAccessor(&INC_ConsumerBaseApp::m_hedgeWindow),
+                    MakeUintegerChecker<uint32_t>(1))
+      .AddAttribute("HedgeMinSamples", "Number of response times needed before requests are hedged",
+                    UintegerValue(20),
+                    MakeUintegerAccessor(&INC_ConsumerBaseApp::m_hedgeMinSamples),
+                    MakeUintegerChecker<uint32_t>(1))
       .AddAttribute("RetxTimer",
-                    "Timeout defining how frequent retransmission timeouts should be checked",
+                    "Granularity of the retransmission timeouts, they expire on multiples of it",
                     StringValue("50ms"),
-                    MakeTimeAccessor(&INC_ConsumerBaseApp::GetRetxTimer, &INC_ConsumerBaseApp::SetRetxTimer),
+                    MakeTimeAccessor(&INC_ConsumerBaseApp::m_retxTimer),
                     MakeTimeChecker())
       .AddAttribute ("ComputeNodePointer",
                      "the pointer of compute node to access functions",
@@ -99,7 +124,20 @@ INC_ConsumerBaseApp::GetTypeId(void)
       .AddTraceSource("IncomingDatasInc",
                       "Trace called every time there is an incoming Data packet",
                       MakeTraceSourceAccessor(&INC_ConsumerBaseApp::m_onDataTrace),
-                      "ns3::ndn::inc::INC_ConsumerBaseApp::IncIncomingDatasCallback");
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::IncIncomingDatasCallback")
+      .AddTraceSource("HedgeInc",
+                      "Second copy of a request sent to another next hop, with the delay since its first Interest",
+                      MakeTraceSourceAccessor(&INC_ConsumerBaseApp::m_hedgeTrace),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::HedgeCallback")
+      .AddTraceSource("HedgeUnpinnedInc",
+                      "Hedge sent without a next hop of its own, as the node has no next hop the request was not "
+                      "forwarded to yet",
+                      MakeTraceSourceAccessor(&INC_ConsumerBaseApp::m_hedgeUnpinnedTrace),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::HedgeCallback")
+      .AddTraceSource("HedgeResultInc",
+                      "Hedged request answered, with its delay and whether the Data came from the hedge",
+                      MakeTraceSourceAccessor(&INC_ConsumerBaseApp::m_hedgeResultTrace),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::HedgeResultCallback");
   return tid;
 }
 
@@ -107,6 +145,9 @@ INC_ConsumerBaseApp::INC_ConsumerBaseApp()
   : m_rand(CreateObject<UniformRandomVariable>())
   , m_seq(0)
   , m_seqMax(0) // don't request anything
+  , m_timerOwner(0)
+  , m_hedgeOwner(0)
+  , m_responseTimePos(0)
 {
   NS_LOG_FUNCTION_NOARGS();
 
@@ -114,46 +155,86 @@ INC_ConsumerBaseApp::INC_ConsumerBaseApp()
 }
 
 void
-INC_ConsumerBaseApp::SetRetxTimer(Time retxTimer)
+INC_ConsumerBaseApp::CheckRetxTimeout(uint64_t sequenceNumber)
 {
-  m_retxTimer = retxTimer;
-  if (m_retxEvent.IsRunning()) {
-    // m_retxEvent.Cancel (); // cancel any scheduled cleanup events
-    Simulator::Remove(m_retxEvent); // slower, but better for memory
+  m_seqTimeouts.erase(sequenceNumber);
+  OnTimeout(sequenceNumber);
+}
+
+void
+INC_ConsumerBaseApp::CancelRetxTimeout(uint32_t sequenceNumber)
+{
+  auto timer = m_seqTimeouts.find(sequenceNumber);
+  if (timer != m_seqTimeouts.end()) {
+    m_timers->Cancel(timer->second);
+    m_seqTimeouts.erase(timer);
   }
+}
 
-  // schedule even with new timeout
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &INC_ConsumerBaseApp::CheckRetxTimeout, this);
+void
+INC_ConsumerBaseApp::CancelHedge(uint32_t sequenceNumber)
+{
+  auto timer = m_seqHedges.find(sequenceNumber);
+  if (timer != m_seqHedges.end()) {
+    m_timers->Cancel(timer->second);
+    m_seqHedges.erase(timer);
+  }
 }
 
 Time
-INC_ConsumerBaseApp::GetRetxTimer() const
+INC_ConsumerBaseApp::GetHedgeDelay() const
 {
-  return m_retxTimer;
+  if (m_hedgePercentile <= 0 || m_responseTimes.size() < m_hedgeMinSamples)
+    return Time();
+  std::vector<Time> times(m_responseTimes);
+  size_t rank = std::ceil(m_hedgePercentile / 100 * times.size());
+  auto percentile = times.begin() + std::min(times.size(), std::max<size_t>(rank, 1)) - 1;
+  std::nth_element(times.begin(), percentile, times.end());
+  return *percentile;
 }
 
 void
-INC_ConsumerBaseApp::CheckRetxTimeout()
+INC_ConsumerBaseApp::SendHedge(uint64_t sequenceNumber)
 {
-  Time now = Simulator::Now();
+  m_seqHedges.erase(sequenceNumber);
+  Time deadline = GetDeadline(sequenceNumber);
+  if (!m_active || (!deadline.IsZero() && deadline <= Simulator::Now()))
+    return;
+  shared_ptr<Interest> interest = PrepareInterest(sequenceNumber);
+  if (interest == nullptr)
+    return;
 
-  Time rto = m_rtt->RetransmitTimeout();
-  // NS_LOG_DEBUG ("Current RTO: " << rto.ToDouble (Time::S) << "s");
-
-  while (!m_seqTimeouts.empty()) {
-    SeqTimeoutsContainer::index<i_timestamp>::type::iterator entry =
-      m_seqTimeouts.get<i_timestamp>().begin();
-    if (entry->time + rto <= now) // timeout expired?
-    {
-      uint32_t seqNo = entry->seq;
-      m_seqTimeouts.get<i_timestamp>().erase(entry);
-      OnTimeout(seqNo);
-    }
-    else
-      break; // nothing else to do. All later packets need not be retransmitted
+  // pin the copy to the cheapest next hop the pending Interest has not been forwarded to, e.g. none under multicast
+  shared_ptr<nfd::Forwarder> forwarder = GetNode()->GetObject<L3Protocol>()->getForwarder();
+  shared_ptr<nfd::pit::Entry> pitEntry = forwarder->getPit().find(*interest);
+  const nfd::fib::Entry& fibEntry = forwarder->getFib().findLongestPrefixMatch(interest->getName());
+  const nfd::face::Face* other = nullptr;
+  for (const nfd::fib::NextHop& nextHop : fibEntry.getNextHops()) {
+    if (nextHop.getFace().getId() == m_face->getId() ||
+        (pitEntry != nullptr && pitEntry->getOutRecord(nextHop.getFace()) != pitEntry->out_end()))
+      continue;
+    other = &nextHop.getFace();
+    break;
   }
 
-  m_retxEvent = Simulator::Schedule(m_retxTimer, &INC_ConsumerBaseApp::CheckRetxTimeout, this);
+  auto first = m_seqFullDelay.find(sequenceNumber);
+  Time delay = first != m_seqFullDelay.end() ? Simulator::Now() - first->time : Time();
+  if (other != nullptr) {
+    NS_LOG_INFO("> Hedge for " << sequenceNumber << " on face " << other->getId());
+    interest->setTag(make_shared<lp::NextHopFaceIdTag>(other->getId()));
+    m_hedged[sequenceNumber] = other->getId();
+  }
+  else {
+    // e.g. a consumer behind a single link: the copy carries a new nonce, so an upstream forwarder running
+    // best-route takes it for a retransmission and sends it to a next hop it has not tried yet
+    NS_LOG_INFO("> Hedge for " << sequenceNumber << " left to the upstream forwarders, no other next hop here");
+    m_hedged[sequenceNumber] = nfd::face::INVALID_FACEID;
+    m_hedgeUnpinnedTrace(this, sequenceNumber, delay);
+  }
+  m_hedgeTrace(this, sequenceNumber, delay);
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+  m_interestTrace(interest);
 }
 
 // Application Methods
@@ -164,9 +245,53 @@ INC_ConsumerBaseApp::StartApplication() // Called at time specified by Start
   // do base stuff
   App::StartApplication();
 
+  // the consumers of a node share one timer wheel instead of checking their timeouts periodically each
+  m_timers = IncTimerWheel::GetWheel(GetNode());
+  m_timerOwner = m_timers->Register(MakeCallback(&INC_ConsumerBaseApp::CheckRetxTimeout, this));
+  m_hedgeOwner = m_timers->Register(MakeCallback(&INC_ConsumerBaseApp::SendHedge, this));
+
+  AssignStreams(GetStreamIndex());
   ScheduleNextPacket();
 }
 
+void
+INC_ConsumerBaseApp::AssignStreams(uint64_t index)
+{
+  IncRandomStreams::Get().Assign(m_rand, "nonces", index);
+}
+
+uint64_t
+INC_ConsumerBaseApp::GetStreamIndex() const
+{
+  return GetStreamIndex(this);
+}
+
+uint64_t
+INC_ConsumerBaseApp::GetStreamIndex(const Application* app)
+{
+  // node id and position of the app on its node do not depend on the strategy under test
+  Ptr<Node> node = app->GetNode();
+  uint32_t position = 0;
+  while (position < node->GetNApplications() && PeekPointer(node->GetApplication(position)) != app)
+    position++;
+  return (static_cast<uint64_t>(node->GetId()) << 32) | position;
+}
+
+Time
+INC_ConsumerBaseApp::GetDeadline(uint32_t sequenceNumber) const
+{
+  if (m_deadline.IsZero())
+    return Time();
+  auto first = m_seqFullDelay.find(sequenceNumber);
+  return (first != m_seqFullDelay.end() ? first->time : Simulator::Now()) + m_deadline;
+}
+
+uint32_t
+INC_ConsumerBaseApp::GetSequenceNumber(const Name& name)
+{
+  return NfnInterestResolutionEngine::StripParametersDigest(name).at(-1).toSequenceNumber();
+}
+
 void
 INC_ConsumerBaseApp::StopApplication() // Called at time specified by Stop
 {
@@ -175,6 +300,15 @@ INC_ConsumerBaseApp::StopApplication() // Called at time specified by Stop
   // cancel periodic packet generation
   Simulator::Cancel(m_sendEvent);
 
+  if (m_timers != 0) {
+    m_timers->Unregister(m_timerOwner);
+    m_timers->Unregister(m_hedgeOwner);
+    m_timers = 0;
+  }
+  m_seqTimeouts.clear();
+  m_seqHedges.clear();
+  m_hedged.clear();
+
   // cleanup base stuff
   App::StopApplication();
 }
@@ -191,7 +325,17 @@ INC_ConsumerBaseApp::SendPacket()
   while (m_retxSeqs.size()) {
     seq = *m_retxSeqs.begin();
     m_retxSeqs.erase(m_retxSeqs.begin());
-    break;
+    Time deadline = GetDeadline(seq);
+    if (deadline.IsZero() || deadline > Simulator::Now())
+      break;
+
+    // the result would be useless by now, give the request up instead of retransmitting it
+    NS_LOG_INFO("Deadline of " << seq << " passed, not retransmitting it");
+    m_seqFullDelay.erase(seq);
+    m_seqLastDelay.erase(seq);
+    m_seqRetxCounts.erase(seq);
+    m_hedged.erase(seq);
+    seq = std::numeric_limits<uint32_t>::max();
   }
 
   if (seq == std::numeric_limits<uint32_t>::max()) {
@@ -205,16 +349,7 @@ INC_ConsumerBaseApp::SendPacket()
   }
 
 
-  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
-  nameWithSequence->appendSequenceNumber(seq);
-
-  shared_ptr<Interest> interest = make_shared<Interest>();
-  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
-  interest->setName(*nameWithSequence);
-  interest->setCanBePrefix(false);
-  time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
-  interest->setInterestLifetime(interestLifeTime);
-  interest->setMustBeFresh(true);
+  shared_ptr<Interest> interest = PrepareInterest(seq);
 
   NS_LOG_INFO("[ Consumer "<<this->GetNode()->GetId()<<"] Sending Interest: " << *interest<<std::endl);
   NS_LOG_INFO("> Interest for " << seq);
@@ -226,6 +361,28 @@ INC_ConsumerBaseApp::SendPacket()
   ScheduleNextPacket();
 }
 
+shared_ptr<Interest>
+INC_ConsumerBaseApp::PrepareInterest(uint32_t sequenceNumber)
+{
+  shared_ptr<Name> nameWithSequence = make_shared<Name>(m_interestName);
+  nameWithSequence->appendSequenceNumber(sequenceNumber);
+
+  shared_ptr<Interest> interest = make_shared<Interest>();
+  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
+  interest->setName(*nameWithSequence);
+  interest->setCanBePrefix(false);
+  Time lifetime = m_interestLifeTime;
+  Time deadline = GetDeadline(sequenceNumber);
+  if (!deadline.IsZero()) {
+    lifetime = std::min(lifetime, deadline - Simulator::Now());
+    NfnInterestResolutionEngine::SetDeadline(*interest, deadline);
+  }
+  time::milliseconds interestLifeTime(std::max<int64_t>(1, lifetime.GetMilliSeconds()));
+  interest->setInterestLifetime(interestLifeTime);
+  interest->setMustBeFresh(true);
+  return interest;
+}
+
 ///////////////////////////////////////////////////
 //          Process incoming packets             //
 ///////////////////////////////////////////////////
@@ -271,7 +428,7 @@ INC_ConsumerBaseApp::OnData(shared_ptr<const Data> data)
     this->m_onDataTrace(data);
   }
   // This could be a problem......
-  uint32_t seq = data->getName().at(-1).toSequenceNumber();
+  uint32_t seq = GetSequenceNumber(data->getName());
   NS_LOG_INFO("< DATA for " << seq);
 
   int hopCount = 0;
@@ -288,14 +445,35 @@ INC_ConsumerBaseApp::OnData(shared_ptr<const Data> data)
 
   entry = m_seqFullDelay.find(seq);
   if (entry != m_seqFullDelay.end()) {
-    m_firstInterestDataDelay(this, seq, Simulator::Now() - entry->time, m_seqRetxCounts[seq], hopCount);
+    Time delay = Simulator::Now() - entry->time;
+    m_firstInterestDataDelay(this, seq, delay, m_seqRetxCounts[seq], hopCount);
+
+    // only requests answered without retransmission give unambiguous response times for the hedge delay
+    if (m_seqRetxCounts[seq] == 1) {
+      if (m_responseTimes.size() < m_hedgeWindow)
+        m_responseTimes.push_back(delay);
+      else
+        m_responseTimes[m_responseTimePos] = delay;
+      m_responseTimePos = (m_responseTimePos + 1) % m_hedgeWindow;
+    }
+
+    // the forwarder tags the Data with the face it came in on, which tells whether a pinned hedge won,
+    // both copies of an unpinned hedge come back on the same face
+    auto hedged = m_hedged.find(seq);
+    if (hedged != m_hedged.end()) {
+      auto incomingFace = data->getTag<lp::IncomingFaceIdTag>();
+      m_hedgeResultTrace(this, seq, delay, hedged->second != nfd::face::INVALID_FACEID && incomingFace != nullptr
+                                             && *incomingFace == hedged->second);
+      m_hedged.erase(hedged);
+    }
   }
 
   m_seqRetxCounts.erase(seq);
   m_seqFullDelay.erase(seq);
   m_seqLastDelay.erase(seq);
 
-  m_seqTimeouts.erase(seq);
+  CancelRetxTimeout(seq);
+  CancelHedge(seq);
   m_retxSeqs.erase(seq);
 
   m_rtt->AckSeq(SequenceNumber32(seq));
@@ -331,7 +509,14 @@ INC_ConsumerBaseApp::WillSendOutInterest(uint32_t sequenceNumber)
   NS_LOG_DEBUG("Trying to add " << sequenceNumber << " with " << Simulator::Now() << ". already "
                                 << m_seqTimeouts.size() << " items");
 
-  m_seqTimeouts.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
+  // the timeout is fixed when sending, rounded up so that the timeouts of the node's consumers coincide
+  Time now = Simulator::Now();
+  Time expiry = now + m_rtt->RetransmitTimeout();
+  if (m_retxTimer.IsStrictlyPositive())
+    expiry = TimeStep((expiry.GetTimeStep() + m_retxTimer.GetTimeStep() - 1) / m_retxTimer.GetTimeStep()
+                      * m_retxTimer.GetTimeStep());
+  CancelRetxTimeout(sequenceNumber);
+  m_seqTimeouts[sequenceNumber] = m_timers->Schedule(expiry - now, m_timerOwner, sequenceNumber);
   m_seqFullDelay.insert(SeqTimeout(sequenceNumber, Simulator::Now()));
 
   m_seqLastDelay.erase(sequenceNumber);
@@ -339,6 +524,14 @@ INC_ConsumerBaseApp::WillSendOutInterest(uint32_t sequenceNumber)
 
   m_seqRetxCounts[sequenceNumber]++;
 
+  // only the first transmission is hedged, a retransmission takes over from a pending hedge
+  CancelHedge(sequenceNumber);
+  if (m_seqRetxCounts[sequenceNumber] == 1) {
+    Time hedge = GetHedgeDelay();
+    if (hedge.IsStrictlyPositive())
+      m_seqHedges[sequenceNumber] = m_timers->Schedule(hedge, m_hedgeOwner, sequenceNumber);
+  }
+
   m_rtt->SentSeq(SequenceNumber32(sequenceNumber), 1);
 }
 
@@ -38,12 +38,15 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/nstime.h"
 #include "ns3/data-rate.h"
+#include "ns3/inc-timer-wheel.hpp"
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
 
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/tag.hpp>
@@ -57,6 +60,11 @@ namespace inc {
 /**
  * @ingroup ndn-apps
  * \brief NDN application for sending out Interest packets
+ *
+ * With a HedgePercentile, a request still unanswered after that percentile of the recent response times is sent a
+ * second time, pinned to a next hop of the node its first Interest was not forwarded to. Without such a next hop the
+ * copy is sent unpinned with a new nonce, for upstream best-route forwarders to retry on a next hop they have not
+ * used. The first Data answers the request, the node drops the later one as unsolicited.
  */
 class INC_ConsumerBaseApp : public App {
 public:
@@ -109,6 +117,14 @@ public:
   typedef void (*FirstInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount);
   typedef void ( *IncSendsInterestTracedCallback)(shared_ptr<const Interest> interest);
   typedef void ( *IncIncomingDatasTracedCallback)(shared_ptr<const Data>);
+  typedef void (*HedgeCallback)(Ptr<App> app, uint32_t seqno, Time delay);
+  typedef void (*HedgeResultCallback)(Ptr<App> app, uint32_t seqno, Time delay, bool hedgeWon);
+
+  /**
+   * \brief Stream index of an app, made of its node id and its position on the node
+   */
+  static uint64_t
+  GetStreamIndex(const Application* app);
 
 protected:
   // from App
@@ -126,24 +142,67 @@ protected:
   ScheduleNextPacket() = 0;
 
   /**
-   * \brief Checks if the packet need to be retransmitted becuase of retransmission timer expiration
+   * \brief Retransmission timer of a sequence number expired in the timer wheel of the node
+   */
+  void
+  CheckRetxTimeout(uint64_t sequenceNumber);
+
+  /**
+   * \brief Stop the retransmission timer of a sequence number, e.g. when it is answered or given up
+   */
+  void
+  CancelRetxTimeout(uint32_t sequenceNumber);
+
+  /**
+   * \brief Build the Interest of a sequence number, for its transmissions and its hedge
+   * \returns nullptr if the sequence number is not requested anymore
+   */
+  virtual shared_ptr<Interest>
+  PrepareInterest(uint32_t sequenceNumber);
+
+  /**
+   * \brief Hedge timer of a sequence number expired, send a copy of its Interest to a next hop it has not been
+   * forwarded to
    */
   void
-  CheckRetxTimeout();
+  SendHedge(uint64_t sequenceNumber);
 
   /**
-   * \brief Modifies the frequency of checking the retransmission timeouts
-   * \param retxTimer Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Stop the hedge timer of a sequence number, if it has not been hedged yet
    */
   void
-  SetRetxTimer(Time retxTimer);
+  CancelHedge(uint32_t sequenceNumber);
 
   /**
-   * \brief Returns the frequency of checking the retransmission timeouts
-   * \return Timeout defining how frequent retransmission timeouts should be checked
+   * \brief Delay after the first transmission a request is hedged after, zero while not hedging
    */
   Time
-  GetRetxTimer() const;
+  GetHedgeDelay() const;
+
+  /**
+   * \brief Let the random variables of the app draw from their named streams
+   * \param index stream index of this app, see GetStreamIndex
+   */
+  virtual void
+  AssignStreams(uint64_t index);
+
+  /**
+   * \brief Stream index of the app, see GetStreamIndex(const Application*)
+   */
+  uint64_t
+  GetStreamIndex() const;
+
+  /**
+   * \brief Absolute deadline of a sequence number, counted from its first transmission, zero if the app sets none
+   */
+  Time
+  GetDeadline(uint32_t sequenceNumber) const;
+
+  /**
+   * \brief Sequence number of a Data name, which ends in the parameters digest if the Interest carried a deadline
+   */
+  static uint32_t
+  GetSequenceNumber(const Name& name);
 
 
 
@@ -153,8 +212,9 @@ protected:
   uint32_t m_seq;      ///< @brief currently requested sequence number
   uint32_t m_seqMax;   ///< @brief maximum number of sequence number
   EventId m_sendEvent; ///< @brief EventId of pending "send packet" event
-  Time m_retxTimer;    ///< @brief Currently estimated retransmission timer
-  EventId m_retxEvent; ///< @brief Event to check whether or not retransmission should be performed
+  Time m_retxTimer;    ///< @brief Granularity of the retransmission timeouts
+  Ptr<IncTimerWheel> m_timers; ///< @brief Timer wheel of the node holding the retransmission timeouts
+  uint32_t m_timerOwner;
   bool m_compute_flag;
   Ptr<IncOrchestrationComputeNode> m_compute_node;
   Ptr<RttEstimator> m_rtt; ///< @brief RTT estimator
@@ -162,6 +222,13 @@ protected:
   Time m_offTime;          ///< \brief Time interval between packets
   Name m_interestName;     ///< \brief NDN Name of the Interest (use Name)
   Time m_interestLifeTime; ///< \brief LifeTime for interest packet
+  Time m_deadline;         ///< \brief Time after the first transmission the result is useless after, zero for none
+  double m_hedgePercentile;    ///< \brief Percentile of the response times the hedge delay is set to, 0 for no hedging
+  uint32_t m_hedgeWindow;      ///< \brief Number of recent response times the percentile is taken over
+  uint32_t m_hedgeMinSamples;  ///< \brief Response times needed before requests are hedged
+  uint32_t m_hedgeOwner;
+  std::vector<Time> m_responseTimes; ///< \brief Ring buffer of the recent response times of unretransmitted requests
+  size_t m_responseTimePos;
   std::pair<Name, Time> SentTime;
   std::pair<Name, Time> RecvTime;
   /// @cond include_hidden
@@ -216,7 +283,10 @@ protected:
                                                                          &SeqTimeout::time>>>> {
   };
 
-  SeqTimeoutsContainer m_seqTimeouts; ///< \brief multi-index for the set of SeqTimeout structs
+  std::unordered_map<uint32_t, IncTimerWheel::Handle> m_seqTimeouts; ///< \brief retransmission timers by sequence number
+  std::unordered_map<uint32_t, IncTimerWheel::Handle> m_seqHedges;   ///< \brief hedge timers by sequence number
+  std::unordered_map<uint32_t, uint64_t> m_hedged; ///< \brief face id the hedge of a pending sequence number was
+                                                   ///< pinned to, INVALID_FACEID if it went unpinned
 
   SeqTimeoutsContainer m_seqLastDelay;
   SeqTimeoutsContainer m_seqFullDelay;
@@ -227,6 +297,11 @@ protected:
   TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */,
                  uint32_t /*retx count*/, int32_t /*hop count*/> m_firstInterestDataDelay;
 
+  TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */> m_hedgeTrace;
+  TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */> m_hedgeUnpinnedTrace;
+  TracedCallback<Ptr<App> /* app */, uint32_t /* seqno */, Time /* delay */, bool /* hedge won */>
+    m_hedgeResultTrace;
+
   TracedCallback<shared_ptr<const Interest>> 	m_interestTrace;   			///< @brief trace of outgoing interests
   TracedCallback<shared_ptr<const Data>> 		m_onDataTrace;         		///< @brief trace of incoming data
   /// @endcond
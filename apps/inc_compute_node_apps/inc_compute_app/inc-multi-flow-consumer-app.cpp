@@ -0,0 +1,358 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-multi-flow-consumer-app.hpp"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/nstime.h"
+#include "ns3/inc-random-streams.hpp"
+#include "ns3/inc-consumer-base-app.hpp"
+#include "ns3/NFN-interest-resolution-engine.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("inc.MultiFlowConsumerApp");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+NS_OBJECT_ENSURE_REGISTERED(MultiFlowConsumerApp);
+
+TypeId
+MultiFlowConsumerApp::GetTypeId(void)
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::inc::MultiFlowConsumerApp")
+      .SetGroupName("Inc")
+      .SetParent<App>()
+      .AddConstructor<MultiFlowConsumerApp>()
+      .AddAttribute("Randomize",
+                    "Arrival process of every flow: none (default), uniform, exponential, mmpp, diurnal, on-off, "
+                    "flash-crowd, optionally with attributes, e.g. mmpp[RateFactors=1,8]",
+                    StringValue("none"), MakeStringAccessor(&MultiFlowConsumerApp::m_randomType),
+                    MakeStringChecker())
+      .AddAttribute("Deadline",
+                    "Time after the first transmission of a request its result is useless after, "
+                    "carried in the interest so that compute nodes can drop late work, 0 for none",
+                    StringValue("0s"), MakeTimeAccessor(&MultiFlowConsumerApp::m_deadline), MakeTimeChecker())
+      .AddAttribute("InitialRto", "Retransmission timeout of a flow before its first RTT sample",
+                    TimeValue(Seconds(1)), MakeTimeAccessor(&MultiFlowConsumerApp::m_initialRto),
+                    MakeTimeChecker())
+      .AddAttribute("MinRto", "Lower bound of the retransmission timeout", TimeValue(MilliSeconds(200)),
+                    MakeTimeAccessor(&MultiFlowConsumerApp::m_minRto), MakeTimeChecker())
+      .AddAttribute("MaxRto", "Upper bound of the retransmission timeout", TimeValue(Seconds(200)),
+                    MakeTimeAccessor(&MultiFlowConsumerApp::m_maxRto), MakeTimeChecker())
+      .AddTraceSource("LastRetransmittedInterestDataDelayInc",
+                      "Delay between last retransmitted Interest and received Data",
+                      MakeTraceSourceAccessor(&MultiFlowConsumerApp::m_lastRetransmittedInterestDataDelay),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::LastRetransmittedInterestDataDelayCallback")
+      .AddTraceSource("FirstInterestDataDelayInc",
+                      "Delay between first transmitted Interest and received Data",
+                      MakeTraceSourceAccessor(&MultiFlowConsumerApp::m_firstInterestDataDelay),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::FirstInterestDataDelayCallback")
+      .AddTraceSource("SendInterestsInc",
+                      "Trace called every time there is an Interest packet is send to the network",
+                      MakeTraceSourceAccessor(&MultiFlowConsumerApp::m_interestTrace),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::IncSendsInterestTracedCallback")
+      .AddTraceSource("IncomingDatasInc",
+                      "Trace called every time there is an incoming Data packet",
+                      MakeTraceSourceAccessor(&MultiFlowConsumerApp::m_onDataTrace),
+                      "ns3::ndn::inc::INC_ConsumerBaseApp::IncIncomingDatasCallback")
+      .AddTraceSource("ArrivalInc", "Trace called at every arrival of the arrival process of a flow",
+                      MakeTraceSourceAccessor(&MultiFlowConsumerApp::m_arrivalTrace),
+                      "ns3::ndn::inc::ConsumerApp::ArrivalCallback");
+  return tid;
+}
+
+MultiFlowConsumerApp::MultiFlowConsumerApp()
+  : m_timerOwner(0)
+  , m_rand(CreateObject<UniformRandomVariable>())
+{
+  NS_LOG_FUNCTION_NOARGS();
+}
+
+MultiFlowConsumerApp::~MultiFlowConsumerApp()
+{
+}
+
+void
+MultiFlowConsumerApp::AddFlow(const Name& prefix, double interval, Time lifetime, Time start, Time stop)
+{
+  NS_ABORT_MSG_IF(m_active, "flows are added before the app starts");
+  NS_ABORT_MSG_IF(!m_flowIndex.emplace(prefix, m_flows.size()).second, "duplicate flow " << prefix);
+  Flow flow;
+  flow.prefix = prefix;
+  flow.interval = interval;
+  flow.lifetime = lifetime;
+  flow.start = start;
+  flow.stop = stop;
+  flow.nextSeq = 0;
+  flow.srtt = -1;
+  flow.rttvar = 0;
+  flow.backoff = 0;
+  m_flows.push_back(flow);
+}
+
+uint32_t
+MultiFlowConsumerApp::GetFlowCount() const
+{
+  return m_flows.size();
+}
+
+uint32_t
+MultiFlowConsumerApp::GetOutstanding() const
+{
+  return m_requests.size();
+}
+
+double
+MultiFlowConsumerApp::GetOfferedRate() const
+{
+  if (!m_active)
+    return 0;
+  Time now = Simulator::Now();
+  double rate = 0;
+  for (const Flow& flow : m_flows) {
+    if (flow.arrivals != 0 && flow.start <= now && now < flow.stop)
+      rate += flow.arrivals->GetRate(flow.interval);
+  }
+  return rate;
+}
+
+uint64_t
+MultiFlowConsumerApp::GetKey(uint32_t flow, uint32_t seq)
+{
+  return (static_cast<uint64_t>(flow) << 32) | seq;
+}
+
+void
+MultiFlowConsumerApp::StartApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  App::StartApplication();
+
+  // same streams as a ConsumerApp at the position of this app, flow f draws its arrivals like one f positions further
+  uint64_t index = INC_ConsumerBaseApp::GetStreamIndex(this);
+  IncRandomStreams::Get().Assign(m_rand, "nonces", index);
+  for (uint32_t flow = 0; flow < m_flows.size(); flow++) {
+    m_flows[flow].arrivals = IncArrivalProcess::CreateProcess(m_randomType);
+    m_flows[flow].arrivals->AssignStreams(index + flow);
+  }
+
+  m_timers = IncTimerWheel::GetWheel(GetNode());
+  m_timerOwner = m_timers->Register(MakeCallback(&MultiFlowConsumerApp::OnTimeout, this));
+
+  Time now = Simulator::Now();
+  for (uint32_t flow = 0; flow < m_flows.size(); flow++) {
+    if (m_flows[flow].start < m_flows[flow].stop)
+      m_due.push(Due(std::max(now, m_flows[flow].start), flow));
+  }
+  ScheduleNextSend();
+}
+
+void
+MultiFlowConsumerApp::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  Simulator::Cancel(m_sendEvent);
+  if (m_timers != 0) {
+    m_timers->Unregister(m_timerOwner);
+    m_timers = 0;
+  }
+  m_due = std::priority_queue<Due, std::vector<Due>, std::greater<Due>>();
+  m_requests.clear();
+
+  App::StopApplication();
+}
+
+void
+MultiFlowConsumerApp::ScheduleNextSend()
+{
+  Simulator::Cancel(m_sendEvent);
+  if (!m_due.empty())
+    m_sendEvent = Simulator::Schedule(m_due.top().first - Simulator::Now(), &MultiFlowConsumerApp::SendDue, this);
+}
+
+void
+MultiFlowConsumerApp::SendDue()
+{
+  if (!m_active)
+    return;
+
+  Time now = Simulator::Now();
+  while (!m_due.empty() && m_due.top().first <= now) {
+    uint32_t flow = m_due.top().second;
+    m_due.pop();
+    m_arrivalTrace(this);
+    SendInterest(flow, m_flows[flow].nextSeq++);
+    Time next = now + m_flows[flow].arrivals->GetNextGap(m_flows[flow].interval);
+    if (next < m_flows[flow].stop)
+      m_due.push(Due(next, flow));
+  }
+  ScheduleNextSend();
+}
+
+void
+MultiFlowConsumerApp::SendInterest(uint32_t flow, uint32_t seq)
+{
+  const Flow& state = m_flows[flow];
+  shared_ptr<Name> nameWithSequence = make_shared<Name>(state.prefix);
+  nameWithSequence->appendSequenceNumber(seq);
+
+  shared_ptr<Interest> interest = make_shared<Interest>();
+  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
+  interest->setName(*nameWithSequence);
+  interest->setCanBePrefix(false);
+  interest->setMustBeFresh(true);
+
+  NS_LOG_INFO("> Interest for " << *nameWithSequence);
+
+  Time now = Simulator::Now();
+  uint64_t key = GetKey(flow, seq);
+  auto entry = m_requests.find(key);
+  if (entry == m_requests.end()) {
+    Request request;
+    request.firstSent = now;
+    request.deadline = m_deadline.IsZero() ? Time() : now + m_deadline;
+    request.retxCount = 0;
+    entry = m_requests.emplace(key, request).first;
+  }
+  else {
+    m_timers->Cancel(entry->second.timer);
+  }
+  Time lifetime = state.lifetime;
+  if (!entry->second.deadline.IsZero()) {
+    lifetime = std::min(lifetime, entry->second.deadline - now);
+    NfnInterestResolutionEngine::SetDeadline(*interest, entry->second.deadline);
+  }
+  interest->setInterestLifetime(time::milliseconds(std::max<int64_t>(1, lifetime.GetMilliSeconds())));
+  entry->second.lastSent = now;
+  entry->second.retxCount++;
+  entry->second.timer = m_timers->Schedule(GetRetxTimeout(flow), m_timerOwner, key);
+
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+  m_interestTrace(interest);
+}
+
+Time
+MultiFlowConsumerApp::GetRetxTimeout(uint32_t flow) const
+{
+  const Flow& state = m_flows[flow];
+  Time rto = state.srtt < 0 ? m_initialRto : Max(m_minRto, Seconds(state.srtt + 4 * state.rttvar));
+  for (uint32_t i = 0; i < state.backoff && rto < m_maxRto; i++)
+    rto = rto * 2;
+  return Min(rto, m_maxRto);
+}
+
+void
+MultiFlowConsumerApp::OnTimeout(uint64_t key)
+{
+  uint32_t flow = key >> 32;
+  uint32_t seq = key & std::numeric_limits<uint32_t>::max();
+  NS_LOG_FUNCTION(flow << seq);
+  if (Simulator::Now() >= m_flows[flow].stop) {
+    m_requests.erase(key); // like a ConsumerApp, a flow does not retransmit once it stopped
+    return;
+  }
+  auto entry = m_requests.find(key);
+  if (entry != m_requests.end() && !entry->second.deadline.IsZero()
+      && entry->second.deadline <= Simulator::Now()) {
+    // the result would be useless by now, give the request up instead of retransmitting it
+    NS_LOG_INFO("Deadline of " << seq << " passed, not retransmitting it");
+    m_requests.erase(entry);
+    return;
+  }
+  m_flows[flow].backoff = std::min<uint32_t>(m_flows[flow].backoff + 1, 16);
+  SendInterest(flow, seq);
+}
+
+void
+MultiFlowConsumerApp::OnData(shared_ptr<const Data> data)
+{
+  if (!m_active)
+    return;
+
+  App::OnData(data); // tracing inside
+  NS_LOG_INFO("< DATA for " << data->getName());
+  m_onDataTrace(data);
+
+  // a request with a deadline is answered under its name with the parameters digest
+  Name name = NfnInterestResolutionEngine::StripParametersDigest(data->getName());
+  auto flow = m_flowIndex.find(name.getPrefix(-1));
+  if (flow == m_flowIndex.end())
+    return;
+  uint32_t seq = name.at(-1).toSequenceNumber();
+  auto entry = m_requests.find(GetKey(flow->second, seq));
+  if (entry == m_requests.end())
+    return;
+
+  int hopCount = 0;
+  auto hopCountTag = data->getTag<lp::HopCountTag>();
+  if (hopCountTag != nullptr)
+    hopCount = *hopCountTag;
+
+  Time now = Simulator::Now();
+  const Request& request = entry->second;
+  m_lastRetransmittedInterestDataDelay(this, seq, now - request.lastSent, hopCount);
+  m_firstInterestDataDelay(this, seq, now - request.firstSent, request.retxCount, hopCount);
+
+  // RTT samples of retransmitted requests are ambiguous and not taken (Karn)
+  Flow& state = m_flows[flow->second];
+  if (request.retxCount == 1) {
+    double sample = (now - request.lastSent).GetSeconds();
+    if (state.srtt < 0) {
+      state.srtt = sample;
+      state.rttvar = sample / 2;
+    }
+    else {
+      state.rttvar = 0.75 * state.rttvar + 0.25 * std::abs(state.srtt - sample);
+      state.srtt = 0.875 * state.srtt + 0.125 * sample;
+    }
+  }
+  state.backoff = 0;
+
+  m_timers->Cancel(request.timer);
+  m_requests.erase(entry);
+}
+
+void
+MultiFlowConsumerApp::OnNack(shared_ptr<const lp::Nack> nack)
+{
+  /// tracing inside
+  App::OnNack(nack);
+
+  NS_LOG_INFO("NACK received for: " << nack->getInterest().getName() << ", reason: " << nack->getReason());
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
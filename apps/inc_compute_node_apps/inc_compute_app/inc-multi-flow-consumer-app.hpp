@@ -0,0 +1,171 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_MULTI_FLOW_CONSUMER_APP_H
+#define INC_MULTI_FLOW_CONSUMER_APP_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/apps/ndn-app.hpp"
+
+#include "ns3/random-variable-stream.h"
+#include "ns3/nstime.h"
+#include "ns3/inc-timer-wheel.hpp"
+#include "ns3/inc-arrival-process.hpp"
+
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+/**
+ * @ingroup ndn-apps
+ * @brief Consumer that sends the requests of many flows (function prefixes) from one app and one face
+ *
+ * Every flow requests its prefix at its own interval between its start and stop time, like a ConsumerApp with the
+ * same settings. Each flow owns an arrival process of the Randomize type, drawing from the streams of the ConsumerApp
+ * that would sit at the position of this app plus the flow index. All flows share one send event, armed for the flow due next, and the timer wheel of the node for
+ * the retransmission timeouts. A flow keeps its settings, next sequence number and RTT estimate, state beyond that only
+ * exists for outstanding requests. A Deadline is attached and enforced as by INC_ConsumerBaseApp. Delay and interest
+ * traces are those of INC_ConsumerBaseApp.
+ */
+class MultiFlowConsumerApp : public App {
+public:
+  static TypeId
+  GetTypeId();
+
+  MultiFlowConsumerApp();
+  virtual ~MultiFlowConsumerApp();
+
+  /**
+   * @brief Add a flow, before the app starts
+   * @param prefix name requested with appended sequence numbers
+   * @param interval mean time between requests in seconds
+   * @param lifetime interest lifetime
+   * @param start, stop times the flow starts and stops requesting, relative to the start of the app
+   */
+  void
+  AddFlow(const Name& prefix, double interval, Time lifetime, Time start, Time stop);
+
+  uint32_t
+  GetFlowCount() const;
+
+  /**
+   * @brief Requests sent and not answered yet
+   */
+  uint32_t
+  GetOutstanding() const;
+
+  /**
+   * @brief Request rate the arrival processes of the running flows currently offer, in requests per second
+   */
+  double
+  GetOfferedRate() const;
+
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+  virtual void
+  OnNack(shared_ptr<const lp::Nack> nack);
+
+protected:
+  virtual void
+  StartApplication();
+
+  virtual void
+  StopApplication();
+
+private:
+  void
+  ScheduleNextSend();
+
+  void
+  SendDue();
+
+  void
+  SendInterest(uint32_t flow, uint32_t seq);
+
+  void
+  OnTimeout(uint64_t key);
+
+  Time
+  GetRetxTimeout(uint32_t flow) const;
+
+  static uint64_t
+  GetKey(uint32_t flow, uint32_t seq);
+
+private:
+  struct Flow {
+    Name prefix;
+    double interval;
+    Time lifetime;
+    Time start;
+    Time stop;
+    Ptr<IncArrivalProcess> arrivals;
+    uint32_t nextSeq;
+    double srtt;    ///< seconds, negative until the first sample
+    double rttvar;  ///< seconds
+    uint32_t backoff;
+  };
+
+  struct Request {
+    Time firstSent;
+    Time lastSent;
+    Time deadline; ///< absolute, zero for none
+    uint32_t retxCount;
+    IncTimerWheel::Handle timer;
+  };
+
+  typedef std::pair<Time, uint32_t> Due; ///< send time and flow
+
+  std::vector<Flow> m_flows;
+  std::map<Name, uint32_t> m_flowIndex;
+  std::priority_queue<Due, std::vector<Due>, std::greater<Due>> m_due; ///< next request of every active flow
+  std::unordered_map<uint64_t, Request> m_requests;                    ///< outstanding requests by flow and sequence
+  EventId m_sendEvent;
+
+  Ptr<IncTimerWheel> m_timers;
+  uint32_t m_timerOwner;
+  Ptr<UniformRandomVariable> m_rand;   ///< nonce generator
+  std::string m_randomType;            ///< arrival process of the flows, see IncArrivalProcess::CreateProcess
+  Time m_minRto;
+  Time m_maxRto;
+  Time m_initialRto;
+  Time m_deadline; ///< time after the first transmission the result of a request is useless after, zero for none
+
+  TracedCallback<Ptr<App>, uint32_t, Time, int32_t> m_lastRetransmittedInterestDataDelay;
+  TracedCallback<Ptr<App>, uint32_t, Time, uint32_t, int32_t> m_firstInterestDataDelay;
+  TracedCallback<shared_ptr<const Interest>> m_interestTrace;
+  TracedCallback<shared_ptr<const Data>> m_onDataTrace;
+  TracedCallback<Ptr<App>> m_arrivalTrace;
+};
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
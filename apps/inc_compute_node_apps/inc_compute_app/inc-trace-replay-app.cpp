@@ -0,0 +1,198 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-trace-replay-app.hpp"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/NFN-interest-resolution-engine.hpp"
+
+#include <algorithm>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("inc.TraceReplayConsumerApp");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+NS_OBJECT_ENSURE_REGISTERED(TraceReplayConsumerApp);
+
+TypeId
+TraceReplayConsumerApp::GetTypeId(void)
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::inc::TraceReplayConsumerApp")
+      .SetGroupName("Inc")
+      .SetParent<INC_ConsumerBaseApp>()
+      .AddConstructor<TraceReplayConsumerApp>()
+      .AddTraceSource("ExpiredInc", "Invocation given up because its deadline passed",
+                      MakeTraceSourceAccessor(&TraceReplayConsumerApp::m_expired),
+                      "ns3::ndn::inc::TraceReplayConsumerApp::ExpiredCallback");
+  return tid;
+}
+
+TraceReplayConsumerApp::TraceReplayConsumerApp()
+{
+  NS_LOG_FUNCTION_NOARGS();
+}
+
+TraceReplayConsumerApp::~TraceReplayConsumerApp()
+{
+}
+
+bool
+TraceReplayConsumerApp::Invoke(const Name& name, Time deadline)
+{
+  if (!m_active)
+    return false;
+
+  uint32_t seq = m_seq++;
+  Invocation& invocation = m_invocations[seq];
+  invocation.name = name;
+  invocation.deadline = deadline.IsZero() && !m_deadline.IsZero() ? Simulator::Now() + m_deadline : deadline;
+  m_queued.push_back(seq);
+  ScheduleNextPacket();
+  return true;
+}
+
+uint32_t
+TraceReplayConsumerApp::GetOutstanding() const
+{
+  return m_invocations.size();
+}
+
+void
+TraceReplayConsumerApp::ScheduleNextPacket()
+{
+  if (!m_sendEvent.IsRunning() && (!m_retxSeqs.empty() || !m_queued.empty()))
+    m_sendEvent = Simulator::ScheduleNow(&TraceReplayConsumerApp::SendInvocation, this);
+}
+
+void
+TraceReplayConsumerApp::SendInvocation()
+{
+  if (!m_active)
+    return;
+
+  // retransmissions first, invocations past their deadline are given up instead of being sent
+  Time now = Simulator::Now();
+  uint32_t seq = std::numeric_limits<uint32_t>::max();
+  while (seq == std::numeric_limits<uint32_t>::max() && (!m_retxSeqs.empty() || !m_queued.empty())) {
+    if (!m_retxSeqs.empty()) {
+      seq = *m_retxSeqs.begin();
+      m_retxSeqs.erase(m_retxSeqs.begin());
+    }
+    else {
+      seq = m_queued.front();
+      m_queued.pop_front();
+    }
+    auto entry = m_invocations.find(seq);
+    if (entry == m_invocations.end()) {
+      seq = std::numeric_limits<uint32_t>::max(); // answered meanwhile
+    }
+    else if (!entry->second.deadline.IsZero() && entry->second.deadline <= now) {
+      Expire(seq);
+      seq = std::numeric_limits<uint32_t>::max();
+    }
+  }
+  if (seq == std::numeric_limits<uint32_t>::max())
+    return;
+
+  shared_ptr<Interest> interest = PrepareInterest(seq);
+
+  NS_LOG_INFO("> Interest for " << interest->getName());
+
+  WillSendOutInterest(seq);
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+  m_interestTrace(interest);
+  ScheduleNextPacket();
+}
+
+shared_ptr<Interest>
+TraceReplayConsumerApp::PrepareInterest(uint32_t seq)
+{
+  auto entry = m_invocations.find(seq);
+  if (entry == m_invocations.end() ||
+      (!entry->second.deadline.IsZero() && entry->second.deadline <= Simulator::Now()))
+    return nullptr;
+
+  const Invocation& invocation = entry->second;
+  shared_ptr<Name> nameWithSequence = make_shared<Name>(invocation.name);
+  nameWithSequence->appendSequenceNumber(seq);
+
+  Time lifetime = m_interestLifeTime;
+  if (!invocation.deadline.IsZero())
+    lifetime = std::min(lifetime, invocation.deadline - Simulator::Now());
+
+  shared_ptr<Interest> interest = make_shared<Interest>();
+  interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
+  interest->setName(*nameWithSequence);
+  interest->setCanBePrefix(false);
+  interest->setInterestLifetime(time::milliseconds(std::max<int64_t>(1, lifetime.GetMilliSeconds())));
+  interest->setMustBeFresh(true);
+  if (!invocation.deadline.IsZero())
+    NfnInterestResolutionEngine::SetDeadline(*interest, invocation.deadline);
+  return interest;
+}
+
+void
+TraceReplayConsumerApp::Expire(uint32_t seq)
+{
+  NS_LOG_INFO("Deadline of " << m_invocations[seq].name << " for " << seq << " passed");
+  m_expired(this, seq, m_invocations[seq].name);
+  m_invocations.erase(seq);
+  CancelRetxTimeout(seq);
+  CancelHedge(seq);
+  m_hedged.erase(seq);
+  m_seqFullDelay.erase(seq);
+  m_seqLastDelay.erase(seq);
+  m_seqRetxCounts.erase(seq);
+}
+
+void
+TraceReplayConsumerApp::OnData(shared_ptr<const Data> data)
+{
+  if (!m_active)
+    return;
+
+  INC_ConsumerBaseApp::OnData(data);
+  m_invocations.erase(GetSequenceNumber(data->getName()));
+}
+
+void
+TraceReplayConsumerApp::StopApplication()
+{
+  NS_LOG_FUNCTION_NOARGS();
+  NS_LOG_INFO(m_invocations.size() << " invocations outstanding at stop");
+  m_invocations.clear();
+  m_queued.clear();
+
+  INC_ConsumerBaseApp::StopApplication();
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
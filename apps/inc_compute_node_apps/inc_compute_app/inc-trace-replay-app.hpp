@@ -0,0 +1,109 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_TRACE_REPLAY_APP_H
+#define INC_TRACE_REPLAY_APP_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/incSIM-module.h"
+
+#include <deque>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+/**
+ * @ingroup ndn-apps
+ * @brief Consumer that sends one compute request per invocation handed to it, e.g. by IncTraceReplayer
+ *
+ * Every invocation gets its own sequence number and keeps its name until its data arrives. Retransmissions follow
+ * the RTO of INC_ConsumerBaseApp. An invocation with a deadline is given up once the deadline has passed, its
+ * interests never outlive it and carry it to the compute nodes.
+ */
+class TraceReplayConsumerApp : public INC_ConsumerBaseApp {
+public:
+  static TypeId
+  GetTypeId();
+
+  TraceReplayConsumerApp();
+  virtual ~TraceReplayConsumerApp();
+
+  /**
+   * @brief Request a function invocation
+   * @param name compute request prefix, the sequence number is appended
+   * @param deadline absolute time the result is useless after, zero for the Deadline attribute of the app
+   * @returns false if the app is not running
+   */
+  bool
+  Invoke(const Name& name, Time deadline);
+
+  /**
+   * @brief Invocations sent or queued, whose data has not arrived yet
+   */
+  uint32_t
+  GetOutstanding() const;
+
+  virtual void
+  OnData(shared_ptr<const Data> data);
+
+public:
+  typedef void (*ExpiredCallback)(Ptr<App> app, uint32_t seqno, const Name& name);
+
+protected:
+  virtual void
+  ScheduleNextPacket();
+
+  virtual shared_ptr<Interest>
+  PrepareInterest(uint32_t seq);
+
+  virtual void
+  StopApplication();
+
+private:
+  void
+  SendInvocation();
+
+  void
+  Expire(uint32_t seq);
+
+private:
+  struct Invocation {
+    Name name;
+    Time deadline;
+  };
+
+  std::unordered_map<uint32_t, Invocation> m_invocations; ///< outstanding invocations by sequence number
+  std::deque<uint32_t> m_queued;                           ///< invocations not sent yet
+
+  TracedCallback<Ptr<App>, uint32_t, const Name&> m_expired; ///< invocations given up at their deadline
+};
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
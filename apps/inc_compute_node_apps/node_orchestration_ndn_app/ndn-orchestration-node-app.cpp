@@ -35,6 +35,7 @@
 #include "ns3/packet.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/incSIM-module.h"
+#include "ns3/orchestration-message-codec.hpp"
 #include "ns3/random-variable-stream.h"
 
 NS_LOG_COMPONENT_DEFINE("ndn.inc.NdnOrchestrationComputeNodeApp");
@@ -69,6 +70,12 @@ namespace inc{
               .AddAttribute("KeyLocator",
                             "Name to be used for key locator.  If root, then key locator is not used",
                             NameValue(), MakeNameAccessor(&NdnOrchestrationComputeNodeApp::m_keyLocator), MakeNameChecker())
+              .AddAttribute("PushTelemetry", "Push the node status to the orchestrator when a load threshold is crossed",
+                            BooleanValue(false), MakeBooleanAccessor(&NdnOrchestrationComputeNodeApp::m_push),
+                            MakeBooleanChecker())
+              .AddAttribute("NotificationPrefix", "Prefix of the status notification interests sent to the orchestrator",
+                            StringValue("/Orchestrator/Notify"),
+                            MakeNameAccessor(&NdnOrchestrationComputeNodeApp::m_notificationPrefix), MakeNameChecker())
               .AddTraceSource("EnableFunction",
                             "Trace called every time there is an enable function action",
                             MakeTraceSourceAccessor(&NdnOrchestrationComputeNodeApp::m_onFuncEnableTrace),
@@ -81,6 +88,7 @@ namespace inc{
     }
 
     NdnOrchestrationComputeNodeApp::NdnOrchestrationComputeNodeApp()
+      : m_notificationSeq(0)
     {
       NS_LOG_FUNCTION_NOARGS();
     }
@@ -93,12 +101,23 @@ namespace inc{
       NS_LOG_FUNCTION_NOARGS();
       App::StartApplication();
       FibHelper::AddRoute(GetNode(), m_prefix, m_face, 0);
+      if(m_push)
+      {
+        //thresholds of the trigger are set via ns3::ndn::inc::StatusPushTrigger attribute defaults
+        m_push_trigger = CreateObject<StatusPushTrigger>();
+        m_push_trigger->Start(m_compute_node, MakeCallback(&NdnOrchestrationComputeNodeApp::SendStatusNotification, this));
+      }
     }
 
     void
     NdnOrchestrationComputeNodeApp::StopApplication()
     {
       NS_LOG_FUNCTION_NOARGS();
+      if(m_push_trigger != 0)
+      {
+        m_push_trigger->Stop();
+        m_push_trigger = 0;
+      }
       App::StopApplication();
     }
 
@@ -127,7 +146,7 @@ namespace inc{
       m_interest = interest->getName();
       if(m_interest.getSubName(0,1)== "/Orchestrator")
       {
-        OrchestratorRequestResolution(m_interest);
+        OrchestratorRequestResolution(interest);
       }
       else
       {
@@ -153,31 +172,37 @@ namespace inc{
     }
 
   void
-  NdnOrchestrationComputeNodeApp::OrchestratorRequestResolution(Name m_interest)
+  NdnOrchestrationComputeNodeApp::OrchestratorRequestResolution(shared_ptr<const Interest> interest)
   {
-      std::string payload;
+      Name m_interest = interest->getName();
+      //status and function switch replies are orchestration TLV messages, nested into the Data content
+      ::ndn::Block content;
       if((m_interest.getSubName(2,1) == "/BootstrapInfo") || (m_interest.getSubName(2,1)== "/NodeStatusFetch"))
       {
-        payload = StatusFetchHandler(m_interest);
-        std::cout<<payload<<std::endl;
+        content = StatusFetchHandler(m_interest);
       }
       else if(m_interest.getSubName(2,1)== "/FunctionStatus")
       {
-        payload = FunctionStatusRequestHandler(m_interest);
+        content = ::ndn::encoding::makeStringBlock(::ndn::tlv::Content, FunctionStatusRequestHandler(m_interest));
       }
       else if(m_interest.getSubName(2,1)== "/FunctionSwitch")
       {
         NS_LOG_INFO("Inside ndn orchestration node app: Orchestration Request Resolution : FunctionSwitch");
-        payload = FunctionSwitchHandler(m_interest);
+        content = FunctionSwitchHandler(m_interest);
+      }
+      else if(m_interest.getSubName(2,1)== "/NodeCommand")
+      {
+        NS_LOG_INFO("Inside ndn orchestration node app: Orchestration Request Resolution : NodeCommand");
+        content = NodeCommandHandler(interest);
       }
       else
       {
-        payload = "Unknown request";
+        content = ::ndn::encoding::makeStringBlock(::ndn::tlv::Content, "Unknown request");
       }
       auto data = make_shared<Data>();
       data->setName(m_interest);
       //data->setContent(make_shared<::ndn::Buffer>(m_virtualPayloadSize));
-      data->setContent(::ndn::encoding::makeStringBlock(::ndn::tlv::Content, payload));
+      data->setContent(content);
       Signature signature;
       SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
       if (m_keyLocator.size() > 0)
@@ -189,46 +214,24 @@ namespace inc{
       data->setSignature(signature);
       data->setFreshnessPeriod(::ndn::time::milliseconds(1));
       NS_LOG_INFO("[Node Orchestrator App] node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
-      NS_LOG_INFO("[Node Orchestrator App] node(" << GetNode()->GetId() << ") responding with Data: " << data->getContent().value());
+      NS_LOG_INFO("[Node Orchestrator App] node(" << GetNode()->GetId() << ") content size: " << data->getContent().value_size());
       // to create real wire encoding
       data->wireEncode();
       m_transmittedDatas(data, this, m_face);
       m_appLink->onReceiveData(*data);
   }
 
-  std::string
+  ::ndn::Block
   NdnOrchestrationComputeNodeApp::StatusFetchHandler(Name m_interest){
 	NS_LOG_INFO("[Node Orchestrator App] Received node status request from orchestrator"<<std::endl);
+  uint32_t type = orchestration_tlv::NodeStatusFetch;
   if(m_interest.getSubName(2,1) == "/BootstrapInfo")
   {
     m_compute_node->ResetNodeBusyCounter();
+    type = orchestration_tlv::BootstrapInfo;
   }
 
-	std::stringstream ss;
-	ss << "name=/"<< m_compute_node->GetName()<< ";"
-	<< "processor_core="<< m_compute_node->GetProcessorCore() << ";"
-	<< "processor_type="<<m_compute_node->GetProcessorClockSpeed()<<";"
-	<< "RAM=" << m_compute_node->GetRam() << ";"
-	<< "ROM=" << m_compute_node->GetRom() << ";"
-	<< "links=" << m_compute_node->GetLinks() << ";"
-	<< "runtimes=" << m_compute_node->GetSupportedRuntimes() << ";"
-  << "node_busy_counter="<<m_compute_node->GetNodeBusyCounter()<<";"
-  << "data="<<m_compute_node->GetProvidedData()<<";"
-  << "functions="
-	//<< "exec times=" << m_compute_node->GetFunction("/SumOfNumbers")->GetCounter() << ";"
-	;
-	for(auto& it:m_compute_node->GetFunctionMap()){
-	        	ss<<it.first<<":"
-	        		<<it.second->GetEnableStatus()<<":"
-						  <<it.second->GetCounter()<<":"
-						  <<it.second->GetMissExecCounter()<<":"
-              <<it.second->GetCpu()<<":"
-              <<it.second->GetRam()<<":"
-              <<it.second->GetRom()<<":"
-              <<it.second->GetFuncSize()<<":"
-              <<it.second->GetInputList();
-	        }
-	std::string payload = ss.str();
+  ::ndn::Block payload = OrchestrationMessageCodec::EncodeNodeStatus(type, m_compute_node);
   m_compute_node->ResetNodeBusyCounter();
 	return payload;
 }
@@ -247,11 +250,11 @@ NdnOrchestrationComputeNodeApp::FunctionStatusRequestHandler(Name m_interest){
 	return payload;
 }
 
-std::string
+::ndn::Block
 NdnOrchestrationComputeNodeApp::FunctionSwitchHandler(Name m_interest){
 	NS_LOG_INFO("[Node Orchestrator App] Received enable/disable function request from orchestrator"<<std::endl);
 	std::string operation = (m_interest.getSubName(3,1)).toUri(); // eg name: Orchestrator/Node1/FunctionSwitch/Disable/Func1/Func2/Func3
-  bool flag;
+  bool flag = false;
 
   for(uint32_t i = 4; i<m_interest.size();i++)
   {
@@ -275,17 +278,56 @@ NdnOrchestrationComputeNodeApp::FunctionSwitchHandler(Name m_interest){
       }
 	  }
   }
-	std::string payload;
-
-	if(flag){
-	  payload="operation success";
-	}else{
-	  payload="operation failed";
-	}
-	return payload;
+	return OrchestrationMessageCodec::EncodeAck(m_compute_node->GetName(), flag);
 }
 
+::ndn::Block
+NdnOrchestrationComputeNodeApp::NodeCommandHandler(shared_ptr<const Interest> interest){
+	NS_LOG_INFO("[Node Orchestrator App] Received node command from orchestrator"<<std::endl);
+  OrchestrationNodeCommand command;
+  uint32_t type;
+  const uint8_t* value;
+  size_t valueLen;
+  const ::ndn::Block& parameters = interest->getApplicationParameters();
+  if(!interest->hasApplicationParameters() ||
+     !OrchestrationMessageCodec::ReadMessage(parameters.value(), parameters.value_size(), type, value, valueLen) ||
+     type != orchestration_tlv::NodeCommand ||
+     !OrchestrationMessageCodec::DecodeNodeCommand(value, valueLen, command))
+  {
+    NS_LOG_WARN("[Node Orchestrator App] node(" << GetNode()->GetId() << ") malformed node command");
+    return OrchestrationMessageCodec::EncodeAck(m_compute_node->GetName(), false);
+  }
 
+  std::vector<std::string> enabled;
+  std::vector<std::string> disabled;
+  bool flag = GetComputeNode()->ApplyCommand(command, enabled, disabled);
+  for(auto& func_name : disabled)
+    this->m_onFuncDisableTrace(func_name);
+  for(auto& func_name : enabled)
+    this->m_onFuncEnableTrace(func_name);
+	return OrchestrationMessageCodec::EncodeAck(m_compute_node->GetName(), flag, command.seq);
+}
+
+/*
+The orchestrator cannot be reached by a Data packet without a pending Interest, so the status is carried
+in the ApplicationParameters of an Interest named <NotificationPrefix>/<node>/<reason>/<seq>.
+The orchestrator answers with an Ack Data which consumes the PIT entries on the way back.
+*/
+void
+NdnOrchestrationComputeNodeApp::SendStatusNotification(std::string reason)
+{
+  if (!m_active)
+    return;
+  Name notification = m_notificationPrefix;
+  notification.append(m_compute_node->GetName()).append(reason).appendNumber(m_notificationSeq++);
+  shared_ptr<Interest> interest = make_shared<Interest>(notification);
+  interest->setCanBePrefix(false);
+  interest->setMustBeFresh(true);
+  interest->setApplicationParameters(OrchestrationMessageCodec::EncodeNodeStatus(orchestration_tlv::StatusNotification, m_compute_node));
+  NS_LOG_INFO("[Node Orchestrator App] node(" << GetNode()->GetId() << ") pushing status: " << interest->getName());
+  m_transmittedInterests(interest, this, m_face);
+  m_appLink->onReceiveInterest(*interest);
+}
 
       }//namespace inc
   } // namespace ndn
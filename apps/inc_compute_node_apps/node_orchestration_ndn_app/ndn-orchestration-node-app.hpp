@@ -28,6 +28,7 @@
 #define NDN_ORCHESTRATOR_NODE_APP_H_
 #include "ns3/incSIM-module.h"
 #include "ns3/ndnSIM/apps/ndn-app.hpp"
+#include "ns3/status-push-trigger.hpp"
 
 namespace ns3{
 namespace ndn{
@@ -59,17 +60,25 @@ namespace inc{
       void SetComputeNode(Ptr<IncOrchestrationComputeNode> cn);
 
       void
-      OrchestratorRequestResolution(Name m_interest);
+      OrchestratorRequestResolution(shared_ptr<const Interest> interest);
 
-      std::string
+      ::ndn::Block
       StatusFetchHandler(Name interest);
 
       std::string
       FunctionStatusRequestHandler(Name interest);
 
-      std::string
+      ::ndn::Block
       FunctionSwitchHandler(Name m_interest);
 
+      //applies a batched command carried in the ApplicationParameters, disables first, then enables and priorities
+      ::ndn::Block
+      NodeCommandHandler(shared_ptr<const Interest> interest);
+
+      //pushes the node status to the orchestrator as a notification interest, called by the push trigger
+      void
+      SendStatusNotification(std::string reason);
+
       ~NdnOrchestrationComputeNodeApp();
       typedef void ( *EnableFunctionCallback)(std::string);
       typedef void ( *DisableFunctionCallback)(std::string);
@@ -85,7 +94,11 @@ namespace inc{
       Ptr<IncOrchestrationComputeNode> m_compute_node;
       TracedCallback<std::string> m_onFuncEnableTrace;
       TracedCallback<std::string> m_onFuncDisableTrace;
-
+      //push based status reporting
+      bool m_push;
+      Name m_notificationPrefix;
+      uint32_t m_notificationSeq;
+      Ptr<StatusPushTrigger> m_push_trigger;
 
     };
    }//namespace inc
@@ -38,15 +38,17 @@
 #include "ns3/socket-factory.h"
 #include "ns3/packet.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/ptr.h"
 #include "ns3/log.h"
 #include <sstream>
+#include <cstring>
 #include <iostream>
 #include "ns3/pointer.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/incSIM-module.h"
-#include <boost/algorithm/string.hpp>
+#include "ns3/orchestration-message-codec.hpp"
 
 NS_LOG_COMPONENT_DEFINE ("ndn.inc.UdpOrchestrationComputeNodeApp");
 
@@ -70,6 +72,11 @@ UdpOrchestrationComputeNodeApp::GetTypeId (void)
                          PointerValue (),
                          MakePointerAccessor (&UdpOrchestrationComputeNodeApp::m_compute_node),
                          MakePointerChecker<IncOrchestrationComputeNode> ())
+          .AddAttribute ("PushTelemetry",
+                         "Push the node status to the orchestrator when a load threshold is crossed",
+                         BooleanValue (false),
+                         MakeBooleanAccessor (&UdpOrchestrationComputeNodeApp::m_push),
+                         MakeBooleanChecker ())
           .AddTraceSource ("Rx", "A packet has been received",
                            MakeTraceSourceAccessor (&UdpOrchestrationComputeNodeApp::m_rxTrace),
                            "ns3::Packet::TracedCallback")
@@ -81,6 +88,8 @@ UdpOrchestrationComputeNodeApp::GetTypeId (void)
 }
 
 UdpOrchestrationComputeNodeApp::UdpOrchestrationComputeNodeApp ()
+  : m_rx_buffer (DEFAULT_BUFFER_SIZE),
+    m_tx_buffer (DEFAULT_BUFFER_SIZE)
 {
 
   NS_LOG_FUNCTION (this);
@@ -165,6 +174,13 @@ UdpOrchestrationComputeNodeApp::StartApplication (void)
     }
   m_socket->SetRecvCallback (MakeCallback (&UdpOrchestrationComputeNodeApp::HandleRead, this));
   m_socket6->SetRecvCallback (MakeCallback (&UdpOrchestrationComputeNodeApp::HandleRead, this));
+  if (m_push)
+    {
+      //thresholds of the trigger are set via ns3::ndn::inc::StatusPushTrigger attribute defaults
+      m_push_trigger = CreateObject<StatusPushTrigger> ();
+      m_push_trigger->Start (m_compute_node,
+                             MakeCallback (&UdpOrchestrationComputeNodeApp::SendStatusNotification, this));
+    }
 }
 
 void
@@ -172,6 +188,12 @@ UdpOrchestrationComputeNodeApp::StopApplication ()
 {
   NS_LOG_FUNCTION (this);
 
+  if (m_push_trigger != 0)
+    {
+      m_push_trigger->Stop ();
+      m_push_trigger = 0;
+    }
+  m_orchestrator_socket = 0;
   if (m_socket != 0)
     {
       m_socket->Close ();
@@ -184,13 +206,50 @@ UdpOrchestrationComputeNodeApp::StopApplication ()
     }
 }
 
+Ptr<Packet>
+UdpOrchestrationComputeNodeApp::OrchestrationRequestResolution (uint32_t type, const uint8_t *value,
+                                                                size_t valueLen)
+{
+  Ptr<Packet> response;
+  if (type == orchestration_tlv::BootstrapInfo || type == orchestration_tlv::NodeStatusFetch)
+    {
+      response = StatusFetchHandler (type);
+      return response;
+    }
+  else if (type == orchestration_tlv::FunctionSwitch)
+    {
+      OrchestrationFunctionSwitch command;
+      if (OrchestrationMessageCodec::DecodeFunctionSwitch (value, valueLen, command))
+        {
+          response = FunctionSwitchHandler (command);
+          return response;
+        }
+    }
+  else if (type == orchestration_tlv::NodeCommand)
+    {
+      OrchestrationNodeCommand command;
+      if (OrchestrationMessageCodec::DecodeNodeCommand (value, valueLen, command))
+        {
+          response = NodeCommandHandler (command);
+          return response;
+        }
+    }
+  response = UnknownPacketHandler ("orchestration message type " + std::to_string (type));
+  return response;
+}
+
 Ptr<Packet>
 UdpOrchestrationComputeNodeApp::OrchestrationRequestResolution (std::string packet_data)
 {
   Ptr<Packet> response;
-  if (packet_data == "/BootstrapInfo" || (packet_data == "/NodeStatusFetch"))
+  if (packet_data == "/BootstrapInfo")
     {
-      response = StatusFetchHandler (packet_data);
+      response = StatusFetchHandler (orchestration_tlv::BootstrapInfo);
+      return response;
+    }
+  else if (packet_data == "/NodeStatusFetch")
+    {
+      response = StatusFetchHandler (orchestration_tlv::NodeStatusFetch);
       return response;
     }
   else if (packet_data == "/FunctionStatus")
@@ -200,7 +259,8 @@ UdpOrchestrationComputeNodeApp::OrchestrationRequestResolution (std::string pack
     }
   else if (packet_data.find("/FunctionSwitch")!= packet_data.npos)
     {
-      response = FunctionSwitchHandler (packet_data);
+      //eg name: /Orchestrator/Node1/FunctionSwitch/Disable/Func1/Func2/Func3
+      response = FunctionSwitchHandler (OrchestrationMessageCodec::FunctionSwitchFromName (Name (packet_data)));
       return response;
     }
   else
@@ -214,40 +274,18 @@ UdpOrchestrationComputeNodeApp::OrchestrationRequestResolution (std::string pack
 //--------------------------Status Fetch handler---------------------------//
 //-------------------------------------------------------------------------//
 Ptr<Packet>
-UdpOrchestrationComputeNodeApp::StatusFetchHandler (std::string packet_data)
+UdpOrchestrationComputeNodeApp::StatusFetchHandler (uint32_t type)
 {
   Ptr<Packet> response;
   NS_LOG_INFO ("[Computation Node] Receive bootstrapp node status request from orchestrator"
                << std::endl);
-  std::stringstream ss;
-  ss << "/Orchestrator/" << m_compute_node->GetName ()<<packet_data<<"/"
-     << "name=/" << m_compute_node->GetName () << ";"
-     << "processor_core=" << m_compute_node->GetProcessorCore () << ";"
-     << "processor_type=" << m_compute_node->GetProcessorClockSpeed () << ";"
-     << "RAM=" << m_compute_node->GetRam () << ";"
-     << "ROM=" << m_compute_node->GetRom () << ";"
-     << "links=" << m_compute_node->GetLinks () << ";"
-     << "runtimes=" << m_compute_node->GetSupportedRuntimes () << ";"
-     << "node_busy_counter="<<m_compute_node->GetNodeBusyCounter()<<";"
-     << "data="<<m_compute_node->GetProvidedData()<<";"
-     << "functions=";
-  for (auto &it : m_compute_node->GetFunctionMap ())
+  if (type == orchestration_tlv::BootstrapInfo)
     {
-      ss << it.first << ":"
-      << it.second->GetEnableStatus () << ":"
-      << it.second->GetCounter ()<< ":"
-      << it.second->GetMissExecCounter ()<< ":"
-      << it.second->GetCpu()<< ":"
-      << it.second->GetRam()<< ":"
-      <<it.second->GetRom()<<":"
-      <<it.second->GetFuncSize()<<":"
-      <<it.second->GetInputList();
+      m_compute_node->ResetNodeBusyCounter();
     }
-  std::string payload = ss.str ();
+  response = StatusPacket (type);
   m_compute_node->ResetNodeBusyCounter();
-  NS_LOG_INFO ("[Computation Node] Sending packet content:");
-  NS_LOG_INFO (payload << std::endl);
-  response = Create<Packet> ((uint8_t *) payload.c_str (), payload.size () + 1);
+  NS_LOG_INFO ("[Computation Node] Sending node status of " << response->GetSize () << " bytes" << std::endl);
   return response;
 }
 
@@ -256,25 +294,17 @@ UdpOrchestrationComputeNodeApp::StatusFetchHandler (std::string packet_data)
 //-------------------------------------------------------------------------//
 
 Ptr<Packet>
-UdpOrchestrationComputeNodeApp::FunctionSwitchHandler (std::string packet_data)
+UdpOrchestrationComputeNodeApp::FunctionSwitchHandler (const OrchestrationFunctionSwitch &command)
 {
   Ptr<Packet> response;
-  std::string payload;
-  NS_LOG_INFO("Packet data is "<<packet_data<<std::endl);
   bool flag=false;
   NS_LOG_INFO ("[Computation Node]Receive enable/disable function request from orchestrator"
                << std::endl);
-  //eg name: Orchestrator/Node1/FunctionSwitch/Disable/Func1/Func2/Func3
-  std::vector<std::string> tokens;
-  boost::split (tokens, packet_data, boost::is_any_of ("/"));
-  for(auto i =tokens.begin(); i!=tokens.end();++i)
-  std::cout<<*i<<endl;
-  auto itr = tokens.begin();
-  for (std::advance(itr,5); itr != tokens.end()-1; ++itr) //starting from the fourth token
+  for (auto itr = command.functions.begin (); itr != command.functions.end (); ++itr)
     {
-      if (tokens[4].compare("Enable")==0)
+      const std::string &func_name = *itr;
+      if (command.enable)
         {
-          std::string func_name = (*itr).insert(0,1,'/');
           flag = GetComputeNode ()->EnableFunction(func_name);
           if(GetComputeNode()->CheckExcludeList(func_name))
             GetComputeNode()->RemoveFromExcludeList(func_name);
@@ -283,9 +313,8 @@ UdpOrchestrationComputeNodeApp::FunctionSwitchHandler (std::string packet_data)
               this->m_onFuncEnableTrace(func_name);
             }
         }
-      else if(tokens[4].compare("Disable")==0)
+      else
         {
-          std::string func_name = (*itr).insert(0,1,'/');
           flag = GetComputeNode ()->DisableFunction(func_name);
           GetComputeNode()->AddToExcludeList(func_name);
           if(flag)
@@ -295,17 +324,34 @@ UdpOrchestrationComputeNodeApp::FunctionSwitchHandler (std::string packet_data)
         }
     }
 
-  if (flag)
+  NS_LOG_INFO ("[Computation Node] Sending function switch ack: " << (flag ? "success" : "failed") << std::endl);
+  response = AckPacket (flag, 0);
+  return response;
+}
+
+//-------------------------------------------------------------------------//
+//-----------------------------Node Command Handler------------------------//
+//-------------------------------------------------------------------------//
+
+Ptr<Packet>
+UdpOrchestrationComputeNodeApp::NodeCommandHandler (const OrchestrationNodeCommand &command)
+{
+  Ptr<Packet> response;
+  NS_LOG_INFO ("[Computation Node] Receive node command from orchestrator" << std::endl);
+  std::vector<std::string> enabled;
+  std::vector<std::string> disabled;
+  bool flag = GetComputeNode ()->ApplyCommand (command, enabled, disabled);
+  for (auto &func_name : disabled)
     {
-      payload = "operation success";
+      this->m_onFuncDisableTrace (func_name);
     }
-  else
+  for (auto &func_name : enabled)
     {
-      payload = "operation failed";
+      this->m_onFuncEnableTrace (func_name);
     }
-  NS_LOG_INFO ("[Computation Node] Sending packet content:");
-  NS_LOG_INFO (payload << std::endl);
-  response = Create<Packet> ((uint8_t *) payload.c_str (), payload.size () + 1);
+
+  NS_LOG_INFO ("[Computation Node] Sending node command ack: " << (flag ? "success" : "failed") << std::endl);
+  response = AckPacket (flag, command.seq);
   return response;
 }
 
@@ -340,15 +386,56 @@ UdpOrchestrationComputeNodeApp::UnknownPacketHandler (std::string packet_data)
   Ptr<Packet> response;
   std::cout<<"Received Packet is : "<<packet_data<<std::endl;
   NS_LOG_INFO ("[Computation Node] Receive unknown request from orchestrator" << std::endl);
-  std::stringstream ss;
-  ss << "Unknown orchestration instruction";
-  std::string payload = ss.str ();
+  static const std::string payload = "Unknown orchestration instruction";
   NS_LOG_INFO ("[Computation Node] Sending packet content:");
   NS_LOG_INFO (payload << std::endl);
   response = new Packet (payload);
   return response;
 }
 
+Ptr<Packet>
+UdpOrchestrationComputeNodeApp::StatusPacket (uint32_t type)
+{
+  size_t size = OrchestrationMessageCodec::EncodeNodeStatus (m_tx_buffer.data (), m_tx_buffer.size (), type,
+                                                             m_compute_node);
+  if (size > m_tx_buffer.size ())
+    {
+      m_tx_buffer.resize (size);
+      size = OrchestrationMessageCodec::EncodeNodeStatus (m_tx_buffer.data (), m_tx_buffer.size (), type,
+                                                          m_compute_node);
+    }
+  return Create<Packet> (m_tx_buffer.data () + m_tx_buffer.size () - size, size);
+}
+
+Ptr<Packet>
+UdpOrchestrationComputeNodeApp::AckPacket (bool success, uint32_t seq)
+{
+  size_t size = OrchestrationMessageCodec::EncodeAck (m_tx_buffer.data (), m_tx_buffer.size (),
+                                                      m_compute_node->GetName (), success, seq);
+  if (size > m_tx_buffer.size ())
+    {
+      m_tx_buffer.resize (size);
+      size = OrchestrationMessageCodec::EncodeAck (m_tx_buffer.data (), m_tx_buffer.size (),
+                                                   m_compute_node->GetName (), success, seq);
+    }
+  return Create<Packet> (m_tx_buffer.data () + m_tx_buffer.size () - size, size);
+}
+
+void
+UdpOrchestrationComputeNodeApp::SendStatusNotification (std::string reason)
+{
+  NS_LOG_FUNCTION (this << reason);
+  if (m_orchestrator_socket == 0)
+    {
+      NS_LOG_INFO ("[Computation Node] No orchestrator known yet, status push " << reason << " dropped");
+      return;
+    }
+  Ptr<Packet> notification = StatusPacket (orchestration_tlv::StatusNotification);
+  NS_LOG_INFO ("[Computation Node] At time " << Simulator::Now ().GetSeconds () << "s pushing status ("
+                                             << reason << ") of " << notification->GetSize () << " bytes");
+  m_orchestrator_socket->SendTo (notification, 0, m_orchestrator);
+}
+
 void
 UdpOrchestrationComputeNodeApp::HandleRead (Ptr<ns3::Socket> socket)
 {
@@ -386,10 +473,28 @@ UdpOrchestrationComputeNodeApp::HandleRead (Ptr<ns3::Socket> socket)
       Ptr<Node> Current_Node = this->GetNode ();
       //Ptr<ns3::ndn::INC_Compute> inc_compute = Current_Node->GetApplication(0)->GetObject<ns3::ndn::INC_Compute>();
 
-      uint8_t *buffer = new uint8_t[packet->GetSize ()];
-      packet->CopyData (buffer, packet->GetSize ());
-      std::string packet_data = std::string ((char *) buffer);
-      response = OrchestrationRequestResolution (packet_data);
+      //the payload is copied once into the receive buffer kept by the app and decoded in place
+      uint32_t size = packet->GetSize ();
+      if (m_rx_buffer.size () < size)
+        {
+          m_rx_buffer.resize (size);
+        }
+      packet->CopyData (m_rx_buffer.data (), size);
+      //orchestration TLV messages, plain text requests are still understood
+      uint32_t type;
+      const uint8_t *value;
+      size_t valueLen;
+      if (OrchestrationMessageCodec::ReadMessage (m_rx_buffer.data (), size, type, value, valueLen))
+        {
+          response = OrchestrationRequestResolution (type, value, valueLen);
+        }
+      else
+        {
+          //text requests are NUL terminated by the sender, but never read past the payload
+          const char *text = reinterpret_cast<const char *> (m_rx_buffer.data ());
+          std::string packet_data (text, strnlen (text, size));
+          response = OrchestrationRequestResolution (packet_data);
+        }
 
       //------------------------------------------------------------//
       //----------------------End of Orchestration------------------//
@@ -400,6 +505,8 @@ UdpOrchestrationComputeNodeApp::HandleRead (Ptr<ns3::Socket> socket)
 
       NS_LOG_LOGIC ("[Computation Node] Sending node status info");
       socket->SendTo (response, 0, from);
+      m_orchestrator_socket = socket;
+      m_orchestrator = from;
 
       if (InetSocketAddress::IsMatchingType (from))
         {
@@ -33,8 +33,11 @@
 #include "ns3/address.h"
 #include "ns3/traced-callback.h"
 #include <unordered_map>
+#include <vector>
 //#include "ns3/ndnSIM-module.h"
 #include "ns3/incSIM-module.h"
+#include "ns3/orchestration-message-codec.hpp"
+#include "ns3/status-push-trigger.hpp"
 
 
 namespace ns3 {
@@ -81,16 +84,23 @@ private:
    */
   void HandleRead (Ptr<ns3::Socket> socket);
 
+  virtual Ptr<Packet>
+  OrchestrationRequestResolution(uint32_t type, const uint8_t *value, size_t valueLen);
+
   virtual Ptr<Packet>
   OrchestrationRequestResolution(std::string packet_data);
 
 
   virtual Ptr<Packet>
-  StatusFetchHandler(std::string packet_data);
+  StatusFetchHandler(uint32_t type);
 
 
   Ptr<Packet>
-  FunctionSwitchHandler(std::string packet_data);
+  FunctionSwitchHandler(const OrchestrationFunctionSwitch &command);
+
+  //applies all changes of one orchestration interval, disables first, answers with a single ack
+  Ptr<Packet>
+  NodeCommandHandler(const OrchestrationNodeCommand &command);
 
 
   virtual Ptr<Packet>
@@ -100,6 +110,22 @@ private:
   virtual Ptr<Packet>
   UnknownPacketHandler(std::string packet_data);
 
+  /**
+   * \brief Push the node status to the orchestrator, called by the push trigger.
+   *
+   * The status goes to the address the last orchestration request came from,
+   * nothing is pushed before the orchestrator has contacted the node.
+   */
+  void SendStatusNotification (std::string reason);
+
+  /**
+   * \brief Encode a message into the transmit buffer and wrap it into a packet.
+   *
+   * The buffer is grown once if the message does not fit, so that no block is allocated per response.
+   */
+  Ptr<Packet> StatusPacket (uint32_t type);
+  Ptr<Packet> AckPacket (bool success, uint32_t seq);
+
   typedef void ( *EnableFunctionCallback)(std::string);
   typedef void ( *DisableFunctionCallback)(std::string);
 
@@ -121,6 +147,14 @@ private:
   TracedCallback<std::string> m_onFuncEnableTrace;
   TracedCallback<std::string> m_onFuncDisableTrace;
 
+  bool m_push; //!< push status when a load threshold is crossed
+  Ptr<StatusPushTrigger> m_push_trigger;
+  Ptr<ns3::Socket> m_orchestrator_socket; //!< socket the last orchestration request came in on
+  ns3::Address m_orchestrator; //!< address of the last orchestration request
+
+  static const size_t DEFAULT_BUFFER_SIZE = 1500; //!< one Ethernet MTU, grown on demand
+  std::vector<uint8_t> m_rx_buffer; //!< receive buffer reused for every packet
+  std::vector<uint8_t> m_tx_buffer; //!< transmit buffer reused for every response
 
 };
 }//namespace inc
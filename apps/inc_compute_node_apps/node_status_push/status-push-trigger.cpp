@@ -0,0 +1,193 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "status-push-trigger.hpp"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.StatusPushTrigger");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(StatusPushTrigger);
+
+    TypeId
+    StatusPushTrigger::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::StatusPushTrigger")
+              .SetParent<Object>()
+              .AddConstructor<StatusPushTrigger>()
+              .AddAttribute("QueueHighThreshold", "Queue fill (fraction of queue size) at which the node reports overload",
+                            DoubleValue(0.8), MakeDoubleAccessor(&StatusPushTrigger::m_queueHigh),
+                            MakeDoubleChecker<double>(0.0, 1.0))
+              .AddAttribute("QueueLowThreshold", "Queue fill (fraction of queue size) at which an overloaded node reports recovery",
+                            DoubleValue(0.4), MakeDoubleAccessor(&StatusPushTrigger::m_queueLow),
+                            MakeDoubleChecker<double>(0.0, 1.0))
+              .AddAttribute("BusyCounterThreshold", "Node busy counter at which the node reports, 0 to disable",
+                            UintegerValue(0), MakeUintegerAccessor(&StatusPushTrigger::m_busyThreshold),
+                            MakeUintegerChecker<uint32_t>())
+              .AddAttribute("MissCounterThreshold", "Missed executions since the last push at which the node reports, 0 to disable",
+                            UintegerValue(0), MakeUintegerAccessor(&StatusPushTrigger::m_missThreshold),
+                            MakeUintegerChecker<uint32_t>())
+              .AddAttribute("MinPushInterval", "Minimum time between two pushes, closer pushes are coalesced",
+                            TimeValue(MilliSeconds(500)), MakeTimeAccessor(&StatusPushTrigger::m_minInterval),
+                            MakeTimeChecker())
+              .AddTraceSource("StatusPush", "Trace called every time a status push is sent",
+                            MakeTraceSourceAccessor(&StatusPushTrigger::m_pushTrace),
+                            "ns3::ndn::inc::StatusPushTrigger::StatusPushCallback")
+              .AddTraceSource("StatusPushCoalesced", "Trace called every time a push is held back by the rate limit",
+                            MakeTraceSourceAccessor(&StatusPushTrigger::m_coalescedTrace),
+                            "ns3::ndn::inc::StatusPushTrigger::StatusPushCallback");
+      return tid;
+    }
+
+    StatusPushTrigger::StatusPushTrigger()
+      : m_overloaded(false)
+      , m_busy(false)
+      , m_missesSincePush(0)
+      , m_pushed(false)
+    {
+      NS_LOG_FUNCTION_NOARGS();
+    }
+
+    StatusPushTrigger::~StatusPushTrigger() {}
+
+    void
+    StatusPushTrigger::Start(Ptr<IncOrchestrationComputeNode> node, Callback<void, std::string> send)
+    {
+      NS_ASSERT_MSG(node != 0, "StatusPushTrigger needs a compute node");
+      NS_ASSERT_MSG(m_queueLow <= m_queueHigh, "QueueLowThreshold must not be above QueueHighThreshold");
+      m_compute_node = node;
+      m_send = send;
+      m_missesSincePush = 0;
+      m_compute_node->TraceConnectWithoutContext("LoadChanged", MakeCallback(&StatusPushTrigger::OnLoadChanged, this));
+      m_compute_node->TraceConnectWithoutContext("MissedExecution", MakeCallback(&StatusPushTrigger::OnMissedExecution, this));
+    }
+
+    void
+    StatusPushTrigger::Stop()
+    {
+      if(m_compute_node != 0)
+      {
+        m_compute_node->TraceDisconnectWithoutContext("LoadChanged", MakeCallback(&StatusPushTrigger::OnLoadChanged, this));
+        m_compute_node->TraceDisconnectWithoutContext("MissedExecution", MakeCallback(&StatusPushTrigger::OnMissedExecution, this));
+      }
+      Simulator::Cancel(m_deferredEvent);
+    }
+
+    void
+    StatusPushTrigger::OnLoadChanged(uint32_t queueFill, uint32_t nodeBusyCounter)
+    {
+      uint32_t queueSize = m_compute_node->GetQueueSize();
+      if(queueSize > 0 && m_queueHigh > 0)
+      {
+        double fill = static_cast<double>(queueFill) / queueSize;
+        if(!m_overloaded && fill >= m_queueHigh)
+        {
+          m_overloaded = true;
+          Fire("Overload");
+        }
+        else if(m_overloaded && fill <= m_queueLow)
+        {
+          m_overloaded = false;
+          Fire("Recovered");
+        }
+      }
+
+      if(m_busyThreshold > 0)
+      {
+        //the busy counter is reset by every status fetch, which re-arms the trigger
+        if(!m_busy && nodeBusyCounter >= m_busyThreshold)
+        {
+          m_busy = true;
+          Fire("Busy");
+        }
+        else if(m_busy && nodeBusyCounter < m_busyThreshold)
+        {
+          m_busy = false;
+        }
+      }
+    }
+
+    void
+    StatusPushTrigger::OnMissedExecution(std::string funcName)
+    {
+      if(m_missThreshold == 0)
+        return;
+      //misses only reach the node on the forward path, which never changes the load
+      m_missesSincePush++;
+      NS_LOG_DEBUG("Node " << m_compute_node->GetName() << " missed " << funcName << ", "
+                   << m_missesSincePush << " misses since the last push");
+      if(m_missesSincePush >= m_missThreshold)
+        Fire("Miss");
+    }
+
+    void
+    StatusPushTrigger::Fire(std::string reason)
+    {
+      Time now = Simulator::Now();
+      if(!m_pushed || (now - m_lastPush) >= m_minInterval)
+      {
+        Send(reason);
+        return;
+      }
+      //rate limited, one deferred push carries the state at the end of the gap
+      NS_LOG_DEBUG("Coalescing push " << reason << " of node " << m_compute_node->GetName());
+      m_coalescedTrace(reason);
+      m_deferredReason = reason;
+      if(!m_deferredEvent.IsRunning())
+      {
+        m_deferredEvent = Simulator::Schedule(m_lastPush + m_minInterval - now, &StatusPushTrigger::SendDeferred, this);
+      }
+    }
+
+    void
+    StatusPushTrigger::SendDeferred()
+    {
+      Send(m_deferredReason);
+    }
+
+    void
+    StatusPushTrigger::Send(std::string reason)
+    {
+      NS_LOG_INFO("Node " << m_compute_node->GetName() << " pushes status, reason " << reason
+                  << " at time " << Simulator::Now().GetSeconds());
+      m_lastPush = Simulator::Now();
+      m_pushed = true;
+      m_missesSincePush = 0;
+      Simulator::Cancel(m_deferredEvent);
+      m_pushTrace(reason);
+      if(!m_send.IsNull())
+        m_send(reason);
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
@@ -0,0 +1,110 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef STATUS_PUSH_TRIGGER_H_
+#define STATUS_PUSH_TRIGGER_H_
+
+#include "ns3/object.h"
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+#include "ns3/inc-orchestration-compute-node.h"
+#include <string>
+
+/*
+Decides when a compute node pushes its status to the orchestrator, on top of the periodic status fetch.
+The trigger listens to the LoadChanged and MissedExecution traces of the compute node and fires on:
+  Overload  - queue fill reaches QueueHighThreshold (fraction of the queue size)
+  Recovered - queue fill drops back to QueueLowThreshold after an Overload
+  Busy      - node busy counter reaches BusyCounterThreshold, re-armed once the counter is reset by a status fetch
+  Miss      - MissCounterThreshold executions were missed, over all functions, since the last push
+The gap between the two thresholds is the hysteresis, a queue oscillating around one value does not cause a push storm.
+Pushes closer than MinPushInterval are coalesced into one deferred push carrying the latest state.
+A threshold of 0 disables the corresponding trigger.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    class StatusPushTrigger : public Object
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      StatusPushTrigger();
+      ~StatusPushTrigger();
+
+      //starts watching node, send is called with the trigger reason whenever a push is due
+      void
+      Start(Ptr<IncOrchestrationComputeNode> node, Callback<void, std::string> send);
+
+      void
+      Stop();
+
+      typedef void ( *StatusPushCallback)(std::string reason);
+
+    private:
+      void
+      OnLoadChanged(uint32_t queueFill, uint32_t nodeBusyCounter);
+
+      void
+      OnMissedExecution(std::string funcName);
+
+      void
+      Fire(std::string reason);
+
+      void
+      SendDeferred();
+
+      void
+      Send(std::string reason);
+
+    private:
+      double m_queueHigh;
+      double m_queueLow;
+      uint32_t m_busyThreshold;
+      uint32_t m_missThreshold;
+      Time m_minInterval;
+
+      Ptr<IncOrchestrationComputeNode> m_compute_node;
+      Callback<void, std::string> m_send;
+      bool m_overloaded;
+      bool m_busy;
+      uint32_t m_missesSincePush;
+      Time m_lastPush;
+      bool m_pushed;
+      EventId m_deferredEvent;
+      std::string m_deferredReason;
+
+      TracedCallback<std::string> m_pushTrace;
+      TracedCallback<std::string> m_coalescedTrace;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
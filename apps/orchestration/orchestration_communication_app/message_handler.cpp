@@ -29,8 +29,8 @@
 #include "ns3/node-info-storage.hpp"
 #include "ns3/string.h"
 #include "ns3/incSIM-module.h"
+#include "ns3/orchestration-message-codec.hpp"
 #include <vector>
-#include <boost/algorithm/string.hpp>
 
 
 NS_LOG_COMPONENT_DEFINE ("OrchestrationMessageHandler");
@@ -60,232 +60,108 @@ namespace inc{
 	}
 
 	void
-	OrchestrationMessageHandler::HandleMessage(std::string actionToDo, std::string content)
+	OrchestrationMessageHandler::SetStorage(Ptr<OrchestratorNodeInfoStorage> storage)
 	{
-		if(actionToDo.compare("/BootstrapInfo")==0)
+		m_storage_handler = storage;
+	}
+
+	void
+	OrchestrationMessageHandler::SetCommandTracker(Ptr<OrchestrationCommandTracker> tracker)
+	{
+		m_command_tracker = tracker;
+	}
+
+	void
+	OrchestrationMessageHandler::HandleMessage(const uint8_t* buf, size_t len)
+	{
+		uint32_t type;
+		std::string nodeName;
+		HandleMessage(buf, len, type, nodeName);
+	}
+
+	bool
+	OrchestrationMessageHandler::HandleMessage(const uint8_t* buf, size_t len, uint32_t& type, std::string& nodeName)
+	{
+		const uint8_t* value;
+		size_t valueLen;
+		nodeName.clear();
+		if(!OrchestrationMessageCodec::ReadMessage(buf, len, type, value, valueLen))
+		{
+			NS_LOG_WARN("Dropping message that is not an orchestration message");
+			return false;
+		}
+		if(type == orchestration_tlv::BootstrapInfo)
 		{
-			BootstrapPhaseHandler(content);
+			nodeName = BootstrapPhaseHandler(value, valueLen);
 		}
-		else if (actionToDo.compare("/NodeStatusFetch")==0)
+		else if ((type == orchestration_tlv::NodeStatusFetch) || (type == orchestration_tlv::StatusNotification))
 		{
-			NodeStatusFetchHandler(content);
+			//a pushed status is stored the same way as a polled one
+			nodeName = NodeStatusFetchHandler(value, valueLen);
+			if(type == orchestration_tlv::StatusNotification)
+				NS_LOG_INFO("Status notification from node " << nodeName << " at time " << Simulator::Now().GetSeconds());
+		}
+		else if (type == orchestration_tlv::Ack)
+		{
+			OrchestrationAck ack;
+			if(OrchestrationMessageCodec::DecodeAck(value, valueLen, ack))
+			{
+				NS_LOG_INFO("Command " << ack.seq << " at node " << ack.nodeName << (ack.success ? " succeeded" : " failed"));
+				nodeName = ack.nodeName;
+				if(ack.seq != 0 && m_command_tracker != 0)
+					m_command_tracker->OnAck(ack);
+			}
 		}
 		else
 		{
 			//do nothing
 		}
+		return !nodeName.empty();
 	}
 
-	void
-	OrchestrationMessageHandler::BootstrapPhaseHandler(std::string content)
+	std::string
+	OrchestrationMessageHandler::BootstrapPhaseHandler(const uint8_t* value, size_t valueLen)
 	{
+		NS_ASSERT_MSG(m_storage_handler != 0, "OrchestrationMessageHandler used without a storage");
 		OrchestratorNodeInfoStorage::computeNode newNode;
-		std::vector<std::string> tokens;
-		boost::split(tokens, content, boost::is_any_of(";"));
-			//----------------Parsing the content-------------------//
-			for(uint32_t i=0; i< tokens.size();i++)
-			{
-				std::vector<std::string> values;
-				boost::split(values,tokens[i],boost::is_any_of("="));
-					if((values[0]).compare("name")==0)
-					{
-						newNode.nodeName = Name(values[1]);
-					}
-					else if((values[0]).compare("processor_core")==0)
-					{
-						(newNode.cpu).first = std::stoi(values[1]);
-						(newNode.cpu).second = std::stoi(values[1]);
-					}
-					else if((values[0]).compare("RAM")==0)
-					{
-						(newNode.ram).first = std::stoi(values[1]);
-						(newNode.ram).second = std::stoi(values[1]);
-					}
-					else if((values[0]).compare("ROM")==0)
-					{
-						(newNode.rom).first = std::stoi(values[1]);
-						(newNode.rom).second = std::stoi(values[1]);
-					}
-					else if((values[0]).compare("links")==0)
-					{
-						std::vector<std::string> links;
-						boost::split(links, values[1], boost::is_any_of(","));
-						(newNode.links).first = links;
-						(newNode.links).second = links;
-					}
-					else if((values[0]).compare("runtimes")==0)
-					{
-						std::vector<std::string> runtimes;
-						boost::split(runtimes, values[1], boost::is_any_of(","));
-						(newNode.runtimes_supported).first = runtimes;
-						(newNode.runtimes_supported).second = runtimes;
-					}
-					else if((values[0]).compare("node_busy_counter")==0)
-					{
-						(newNode.nodeBusyCounter).first = 0;
-						(newNode.nodeBusyCounter).second = 0;
-					}
-					else if((values[0]).compare("data")==0)
-					{
-						std::vector<std::string> data_list;
-						if(!(values[1].compare("null")==0))
-						{
-							boost::split(data_list,values[1], boost::is_any_of(","));
-							for(auto iter = data_list.begin(); iter != data_list.end(); iter++)
-							{
-								std::vector<std::string>data_each;
-								boost::split(data_each, *iter, boost::is_any_of(":"));
-								OrchestratorNodeInfoStorage::dataInfo new_data;
-								new_data.dataName = data_each.at(0);
-								new_data.size_bytes = std::stoi(data_each.at(1));
-								newNode.data_initial.push_back(new_data);
-								newNode.data_current.push_back(new_data);
-							}
-						}
-						else
-						{
-							//do nothing
-						}
-					}
-					else if((values[0]).compare("functions")==0)
-					{
-						std::vector<std::string> functions_all;
-						boost::split(functions_all, values[1], boost::is_any_of("/")); //splitting list of functions to individual functions
-						auto iter=functions_all.begin();
-						for (std::advance(iter, 1); iter != functions_all.end(); iter++)
-							{
-								OrchestratorNodeInfoStorage::functionInfo func;
-								std::vector<std::string> functions_each;
-								boost::split(functions_each, *iter, boost::is_any_of(":")); //spliting individual functions to name and status
-								functions_each[0].insert(0,1,'/');
-								func.funcName = functions_each[0];
-								func.status = (functions_each[1]=="1")?true:false;
-								func.func_exe_counter = std::stoi(functions_each[2]);
-								func.func_interest_counter = std::stoi(functions_each[3]);
-								func.cores = std::stoi(functions_each[4]);
-								func.ram = std::stoi(functions_each[5]);
-								func.rom = std::stoi(functions_each[6]);
-								func.size_bytes = std::stoi(functions_each[7]);
-								std::vector<std::string> inputs;
-								if(!(functions_each[8].compare("null")==0))
-								{
-									boost::split(inputs, functions_each[8], boost::is_any_of(","));
-									for(auto it = inputs.begin(); it!= inputs.end(); it++)
-										func.input_data_list.push_back(*it);
-								}
-								newNode.functions_initial.push_back(func);
-								newNode.functions_current.push_back(func);
-							}
-					}
-			}
-
-				std::string UUID = newNode.nodeName.toUri();
-				m_storage_handler.AddNodeToTable(UUID, newNode);
-				//m_storage_handler.printDefaultNodeInfo(UUID);
+		if(!OrchestrationMessageCodec::DecodeNodeStatus(value, valueLen, newNode))
+		{
+			NS_LOG_WARN("Malformed bootstrap message, node not added");
+			return "";
+		}
+		//the bootstrap state is both the default and the current state of the node
+		newNode.cpu.first = newNode.cpu.second;
+		newNode.ram.first = newNode.ram.second;
+		newNode.rom.first = newNode.rom.second;
+		newNode.nodeBusyCounter.first = 0;
+		newNode.nodeBusyCounter.second = 0;
+		newNode.links.first = newNode.links.second;
+		newNode.runtimes_supported.first = newNode.runtimes_supported.second;
+		newNode.data_initial = newNode.data_current;
+		newNode.functions_initial = newNode.functions_current;
+
+		std::string UUID = newNode.nodeName.toUri();
+		m_storage_handler->AddNodeToTable(UUID, newNode);
+		//m_storage_handler->printDefaultNodeInfo(UUID);
+		return UUID;
 	}
 
-	void
-	OrchestrationMessageHandler::NodeStatusFetchHandler(std::string content)
+	std::string
+	OrchestrationMessageHandler::NodeStatusFetchHandler(const uint8_t* value, size_t valueLen)
 	{
-		std::string UUID;
-		std::vector<std::string> tokens;
-			boost::split(tokens, content, boost::is_any_of(";"));
-			//----------------Parsing the content-------------------//
-			for(uint32_t i=0; i< tokens.size();i++)
-			{
-				std::vector<std::string> values;
-				boost::split(values,tokens[i],boost::is_any_of("="));
-					if((values[0]).compare("name")==0)
-					{
-						UUID = values[1];
-					}
-					else if((values[0]).compare("processor_core")==0)
-					{
-						m_storage_handler.setNodeCPU(UUID,std::stoi(values[1]),false);
-					}
-					else if((values[0]).compare("RAM")==0)
-					{
-						m_storage_handler.setNodeRAM(UUID, std::stoi(values[1]), false);
-					}
-					else if((values[0]).compare("ROM")==0)
-					{
-						m_storage_handler.setNodeROM(UUID, std::stoi(values[1]), false);
-					}
-					else if((values[0]).compare("links")==0)
-					{
-						std::vector<std::string> links;
-						boost::split(links, values[1], boost::is_any_of(","));
-						m_storage_handler.setNodeLinks(UUID, links, false);
-					}
-					else if((values[0]).compare("runtimes")==0)
-					{
-						std::vector<std::string> runtimes;
-						boost::split(runtimes, values[1], boost::is_any_of(","));
-						m_storage_handler.setNodeRuntimes(UUID, runtimes, false);
-					}
-					else if((values[0]).compare("node_busy_counter")==0)
-					{
-						m_storage_handler.setNodeBusyCounter(UUID, std::stoi(values[1]),false);
-					}
-					else if ((values[0].compare("data")==0))
-					{
-						if(values[1].compare("null")==0)
-						{
-							//do nothing
-						}
-						else
-						{
-							std::vector<OrchestratorNodeInfoStorage::dataInfo> data_list;
-							std::vector<std::string> data;
-							boost::split(data, values[1], boost::is_any_of(","));
-							for(auto iter = data.begin(); iter != data.end(); iter++)
-							{
-								std::vector<std::string> each_data;
-								boost::split(each_data, *iter, boost::is_any_of(":"));
-								OrchestratorNodeInfoStorage::dataInfo new_data;
-								new_data.dataName = each_data.at(0);
-								new_data.size_bytes = std::stoi(each_data.at(1));
-								data_list.push_back(new_data);
-							}
-							m_storage_handler.setNodeDataList(UUID,data_list, false);
-						}
-					}
-					else if((values[0]).compare("functions")==0)
-					{
-						std::vector<std::string> functions_all;
-						boost::split(functions_all, values[1], boost::is_any_of("/")); //splitting list of functions to individual functions
-						auto iter=functions_all.begin();
-						for (std::advance(iter, 1); iter != functions_all.end(); iter++)
-							{
-								OrchestratorNodeInfoStorage::functionInfo func;
-								std::vector<std::string> functions_each;
-								boost::split(functions_each, *iter, boost::is_any_of(":")); //spliting individual functions to name and status
-								functions_each[0].insert(0,1,'/');
-								std::pair<bool,uint32_t> index = m_storage_handler.getFuncIndex(UUID,functions_each[0],false);
-								if(index.first==true)
-								{
-									m_storage_handler.setFuncName(UUID,index.second, functions_each[0], false);
-									bool status = (functions_each[1]=="1")?true:false;
-									m_storage_handler.setFuncStatus(UUID,index.second,status,false);
-									m_storage_handler.setFuncExeCounter(UUID, index.second, std::stoi(functions_each[2]), false);
-									m_storage_handler.setFuncInterestCounter(UUID, index.second, std::stoi(functions_each[3]), false);
-									m_storage_handler.setFuncCpu(UUID, index.second, std::stoi(functions_each[4]),false);
-									m_storage_handler.setFuncRam(UUID, index.second, std::stoi(functions_each[5]),false);
-									m_storage_handler.setFuncRom(UUID, index.second, std::stoi(functions_each[6]), false);
-									m_storage_handler.setFuncSize(UUID, index.second, std::stoi(functions_each[7]), false);
-									std::vector<std::string> inputs;
-									boost::split(inputs, functions_each[8], boost::is_any_of(","));
-									m_storage_handler.setFuncInputs(UUID, index.second, inputs, false);
-								}
-							}
-					}
-
-			}
-		//m_storage_handler.printCurrentNodeInfo(UUID);
-
+		NS_ASSERT_MSG(m_storage_handler != 0, "OrchestrationMessageHandler used without a storage");
+		OrchestratorNodeInfoStorage::computeNode status;
+		if(!OrchestrationMessageCodec::DecodeNodeStatus(value, valueLen, status))
+		{
+			NS_LOG_WARN("Malformed node status message, storage not updated");
+			return "";
+		}
+		std::string UUID = status.nodeName.toUri();
+		m_storage_handler->updateNodeStatus(UUID, status);
+		//m_storage_handler->printCurrentNodeInfo(UUID);
+		return UUID;
 	}
 
-
 }
 }
 }
@@ -28,6 +28,7 @@
 #include "ns3/core-module.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/node-info-storage.hpp"
+#include "ns3/orchestration-command-tracker.hpp"
 #include "ndn-cxx/name.hpp"
 
 namespace ns3{
@@ -44,22 +45,42 @@ namespace inc{
 		 OrchestrationMessageHandler();
 		 ~OrchestrationMessageHandler();
 		 static TypeId GetTypeId (void);
+
+		 //storage of the orchestrator the messages are about, see OrchestratorNodeInfoStorage::GetStorage
+		 void
+		 SetStorage(Ptr<OrchestratorNodeInfoStorage> storage);
+
+		 //tracker that acks of node commands are matched against, optional
+		 void
+		 SetCommandTracker(Ptr<OrchestrationCommandTracker> tracker);
+
 		 /**
 		 * A message handler function that takes packet content from compute
 		 * nodes as input and output the operational command orchestrators should reply.
+		 * The content is a TLV message as defined by OrchestrationMessageCodec,
+		 * the message type selects the handler.
 		 **/
 
 		 void
-		 HandleMessage(std::string Msgname, std::string content);
+		 HandleMessage(const uint8_t* buf, size_t len);
 
-		 void
-		 BootstrapPhaseHandler(std::string content);
+		 /**
+		 * Same as above, additionally reports the type of the handled message and
+		 * the node it was about. Returns false if the message was dropped.
+		 **/
+		 bool
+		 HandleMessage(const uint8_t* buf, size_t len, uint32_t& type, std::string& nodeName);
 
-		 void
-		 NodeStatusFetchHandler(std::string content);
+		 //both return the name of the updated node, empty if the message was malformed
+		 std::string
+		 BootstrapPhaseHandler(const uint8_t* value, size_t valueLen);
+
+		 std::string
+		 NodeStatusFetchHandler(const uint8_t* value, size_t valueLen);
 
 		 private:
-			OrchestratorNodeInfoStorage m_storage_handler;
+			Ptr<OrchestratorNodeInfoStorage> m_storage_handler;
+			Ptr<OrchestrationCommandTracker> m_command_tracker;
 
     };
   }//namespace inc
@@ -27,6 +27,7 @@
 
 #include "ns3/boolean.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 #include "ns3/ptr.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -35,6 +36,7 @@
 #include "ns3/incSIM-module.h"
 #include "ns3/node-info-storage.hpp"
 #include "ns3/orchestration-management-app.hpp"
+#include "ns3/orchestration-message-codec.hpp"
 
 #include "ns3/random-variable-stream.h"
 
@@ -60,6 +62,19 @@ namespace inc{
                          MakeTimeChecker ())
               .AddAttribute("Periodic", "Periodic interests?", BooleanValue(false),
                       MakeBooleanAccessor(&NdnOrchestrationCommunicationApp::m_periodic), MakeBooleanChecker())
+              .AddAttribute("AcceptPush", "Accept status notifications pushed by the node this app polls",
+                      BooleanValue(false),
+                      MakeBooleanAccessor(&NdnOrchestrationCommunicationApp::m_accept_push), MakeBooleanChecker())
+              .AddAttribute("NotificationPrefix", "Prefix of the status notification interests sent by the nodes",
+                      StringValue("/Orchestrator/Notify"),
+                      MakeNameAccessor(&NdnOrchestrationCommunicationApp::m_notificationPrefix), MakeNameChecker())
+              .AddAttribute("CommandTimeout", "Time to wait for the ack of a node command before it is retransmitted",
+                      TimeValue(MilliSeconds(500)),
+                      MakeTimeAccessor(&NdnOrchestrationCommunicationApp::m_command_timeout), MakeTimeChecker())
+              .AddAttribute("CommandRetries", "Retransmissions of a node command before it is reported as lost",
+                      UintegerValue(3),
+                      MakeUintegerAccessor(&NdnOrchestrationCommunicationApp::m_command_retries),
+                      MakeUintegerChecker<uint32_t>())
               .AddTraceSource("SendOrchInterests", "Trace called every time there is an Interest packet is send to the network",
                       MakeTraceSourceAccessor(&NdnOrchestrationCommunicationApp::m_OrchestrationInterestTrace),
                       "ns3::ndn::inc::NdnOrchestrationCommunicationApp::SendsOrchestrstionInterestTracedCallback")
@@ -68,7 +83,13 @@ namespace inc{
                       "ns3::ndn::inc::NdnOrchestrationCommunicationApp::IncomingDatasCallback")
               .AddTraceSource("SendOrchDecisions", "Trace called every time there is an outgoing decision",
                       MakeTraceSourceAccessor(&NdnOrchestrationCommunicationApp::m_OrchestrationDecisionTrace),
-                      "ns3::ndn::inc::NdnOrchestrationCommunicationApp::SendsOrchestrationDecisionTracedCallback");
+                      "ns3::ndn::inc::NdnOrchestrationCommunicationApp::SendsOrchestrationDecisionTracedCallback")
+              .AddTraceSource("StatusNotification", "Trace called every time a node pushed its status",
+                      MakeTraceSourceAccessor(&NdnOrchestrationCommunicationApp::m_onStatusNotificationTrace),
+                      "ns3::ndn::inc::NdnOrchestrationCommunicationApp::StatusNotificationCallback")
+              .AddTraceSource("CommandDelivery", "Trace called every time a node command is acked, failed or lost",
+                      MakeTraceSourceAccessor(&NdnOrchestrationCommunicationApp::m_commandDeliveryTrace),
+                      "ns3::ndn::inc::NdnOrchestrationCommunicationApp::CommandDeliveryCallback");
       return tid;
     }
 
@@ -86,6 +107,22 @@ namespace inc{
       // initialize ndn::App
       ndn::App::StartApplication();
       NS_LOG_FUNCTION_NOARGS();
+      m_message_handler.SetStorage(OrchestratorNodeInfoStorage::GetStorage(GetNode()));
+      m_command_tracker = CreateObject<OrchestrationCommandTracker>();
+      m_command_tracker->SetAttribute("Timeout", TimeValue(m_command_timeout));
+      m_command_tracker->SetAttribute("MaxRetries", UintegerValue(m_command_retries));
+      m_command_tracker->SetSendCallback(MakeCallback(&NdnOrchestrationCommunicationApp::TransmitNodeCommand, this));
+      m_command_tracker->TraceConnectWithoutContext("CommandDelivery",
+          MakeCallback(&TracedCallback<std::string, uint32_t, Time, uint32_t, OrchestrationCommandTracker::DeliveryStatus>::operator(),
+                       &m_commandDeliveryTrace));
+      m_message_handler.SetCommandTracker(m_command_tracker);
+      if (m_accept_push)
+      {
+        //interest name is /Orchestrator/<node>/NodeStatusFetch, notifications of that node come in under <NotificationPrefix>/<node>
+        Name notification = m_notificationPrefix;
+        notification.append(Consumer::m_interestName.get(1));
+        FibHelper::AddRoute(GetNode(), notification, m_face, 0);
+      }
       // Schedule send of first interest
       if (m_periodic==false)
       {
@@ -102,6 +139,8 @@ namespace inc{
     void
     NdnOrchestrationCommunicationApp::StopApplication()
     {
+      if (m_command_tracker != 0)
+        m_command_tracker->Clear();
       // cleanup ndn::App
       ndn::App::StopApplication();
     }
@@ -136,6 +175,40 @@ namespace inc{
       this->m_OrchestrationDecisionTrace(interest);
     }
 
+    void
+    NdnOrchestrationCommunicationApp::SendNodeCommand(const OrchestrationNodeCommand& command)
+    {
+      if (m_command_tracker == 0)
+      {
+        NS_LOG_WARN("[Orchestrator Communication App] not started, dropping command for " << command.nodeName);
+        return;
+      }
+      m_command_tracker->Send(command);
+    }
+
+    Ptr<OrchestrationCommandTracker>
+    NdnOrchestrationCommunicationApp::GetCommandTracker() const
+    {
+      return m_command_tracker;
+    }
+
+    void
+    NdnOrchestrationCommunicationApp::TransmitNodeCommand(const OrchestrationNodeCommand& command)
+    {
+      if (!m_active)
+        return;
+      Name interest_prefix("/Orchestrator");
+      interest_prefix.append(Name(command.nodeName)).append("NodeCommand");
+      shared_ptr<Interest> interest = make_shared<Interest>(interest_prefix);
+      interest->setCanBePrefix(false);
+      interest->setMustBeFresh(true);
+      interest->setApplicationParameters(OrchestrationMessageCodec::EncodeNodeCommand(command));
+      NS_LOG_INFO("[Orchestrator Communication App] Sending node command: " << *interest);
+      m_transmittedInterests(interest, this, m_face);
+      m_appLink->onReceiveInterest(*interest);
+      this->m_OrchestrationDecisionTrace(interest);
+    }
+
     void
     NdnOrchestrationCommunicationApp::SendInterest()
     {
@@ -176,32 +249,41 @@ namespace inc{
     void
     NdnOrchestrationCommunicationApp::OnData(std::shared_ptr<const ndn::Data> data)
     {
-      std::string actionToDo;
-      std::string dataName = (data->getName()).toUri();
       this->m_onOrchestrationDataTrace(data);
-      const char *buffer = (char*) data->getContent().value();
-      std::string stringBuffer(buffer);
-      std::string content = stringBuffer.substr(0, data->getContent().value_size());
-      if(Name(dataName).getSubName(0,1)== "/Orchestrator")
-      {
-        if(Name(dataName).getSubName(2,1) == "/BootstrapInfo")
-        {
-          actionToDo = "/BootstrapInfo";
-        }
-        else if(Name(dataName).getSubName(2,1) == "/NodeStatusFetch")
-        {
-          actionToDo = "/NodeStatusFetch";
-        }
-        else
-        {
-          actionToDo  = "/Others";
-        }
-      }
-      else
+      //the content carries one orchestration TLV message, the message type tells what to do with it
+      const ::ndn::Block& content = data->getContent();
+      m_message_handler.HandleMessage(content.value(), content.value_size());
+    }
+
+    void
+    NdnOrchestrationCommunicationApp::OnInterest(std::shared_ptr<const ndn::Interest> interest)
+    {
+      ndn::App::OnInterest(interest); // tracing inside
+      if (!m_active || !m_accept_push || !interest->hasApplicationParameters())
+        return;
+      //the application parameters carry one StatusNotification TLV message
+      const ::ndn::Block& parameters = interest->getApplicationParameters();
+      uint32_t type;
+      std::string nodeName;
+      bool handled = m_message_handler.HandleMessage(parameters.value(), parameters.value_size(), type, nodeName)
+                     && (type == orchestration_tlv::StatusNotification);
+      if (handled)
       {
-        actionToDo = "/Others";
+        this->m_onStatusNotificationTrace(nodeName);
       }
-      m_message_handler.HandleMessage(actionToDo, content);
+
+      auto data = make_shared<Data>();
+      data->setName(interest->getName());
+      data->setContent(OrchestrationMessageCodec::EncodeAck(nodeName, handled));
+      data->setFreshnessPeriod(::ndn::time::milliseconds(1));
+      Signature signature;
+      SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
+      signature.setInfo(signatureInfo);
+      signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+      data->setSignature(signature);
+      data->wireEncode();
+      m_transmittedDatas(data, this, m_face);
+      m_appLink->onReceiveData(*data);
     }
 
     }//namespace inc
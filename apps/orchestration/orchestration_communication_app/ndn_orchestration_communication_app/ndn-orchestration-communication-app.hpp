@@ -58,9 +58,21 @@ namespace inc{
       virtual void
       OnData(std::shared_ptr<const ndn::Data> contentObject);
 
+      // (overridden from ndn::App) Callback that will be called when a status notification arrives
+      virtual void
+      OnInterest(std::shared_ptr<const ndn::Interest> interest);
+
       void
       SendOrchestrationRequest(std::string);
 
+      //sends all changes for one node as a single /Orchestrator/<node>/NodeCommand interest,
+      //retransmitted by the command tracker until the node acks it
+      void
+      SendNodeCommand(const OrchestrationNodeCommand& command);
+
+      Ptr<OrchestrationCommandTracker>
+      GetCommandTracker() const;
+
       void
       SendInterestPeriodic();
 
@@ -74,18 +86,33 @@ namespace inc{
       typedef void ( *SendsInterestTracedCallback)(shared_ptr<const Interest> interest);
       typedef void ( *SendsDecisionTracedCallback)(shared_ptr<const Interest> interest);
       typedef void ( *IncomingDatasCallback)(shared_ptr<const Data>);
+      typedef void ( *StatusNotificationCallback)(std::string nodeName);
+      typedef OrchestrationCommandTracker::CommandDeliveryCallback CommandDeliveryCallback;
 
 
       TracedCallback<shared_ptr<const Interest>> 	m_OrchestrationInterestTrace;   			///< @brief trace of incoming interests
       TracedCallback<shared_ptr<const Interest>> 	m_OrchestrationDecisionTrace;   			///< @brief trace of incoming interests
       TracedCallback<shared_ptr<const Data>> 		  m_onOrchestrationDataTrace;         		///< @brief trace of incoming data
+      TracedCallback<std::string>                 m_onStatusNotificationTrace;        ///< @brief trace of pushed node status
+      TracedCallback<std::string, uint32_t, Time, uint32_t, OrchestrationCommandTracker::DeliveryStatus>
+                                                  m_commandDeliveryTrace;             ///< @brief trace of acked, failed and lost commands
+
+    private:
+      //one transmission of a tracked command
+      void
+      TransmitNodeCommand(const OrchestrationNodeCommand& command);
 
     private:
       Time m_ExeTime;
       bool m_periodic;
       Time m_interval;
       bool m_first_time;
+      bool m_accept_push;
+      Name m_notificationPrefix;
       OrchestrationMessageHandler m_message_handler;
+      Ptr<OrchestrationCommandTracker> m_command_tracker;
+      Time m_command_timeout;
+      uint32_t m_command_retries;
     };
 }//namespace inc
 } // namespace ndn
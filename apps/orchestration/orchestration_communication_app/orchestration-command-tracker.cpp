@@ -0,0 +1,156 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "orchestration-command-tracker.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.OrchestrationCommandTracker");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(OrchestrationCommandTracker);
+
+    TypeId
+    OrchestrationCommandTracker::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::OrchestrationCommandTracker")
+              .SetParent<Object>()
+              .AddConstructor<OrchestrationCommandTracker>()
+              .AddAttribute("Timeout", "Time to wait for the ack of a command before it is retransmitted",
+                            TimeValue(MilliSeconds(500)), MakeTimeAccessor(&OrchestrationCommandTracker::m_timeout),
+                            MakeTimeChecker())
+              .AddAttribute("MaxRetries", "Retransmissions of a command before it is reported as lost",
+                            UintegerValue(3), MakeUintegerAccessor(&OrchestrationCommandTracker::m_maxRetries),
+                            MakeUintegerChecker<uint32_t>())
+              .AddTraceSource("CommandDelivery", "Trace called when a command is acked, failed or lost",
+                              MakeTraceSourceAccessor(&OrchestrationCommandTracker::m_commandDelivery),
+                              "ns3::ndn::inc::OrchestrationCommandTracker::CommandDeliveryCallback");
+      return tid;
+    }
+
+    OrchestrationCommandTracker::OrchestrationCommandTracker()
+      : m_seq(0)
+    {
+    }
+
+    OrchestrationCommandTracker::~OrchestrationCommandTracker() {}
+
+    void
+    OrchestrationCommandTracker::DoDispose()
+    {
+      Clear();
+      m_send.Nullify();
+      Object::DoDispose();
+    }
+
+    void
+    OrchestrationCommandTracker::SetSendCallback(Callback<void, const OrchestrationNodeCommand&> send)
+    {
+      m_send = send;
+    }
+
+    uint32_t
+    OrchestrationCommandTracker::Send(OrchestrationNodeCommand command)
+    {
+      NS_ASSERT_MSG(!m_send.IsNull(), "OrchestrationCommandTracker used without a send callback");
+      //0 marks an untracked command on the wire, skip it on wrap around
+      if(++m_seq == 0)
+        ++m_seq;
+      command.seq = m_seq;
+      PendingCommand& pending = m_pending[command.seq];
+      pending.command = command;
+      pending.firstSent = Simulator::Now();
+      pending.retries = 0;
+      pending.timeout = Simulator::Schedule(m_timeout, &OrchestrationCommandTracker::OnTimeout, this, command.seq);
+      NS_LOG_INFO("Sending command " << command.seq << " to node " << command.nodeName);
+      m_send(command);
+      return command.seq;
+    }
+
+    bool
+    OrchestrationCommandTracker::OnAck(const OrchestrationAck& ack)
+    {
+      auto it = m_pending.find(ack.seq);
+      if(ack.seq == 0 || it == m_pending.end())
+      {
+        NS_LOG_DEBUG("Ack " << ack.seq << " of node " << ack.nodeName << " matches no pending command");
+        return false;
+      }
+      //the storage names nodes /Node3, the nodes ack as Node3
+      if(Name(it->second.command.nodeName) != Name(ack.nodeName))
+      {
+        NS_LOG_WARN("Ack " << ack.seq << " from node " << ack.nodeName << ", command was sent to " << it->second.command.nodeName);
+        return false;
+      }
+      Simulator::Cancel(it->second.timeout);
+      Time latency = Simulator::Now() - it->second.firstSent;
+      NS_LOG_INFO("Command " << ack.seq << " at node " << ack.nodeName << (ack.success ? " acked" : " failed")
+                  << " after " << latency.GetMicroSeconds() << " us and " << it->second.retries << " retries");
+      m_commandDelivery(it->second.command.nodeName, ack.seq, latency, it->second.retries, ack.success ? Acked : Failed);
+      m_pending.erase(it);
+      return true;
+    }
+
+    void
+    OrchestrationCommandTracker::OnTimeout(uint32_t seq)
+    {
+      auto it = m_pending.find(seq);
+      if(it == m_pending.end())
+        return;
+      PendingCommand& pending = it->second;
+      if(pending.retries >= m_maxRetries)
+      {
+        NS_LOG_WARN("Command " << seq << " to node " << pending.command.nodeName << " lost after " << pending.retries << " retries");
+        m_commandDelivery(pending.command.nodeName, seq, Simulator::Now() - pending.firstSent, pending.retries, Lost);
+        m_pending.erase(it);
+        return;
+      }
+      pending.retries++;
+      pending.timeout = Simulator::Schedule(m_timeout, &OrchestrationCommandTracker::OnTimeout, this, seq);
+      NS_LOG_INFO("Retransmitting command " << seq << " to node " << pending.command.nodeName << ", retry " << pending.retries);
+      m_send(pending.command);
+    }
+
+    uint32_t
+    OrchestrationCommandTracker::GetPending() const
+    {
+      return m_pending.size();
+    }
+
+    void
+    OrchestrationCommandTracker::Clear()
+    {
+      for(auto& pending : m_pending)
+        Simulator::Cancel(pending.second.timeout);
+      m_pending.clear();
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
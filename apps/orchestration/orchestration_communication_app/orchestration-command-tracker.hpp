@@ -0,0 +1,111 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef ORCHESTRATION_COMMAND_TRACKER_H_
+#define ORCHESTRATION_COMMAND_TRACKER_H_
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+#include "ns3/traced-callback.h"
+#include "ns3/orchestration-message-codec.hpp"
+#include <map>
+#include <string>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    /**
+     * Delivery of orchestration node commands with ack tracking and retries, shared by the NDN and UDP
+     * communication apps. Every command gets a sequence number, is retransmitted with the same number
+     * until the matching Ack arrives or MaxRetries is exhausted, and the nodes apply a sequence number only once.
+     * The outcome of every command is reported by the CommandDelivery trace.
+     */
+    class OrchestrationCommandTracker : public Object
+    {
+    public:
+      enum DeliveryStatus {
+        Acked,      //node applied all changes
+        Failed,     //node answered, but could not apply all changes
+        Lost        //no answer after MaxRetries retransmissions
+      };
+
+      static TypeId
+      GetTypeId();
+
+      OrchestrationCommandTracker();
+      virtual ~OrchestrationCommandTracker();
+
+      //transmits one copy of a command, set by the communication app that owns the tracker
+      void
+      SetSendCallback(Callback<void, const OrchestrationNodeCommand&> send);
+
+      //assigns the next sequence number to command, sends it and arms the retransmission timer
+      uint32_t
+      Send(OrchestrationNodeCommand command);
+
+      //matches an Ack against the pending commands, false for unknown or duplicate acks
+      bool
+      OnAck(const OrchestrationAck& ack);
+
+      //commands that are neither acked nor given up yet
+      uint32_t
+      GetPending() const;
+
+      //cancels all timers, pending commands are not reported
+      void
+      Clear();
+
+      typedef void (*CommandDeliveryCallback)(std::string node, uint32_t seq, Time latency, uint32_t retries,
+                                              DeliveryStatus status);
+
+    protected:
+      virtual void
+      DoDispose();
+
+    private:
+      void
+      OnTimeout(uint32_t seq);
+
+      struct PendingCommand{
+        OrchestrationNodeCommand command;
+        Time firstSent;
+        uint32_t retries;
+        EventId timeout;
+      };
+
+      Time m_timeout;
+      uint32_t m_maxRetries;
+      uint32_t m_seq;
+      std::map<uint32_t, PendingCommand> m_pending;
+      Callback<void, const OrchestrationNodeCommand&> m_send;
+      TracedCallback<std::string, uint32_t, Time, uint32_t, DeliveryStatus> m_commandDelivery;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
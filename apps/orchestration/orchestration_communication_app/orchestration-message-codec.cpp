@@ -0,0 +1,899 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "orchestration-message-codec.hpp"
+#include "ns3/log.h"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/tlv.hpp"
+#include <algorithm>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE ("OrchestrationMessageCodec");
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+namespace {
+
+  //reads one TLV element starting at begin and advances begin past it
+  bool
+  readElement(const uint8_t*& begin, const uint8_t* end, uint32_t& type, const uint8_t*& value, size_t& valueLen)
+  {
+    uint64_t length = 0;
+    if(!::ndn::tlv::readType(begin, end, type) || !::ndn::tlv::readVarNumber(begin, end, length))
+      return false;
+    if(length > static_cast<uint64_t>(end - begin))
+      return false;
+    value = begin;
+    valueLen = static_cast<size_t>(length);
+    begin += valueLen;
+    return true;
+  }
+
+  //NonNegativeInteger value as defined by the NDN packet format (1, 2, 4 or 8 octets), a value the 32 bit fields
+  //of the storage cannot hold is a decode error rather than truncated
+  bool
+  readNumber(const uint8_t* value, size_t valueLen, uint32_t& number)
+  {
+    if(valueLen != 1 && valueLen != 2 && valueLen != 4 && valueLen != 8)
+      return false;
+    uint64_t result = 0;
+    for(size_t i = 0; i < valueLen; i++)
+      result = (result << 8) | value[i];
+    if(result > std::numeric_limits<uint32_t>::max())
+      return false;
+    number = static_cast<uint32_t>(result);
+    return true;
+  }
+
+  uint32_t
+  parseNumber(const char* begin, const char* end)
+  {
+    uint32_t number = 0;
+    for(; begin != end && *begin >= '0' && *begin <= '9'; ++begin)
+      number = number * 10 + (*begin - '0');
+    return number;
+  }
+
+  //name URI as written by toUri, appended component-wise straight from the message bytes.
+  //Escaped, typed or period-only components are rare and left to the full URI parser
+  Name
+  readName(const uint8_t* value, size_t valueLen)
+  {
+    const uint8_t* end = value + valueLen;
+    if(std::any_of(value, end, [](uint8_t c) { return c == '%' || c == '=' || c == ':'; }))
+      return Name(std::string(reinterpret_cast<const char*>(value), valueLen));
+    Name name;
+    const uint8_t* begin = value;
+    while(begin != end)
+    {
+      if(*begin == '/')
+      {
+        ++begin;
+        continue;
+      }
+      const uint8_t* stop = std::find(begin, end, '/');
+      if(std::all_of(begin, stop, [](uint8_t c) { return c == '.'; }))
+        return Name(std::string(reinterpret_cast<const char*>(value), valueLen));
+      name.append(begin, stop - begin);
+      begin = stop;
+    }
+    return name;
+  }
+
+  template<class ENCODER>
+  size_t
+  prependNumber(ENCODER& encoder, uint32_t type, uint64_t value)
+  {
+    size_t totalLength = encoder.prependNonNegativeInteger(value);
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(type);
+    return totalLength;
+  }
+
+  /**
+   * Encoder with the interface of ndn::EncodingImpl that fills a caller owned buffer from its end,
+   * so that a message can be written into a buffer kept across packets instead of a freshly allocated Block.
+   * The caller has to size the buffer with an EncodingEstimator first, the writer does not check for overflow.
+   */
+  class TailWriter
+  {
+  public:
+    TailWriter(uint8_t* buf, size_t capacity)
+      : m_begin(buf + capacity)
+      , m_end(buf + capacity)
+    {
+    }
+
+    size_t
+    prependByte(uint8_t value)
+    {
+      *--m_begin = value;
+      return 1;
+    }
+
+    size_t
+    prependByteArray(const uint8_t* array, size_t length)
+    {
+      m_begin -= length;
+      std::copy(array, array + length, m_begin);
+      return length;
+    }
+
+    size_t
+    prependVarNumber(uint64_t number)
+    {
+      if(number < 253)
+        return prependByte(static_cast<uint8_t>(number));
+      if(number <= 0xFFFF)
+        return prependBigEndian(number, 2) + prependByte(253);
+      if(number <= 0xFFFFFFFF)
+        return prependBigEndian(number, 4) + prependByte(254);
+      return prependBigEndian(number, 8) + prependByte(255);
+    }
+
+    size_t
+    prependNonNegativeInteger(uint64_t integer)
+    {
+      if(integer <= 0xFF)
+        return prependByte(static_cast<uint8_t>(integer));
+      if(integer <= 0xFFFF)
+        return prependBigEndian(integer, 2);
+      if(integer <= 0xFFFFFFFF)
+        return prependBigEndian(integer, 4);
+      return prependBigEndian(integer, 8);
+    }
+
+    size_t
+    prependByteArrayBlock(uint32_t type, const uint8_t* array, size_t arraySize)
+    {
+      size_t totalLength = prependByteArray(array, arraySize);
+      totalLength += prependVarNumber(arraySize);
+      totalLength += prependVarNumber(type);
+      return totalLength;
+    }
+
+    size_t
+    size() const
+    {
+      return m_end - m_begin;
+    }
+
+  private:
+    size_t
+    prependBigEndian(uint64_t value, size_t length)
+    {
+      for(size_t i = 0; i < length; i++, value >>= 8)
+        prependByte(static_cast<uint8_t>(value & 0xFF));
+      return length;
+    }
+
+  private:
+    uint8_t* m_begin;
+    uint8_t* const m_end;
+  };
+
+  template<class ENCODER>
+  size_t
+  prependString(ENCODER& encoder, uint32_t type, const char* value, size_t valueLen)
+  {
+    return encoder.prependByteArrayBlock(type, reinterpret_cast<const uint8_t*>(value), valueLen);
+  }
+
+  //prepends one element per token of a comma separated list, keeping the token order on the wire
+  template<class ENCODER>
+  size_t
+  prependList(ENCODER& encoder, uint32_t type, const std::string& list)
+  {
+    size_t totalLength = 0;
+    if(list.empty() || list == "null")
+      return totalLength;
+    size_t stop = list.size();
+    while(true)
+    {
+      size_t comma = (stop == 0) ? std::string::npos : list.rfind(',', stop - 1);
+      size_t start = (comma == std::string::npos) ? 0 : comma + 1;
+      totalLength += prependString(encoder, type, list.data() + start, stop - start);
+      if(comma == std::string::npos)
+        break;
+      stop = comma;
+    }
+    return totalLength;
+  }
+
+  //provided data is kept as "name:size,name:size" on the compute node
+  template<class ENCODER>
+  size_t
+  prependDataList(ENCODER& encoder, const std::string& list)
+  {
+    size_t totalLength = 0;
+    if(list.empty() || list == "null")
+      return totalLength;
+    size_t stop = list.size();
+    while(true)
+    {
+      size_t comma = (stop == 0) ? std::string::npos : list.rfind(',', stop - 1);
+      size_t start = (comma == std::string::npos) ? 0 : comma + 1;
+      const char* begin = list.data() + start;
+      const char* end = list.data() + stop;
+      const char* colon = std::find(begin, end, ':');
+      size_t entryLength = 0;
+      entryLength += prependNumber(encoder, orchestration_tlv::DataSize,
+                                   (colon == end) ? 0 : parseNumber(colon + 1, end));
+      entryLength += prependString(encoder, orchestration_tlv::DataName, begin, colon - begin);
+      entryLength += encoder.prependVarNumber(entryLength);
+      entryLength += encoder.prependVarNumber(orchestration_tlv::DataEntry);
+      totalLength += entryLength;
+      if(comma == std::string::npos)
+        break;
+      stop = comma;
+    }
+    return totalLength;
+  }
+
+} // namespace
+
+  template<class ENCODER>
+  size_t
+  OrchestrationMessageCodec::WriteNodeInfo(ENCODER& encoder, uint32_t type, Ptr<IncOrchestrationComputeNode> node)
+  {
+    size_t totalLength = 0;
+
+    //TLV is prepended, so the elements are written back to front
+    for(auto& it : node->GetFunctionMap())
+    {
+      Ptr<INC_Computation> func = it.second;
+      size_t entryLength = 0;
+      entryLength += prependList(encoder, orchestration_tlv::InputData, func->GetInputList());
+      entryLength += prependNumber(encoder, orchestration_tlv::FunctionSize, func->GetFuncSize());
+      entryLength += prependNumber(encoder, orchestration_tlv::FunctionRom, func->GetRom());
+      entryLength += prependNumber(encoder, orchestration_tlv::FunctionRam, func->GetRam());
+      entryLength += prependNumber(encoder, orchestration_tlv::FunctionCpu, func->GetCpu());
+      entryLength += prependNumber(encoder, orchestration_tlv::MissCounter, func->GetMissExecCounter());
+      entryLength += prependNumber(encoder, orchestration_tlv::ExecCounter, func->GetCounter());
+      entryLength += prependNumber(encoder, orchestration_tlv::FunctionStatus, func->GetEnableStatus() ? 1 : 0);
+      entryLength += prependString(encoder, orchestration_tlv::FunctionName, it.first.data(), it.first.size());
+      entryLength += encoder.prependVarNumber(entryLength);
+      entryLength += encoder.prependVarNumber(orchestration_tlv::FunctionEntry);
+      totalLength += entryLength;
+    }
+    totalLength += prependDataList(encoder, node->GetProvidedData());
+    totalLength += prependNumber(encoder, orchestration_tlv::NodeBusyCounter, node->GetNodeBusyCounter());
+    totalLength += prependList(encoder, orchestration_tlv::Runtime, node->GetSupportedRuntimes());
+    totalLength += prependList(encoder, orchestration_tlv::Link, node->GetLinks());
+    totalLength += prependNumber(encoder, orchestration_tlv::Rom, node->GetRom());
+    totalLength += prependNumber(encoder, orchestration_tlv::Ram, node->GetRam());
+    totalLength += prependNumber(encoder, orchestration_tlv::ProcessorCore, node->GetProcessorCore());
+    std::string name = node->GetName();
+    totalLength += prependString(encoder, orchestration_tlv::NodeName, name.data(), name.size());
+
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(type);
+    return totalLength;
+  }
+
+  template<class ENCODER>
+  size_t
+  OrchestrationMessageCodec::WriteFunctionSwitch(ENCODER& encoder, const OrchestrationFunctionSwitch& command)
+  {
+    size_t totalLength = 0;
+    for(auto it = command.functions.rbegin(); it != command.functions.rend(); ++it)
+    {
+      totalLength += prependString(encoder, orchestration_tlv::FunctionName, it->data(), it->size());
+    }
+    totalLength += prependNumber(encoder, orchestration_tlv::SwitchAction, command.enable ? 1 : 0);
+    totalLength += prependString(encoder, orchestration_tlv::NodeName, command.nodeName.data(), command.nodeName.size());
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(orchestration_tlv::FunctionSwitch);
+    return totalLength;
+  }
+
+  template<class ENCODER>
+  size_t
+  OrchestrationMessageCodec::WriteNodeCommand(ENCODER& encoder, const OrchestrationNodeCommand& command)
+  {
+    size_t totalLength = 0;
+    for(auto it = command.priorities.rbegin(); it != command.priorities.rend(); ++it)
+    {
+      size_t entryLength = 0;
+      entryLength += prependNumber(encoder, orchestration_tlv::Priority, it->second);
+      entryLength += prependString(encoder, orchestration_tlv::FunctionName, it->first.data(), it->first.size());
+      entryLength += encoder.prependVarNumber(entryLength);
+      entryLength += encoder.prependVarNumber(orchestration_tlv::FunctionPriority);
+      totalLength += entryLength;
+    }
+    for(auto it = command.disable.rbegin(); it != command.disable.rend(); ++it)
+    {
+      totalLength += prependString(encoder, orchestration_tlv::DisableFunction, it->data(), it->size());
+    }
+    for(auto it = command.enable.rbegin(); it != command.enable.rend(); ++it)
+    {
+      totalLength += prependString(encoder, orchestration_tlv::EnableFunction, it->data(), it->size());
+    }
+    if(command.seq != 0)
+      totalLength += prependNumber(encoder, orchestration_tlv::CommandSeq, command.seq);
+    totalLength += prependString(encoder, orchestration_tlv::NodeName, command.nodeName.data(), command.nodeName.size());
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(orchestration_tlv::NodeCommand);
+    return totalLength;
+  }
+
+  template<class ENCODER>
+  size_t
+  OrchestrationMessageCodec::WriteAck(ENCODER& encoder, const std::string& nodeName, bool success, uint32_t seq)
+  {
+    size_t totalLength = 0;
+    if(seq != 0)
+      totalLength += prependNumber(encoder, orchestration_tlv::CommandSeq, seq);
+    totalLength += prependNumber(encoder, orchestration_tlv::AckStatus, success ? 1 : 0);
+    totalLength += prependString(encoder, orchestration_tlv::NodeName, nodeName.data(), nodeName.size());
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(orchestration_tlv::Ack);
+    return totalLength;
+  }
+
+  template<class ENCODER>
+  size_t
+  OrchestrationMessageCodec::WriteShardSummary(ENCODER& encoder, const OrchestratorNodeInfoStorage::shardSummary& summary)
+  {
+    size_t totalLength = 0;
+    for(auto it = summary.functions.rbegin(); it != summary.functions.rend(); ++it)
+    {
+      size_t funcLength = 0;
+      funcLength += prependNumber(encoder, orchestration_tlv::MissCounter, it->missed);
+      funcLength += prependNumber(encoder, orchestration_tlv::ExecCounter, it->executions);
+      funcLength += prependNumber(encoder, orchestration_tlv::Instances, it->instances);
+      funcLength += prependString(encoder, orchestration_tlv::FunctionName, it->funcName.data(), it->funcName.size());
+      funcLength += encoder.prependVarNumber(funcLength);
+      funcLength += encoder.prependVarNumber(orchestration_tlv::FunctionSummary);
+      totalLength += funcLength;
+    }
+    totalLength += prependNumber(encoder, orchestration_tlv::NodeBusyCounter, summary.busy);
+    totalLength += prependNumber(encoder, orchestration_tlv::ShardCores, summary.cores);
+    totalLength += prependNumber(encoder, orchestration_tlv::ShardNodes, summary.nodes);
+    totalLength += prependString(encoder, orchestration_tlv::ShardName, summary.shard.data(), summary.shard.size());
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(orchestration_tlv::ShardSummary);
+    return totalLength;
+  }
+
+  template<class ENCODER>
+  size_t
+  OrchestrationMessageCodec::WriteShardView(ENCODER& encoder, const std::vector<OrchestratorNodeInfoStorage::shardSummary>& view)
+  {
+    size_t totalLength = 0;
+    for(auto it = view.rbegin(); it != view.rend(); ++it)
+    {
+      totalLength += WriteShardSummary(encoder, *it);
+    }
+    totalLength += encoder.prependVarNumber(totalLength);
+    totalLength += encoder.prependVarNumber(orchestration_tlv::ShardView);
+    return totalLength;
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeRequest(uint32_t type)
+  {
+    return ::ndn::encoding::makeEmptyBlock(type);
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeNodeStatus(uint32_t type, Ptr<IncOrchestrationComputeNode> node)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteNodeInfo(estimator, type, node);
+    ::ndn::EncodingBuffer buffer(estimatedSize, 0);
+    WriteNodeInfo(buffer, type, node);
+    return buffer.block();
+  }
+
+  size_t
+  OrchestrationMessageCodec::EncodeNodeStatus(uint8_t* buf, size_t capacity, uint32_t type, Ptr<IncOrchestrationComputeNode> node)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteNodeInfo(estimator, type, node);
+    if(estimatedSize > capacity)
+      return estimatedSize;
+    TailWriter writer(buf, capacity);
+    WriteNodeInfo(writer, type, node);
+    return writer.size();
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeFunctionSwitch(const OrchestrationFunctionSwitch& command)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteFunctionSwitch(estimator, command);
+    ::ndn::EncodingBuffer buffer(estimatedSize, 0);
+    WriteFunctionSwitch(buffer, command);
+    return buffer.block();
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeFunctionSwitch(const Name& command)
+  {
+    return EncodeFunctionSwitch(FunctionSwitchFromName(command));
+  }
+
+  OrchestrationFunctionSwitch
+  OrchestrationMessageCodec::FunctionSwitchFromName(const Name& command)
+  {
+    // eg name: /Orchestrator/Node1/FunctionSwitch/Disable/Func1/Func2/Func3
+    OrchestrationFunctionSwitch functionSwitch;
+    functionSwitch.enable = false;
+    if(command.size() < 4)
+      return functionSwitch;
+    functionSwitch.nodeName = command.get(1).toUri();
+    functionSwitch.enable = (command.getSubName(3,1).toUri() == "/Enable");
+    for(uint32_t i = 4; i < command.size(); i++)
+    {
+      functionSwitch.functions.push_back(command.getSubName(i,1).toUri());
+    }
+    return functionSwitch;
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeNodeCommand(const OrchestrationNodeCommand& command)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteNodeCommand(estimator, command);
+    ::ndn::EncodingBuffer buffer(estimatedSize, 0);
+    WriteNodeCommand(buffer, command);
+    return buffer.block();
+  }
+
+  size_t
+  OrchestrationMessageCodec::EncodeNodeCommand(uint8_t* buf, size_t capacity, const OrchestrationNodeCommand& command)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteNodeCommand(estimator, command);
+    if(estimatedSize > capacity)
+      return estimatedSize;
+    TailWriter writer(buf, capacity);
+    WriteNodeCommand(writer, command);
+    return writer.size();
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeAck(const std::string& nodeName, bool success, uint32_t seq)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteAck(estimator, nodeName, success, seq);
+    ::ndn::EncodingBuffer buffer(estimatedSize, 0);
+    WriteAck(buffer, nodeName, success, seq);
+    return buffer.block();
+  }
+
+  size_t
+  OrchestrationMessageCodec::EncodeAck(uint8_t* buf, size_t capacity, const std::string& nodeName, bool success, uint32_t seq)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteAck(estimator, nodeName, success, seq);
+    if(estimatedSize > capacity)
+      return estimatedSize;
+    TailWriter writer(buf, capacity);
+    WriteAck(writer, nodeName, success, seq);
+    return writer.size();
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeShardSummary(const OrchestratorNodeInfoStorage::shardSummary& summary)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteShardSummary(estimator, summary);
+    ::ndn::EncodingBuffer buffer(estimatedSize, 0);
+    WriteShardSummary(buffer, summary);
+    return buffer.block();
+  }
+
+  ::ndn::Block
+  OrchestrationMessageCodec::EncodeShardView(const std::vector<OrchestratorNodeInfoStorage::shardSummary>& view)
+  {
+    ::ndn::EncodingEstimator estimator;
+    size_t estimatedSize = WriteShardView(estimator, view);
+    ::ndn::EncodingBuffer buffer(estimatedSize, 0);
+    WriteShardView(buffer, view);
+    return buffer.block();
+  }
+
+  bool
+  OrchestrationMessageCodec::ReadMessage(const uint8_t* buf, size_t len, uint32_t& type, const uint8_t*& value, size_t& valueLen)
+  {
+    const uint8_t* begin = buf;
+    const uint8_t* end = buf + len;
+    if(!readElement(begin, end, type, value, valueLen))
+      return false;
+    return (type >= orchestration_tlv::BootstrapInfo) && (type <= orchestration_tlv::NodeCommand);
+  }
+
+  bool
+  OrchestrationMessageCodec::IsOrchestrationMessage(const uint8_t* buf, size_t len)
+  {
+    uint32_t type;
+    const uint8_t* value;
+    size_t valueLen;
+    return ReadMessage(buf, len, type, value, valueLen);
+  }
+
+  bool
+  OrchestrationMessageCodec::DecodeNodeStatus(const uint8_t* value, size_t valueLen, OrchestratorNodeInfoStorage::computeNode& node)
+  {
+    const uint8_t* begin = value;
+    const uint8_t* end = value + valueLen;
+    node.links.second.clear();
+    node.runtimes_supported.second.clear();
+    node.data_current.clear();
+    node.functions_current.clear();
+    while(begin != end)
+    {
+      uint32_t type;
+      const uint8_t* elem;
+      size_t elemLen;
+      if(!readElement(begin, end, type, elem, elemLen))
+      {
+        NS_LOG_WARN("Malformed node status message");
+        return false;
+      }
+      switch(type)
+      {
+        case orchestration_tlv::NodeName:
+          node.nodeName = Name().append(elem, elemLen);
+          break;
+        case orchestration_tlv::ProcessorCore:
+          if(!readNumber(elem, elemLen, node.cpu.second))
+            return false;
+          break;
+        case orchestration_tlv::Ram:
+          if(!readNumber(elem, elemLen, node.ram.second))
+            return false;
+          break;
+        case orchestration_tlv::Rom:
+          if(!readNumber(elem, elemLen, node.rom.second))
+            return false;
+          break;
+        case orchestration_tlv::Link:
+          node.links.second.emplace_back(reinterpret_cast<const char*>(elem), elemLen);
+          break;
+        case orchestration_tlv::Runtime:
+          node.runtimes_supported.second.emplace_back(reinterpret_cast<const char*>(elem), elemLen);
+          break;
+        case orchestration_tlv::NodeBusyCounter:
+          if(!readNumber(elem, elemLen, node.nodeBusyCounter.second))
+            return false;
+          break;
+        case orchestration_tlv::DataEntry:
+        {
+          OrchestratorNodeInfoStorage::dataInfo data;
+          data.size_bytes = 0;
+          const uint8_t* dataBegin = elem;
+          const uint8_t* dataEnd = elem + elemLen;
+          while(dataBegin != dataEnd)
+          {
+            uint32_t dataType;
+            const uint8_t* field;
+            size_t fieldLen;
+            if(!readElement(dataBegin, dataEnd, dataType, field, fieldLen))
+              return false;
+            if(dataType == orchestration_tlv::DataName)
+              data.dataName = readName(field, fieldLen);
+            else if(dataType == orchestration_tlv::DataSize && !readNumber(field, fieldLen, data.size_bytes))
+              return false;
+          }
+          node.data_current.push_back(data);
+          break;
+        }
+        case orchestration_tlv::FunctionEntry:
+        {
+          OrchestratorNodeInfoStorage::functionInfo func;
+          func.exec_time = 0;
+          func.func_exe_counter = 0;
+          func.func_interest_counter = 0;
+          func.cores = 0;
+          func.ram = 0;
+          func.rom = 0;
+          func.size_bytes = 0;
+          func.status = false;
+          const uint8_t* funcBegin = elem;
+          const uint8_t* funcEnd = elem + elemLen;
+          while(funcBegin != funcEnd)
+          {
+            uint32_t funcType;
+            const uint8_t* field;
+            size_t fieldLen;
+            uint32_t number = 0;
+            if(!readElement(funcBegin, funcEnd, funcType, field, fieldLen))
+              return false;
+            if(funcType == orchestration_tlv::FunctionName)
+            {
+              func.funcName = readName(field, fieldLen);
+              continue;
+            }
+            if(funcType == orchestration_tlv::InputData)
+            {
+              func.input_data_list.emplace_back(reinterpret_cast<const char*>(field), fieldLen);
+              continue;
+            }
+            if(funcType < orchestration_tlv::FunctionStatus || funcType > orchestration_tlv::FunctionSize)
+              continue;
+            if(!readNumber(field, fieldLen, number))
+              return false;
+            switch(funcType)
+            {
+              case orchestration_tlv::FunctionStatus: func.status = (number != 0); break;
+              case orchestration_tlv::ExecCounter: func.func_exe_counter = number; break;
+              case orchestration_tlv::MissCounter: func.func_interest_counter = number; break;
+              case orchestration_tlv::FunctionCpu: func.cores = number; break;
+              case orchestration_tlv::FunctionRam: func.ram = number; break;
+              case orchestration_tlv::FunctionRom: func.rom = number; break;
+              case orchestration_tlv::FunctionSize: func.size_bytes = number; break;
+            }
+          }
+          node.functions_current.push_back(func);
+          break;
+        }
+        default:
+          //unknown element, skip it
+          break;
+      }
+    }
+    return true;
+  }
+
+  bool
+  OrchestrationMessageCodec::DecodeFunctionSwitch(const uint8_t* value, size_t valueLen, OrchestrationFunctionSwitch& command)
+  {
+    const uint8_t* begin = value;
+    const uint8_t* end = value + valueLen;
+    bool hasAction = false;
+    command.functions.clear();
+    while(begin != end)
+    {
+      uint32_t type;
+      const uint8_t* elem;
+      size_t elemLen;
+      uint32_t action = 0;
+      if(!readElement(begin, end, type, elem, elemLen))
+      {
+        NS_LOG_WARN("Malformed function switch message");
+        return false;
+      }
+      if(type == orchestration_tlv::NodeName)
+      {
+        command.nodeName.assign(reinterpret_cast<const char*>(elem), elemLen);
+      }
+      else if(type == orchestration_tlv::SwitchAction)
+      {
+        if(!readNumber(elem, elemLen, action))
+          return false;
+        command.enable = (action != 0);
+        hasAction = true;
+      }
+      else if(type == orchestration_tlv::FunctionName)
+      {
+        command.functions.emplace_back(reinterpret_cast<const char*>(elem), elemLen);
+      }
+    }
+    return hasAction;
+  }
+
+  bool
+  OrchestrationMessageCodec::DecodeNodeCommand(const uint8_t* value, size_t valueLen, OrchestrationNodeCommand& command)
+  {
+    const uint8_t* begin = value;
+    const uint8_t* end = value + valueLen;
+    command.nodeName.clear();
+    command.enable.clear();
+    command.disable.clear();
+    command.priorities.clear();
+    command.seq = 0;
+    while(begin != end)
+    {
+      uint32_t type;
+      const uint8_t* elem;
+      size_t elemLen;
+      if(!readElement(begin, end, type, elem, elemLen))
+      {
+        NS_LOG_WARN("Malformed node command message");
+        return false;
+      }
+      switch(type)
+      {
+        case orchestration_tlv::NodeName:
+          command.nodeName.assign(reinterpret_cast<const char*>(elem), elemLen);
+          break;
+        case orchestration_tlv::CommandSeq:
+          if(!readNumber(elem, elemLen, command.seq))
+            return false;
+          break;
+        case orchestration_tlv::EnableFunction:
+          command.enable.emplace_back(reinterpret_cast<const char*>(elem), elemLen);
+          break;
+        case orchestration_tlv::DisableFunction:
+          command.disable.emplace_back(reinterpret_cast<const char*>(elem), elemLen);
+          break;
+        case orchestration_tlv::FunctionPriority:
+        {
+          std::pair<std::string, uint32_t> priority("", 0);
+          const uint8_t* prioBegin = elem;
+          const uint8_t* prioEnd = elem + elemLen;
+          while(prioBegin != prioEnd)
+          {
+            uint32_t prioType;
+            const uint8_t* field;
+            size_t fieldLen;
+            if(!readElement(prioBegin, prioEnd, prioType, field, fieldLen))
+              return false;
+            if(prioType == orchestration_tlv::FunctionName)
+              priority.first.assign(reinterpret_cast<const char*>(field), fieldLen);
+            else if(prioType == orchestration_tlv::Priority && !readNumber(field, fieldLen, priority.second))
+              return false;
+          }
+          command.priorities.push_back(priority);
+          break;
+        }
+        default:
+          //unknown element, skip it
+          break;
+      }
+    }
+    return !command.nodeName.empty();
+  }
+
+  bool
+  OrchestrationMessageCodec::DecodeAck(const uint8_t* value, size_t valueLen, OrchestrationAck& ack)
+  {
+    const uint8_t* begin = value;
+    const uint8_t* end = value + valueLen;
+    bool hasStatus = false;
+    ack.seq = 0;
+    while(begin != end)
+    {
+      uint32_t type;
+      const uint8_t* elem;
+      size_t elemLen;
+      uint32_t status = 0;
+      if(!readElement(begin, end, type, elem, elemLen))
+      {
+        NS_LOG_WARN("Malformed ack message");
+        return false;
+      }
+      if(type == orchestration_tlv::NodeName)
+      {
+        ack.nodeName.assign(reinterpret_cast<const char*>(elem), elemLen);
+      }
+      else if(type == orchestration_tlv::AckStatus)
+      {
+        if(!readNumber(elem, elemLen, status))
+          return false;
+        ack.success = (status != 0);
+        hasStatus = true;
+      }
+      else if(type == orchestration_tlv::CommandSeq)
+      {
+        if(!readNumber(elem, elemLen, ack.seq))
+          return false;
+      }
+    }
+    return hasStatus;
+  }
+
+  bool
+  OrchestrationMessageCodec::DecodeShardSummary(const uint8_t* value, size_t valueLen, OrchestratorNodeInfoStorage::shardSummary& summary)
+  {
+    const uint8_t* begin = value;
+    const uint8_t* end = value + valueLen;
+    summary.shard.clear();
+    summary.nodes = 0;
+    summary.cores = 0;
+    summary.busy = 0;
+    summary.functions.clear();
+    while(begin != end)
+    {
+      uint32_t type;
+      const uint8_t* elem;
+      size_t elemLen;
+      if(!readElement(begin, end, type, elem, elemLen))
+      {
+        NS_LOG_WARN("Malformed shard summary message");
+        return false;
+      }
+      switch(type)
+      {
+        case orchestration_tlv::ShardName:
+          summary.shard.assign(reinterpret_cast<const char*>(elem), elemLen);
+          break;
+        case orchestration_tlv::ShardNodes:
+          if(!readNumber(elem, elemLen, summary.nodes))
+            return false;
+          break;
+        case orchestration_tlv::ShardCores:
+          if(!readNumber(elem, elemLen, summary.cores))
+            return false;
+          break;
+        case orchestration_tlv::NodeBusyCounter:
+          if(!readNumber(elem, elemLen, summary.busy))
+            return false;
+          break;
+        case orchestration_tlv::FunctionSummary:
+        {
+          OrchestratorNodeInfoStorage::functionSummary func = {"", 0, 0, 0};
+          const uint8_t* funcBegin = elem;
+          const uint8_t* funcEnd = elem + elemLen;
+          while(funcBegin != funcEnd)
+          {
+            uint32_t funcType;
+            const uint8_t* field;
+            size_t fieldLen;
+            if(!readElement(funcBegin, funcEnd, funcType, field, fieldLen))
+              return false;
+            if(funcType == orchestration_tlv::FunctionName)
+              func.funcName.assign(reinterpret_cast<const char*>(field), fieldLen);
+            else if(funcType == orchestration_tlv::Instances && !readNumber(field, fieldLen, func.instances))
+              return false;
+            else if(funcType == orchestration_tlv::ExecCounter && !readNumber(field, fieldLen, func.executions))
+              return false;
+            else if(funcType == orchestration_tlv::MissCounter && !readNumber(field, fieldLen, func.missed))
+              return false;
+          }
+          summary.functions.push_back(func);
+          break;
+        }
+        default:
+          //unknown element, skip it
+          break;
+      }
+    }
+    return !summary.shard.empty();
+  }
+
+  bool
+  OrchestrationMessageCodec::DecodeShardView(const uint8_t* value, size_t valueLen, std::vector<OrchestratorNodeInfoStorage::shardSummary>& view)
+  {
+    const uint8_t* begin = value;
+    const uint8_t* end = value + valueLen;
+    view.clear();
+    while(begin != end)
+    {
+      uint32_t type;
+      const uint8_t* elem;
+      size_t elemLen;
+      if(!readElement(begin, end, type, elem, elemLen))
+      {
+        NS_LOG_WARN("Malformed shard view message");
+        return false;
+      }
+      if(type != orchestration_tlv::ShardSummary)
+        continue;
+      OrchestratorNodeInfoStorage::shardSummary summary;
+      if(!DecodeShardSummary(elem, elemLen, summary))
+        return false;
+      view.push_back(summary);
+    }
+    return true;
+  }
+
+}
+}
+}
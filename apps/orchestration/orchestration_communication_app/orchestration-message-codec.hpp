@@ -0,0 +1,252 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef ORCHESTRATION_MESSAGE_CODEC_H_
+#define ORCHESTRATION_MESSAGE_CODEC_H_
+
+#include "ns3/ptr.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/node-info-storage.hpp"
+#include "ns3/inc-orchestration-compute-node.h"
+#include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/name.hpp"
+#include <string>
+#include <vector>
+
+/*
+Binary TLV schema for the messages exchanged between the orchestrator and the compute nodes.
+The same wire format is carried as Data content by the NDN transport and as raw payload by the UDP transport.
+All TLV-TYPE numbers are taken from the application-specific range of the NDN packet format.
+
+  BootstrapInfo   ::= 200 TLV-LENGTH NodeInfo
+  NodeStatusFetch ::= 201 TLV-LENGTH NodeInfo
+  StatusNotification ::= 204 TLV-LENGTH NodeInfo
+  NodeInfo        ::= NodeName ProcessorCore Ram Rom Link* Runtime* NodeBusyCounter DataEntry* FunctionEntry*
+  DataEntry       ::= 218 TLV-LENGTH DataName DataSize
+  FunctionEntry   ::= 221 TLV-LENGTH FunctionName FunctionStatus ExecCounter MissCounter
+                          FunctionCpu FunctionRam FunctionRom FunctionSize InputData*
+  FunctionSwitch  ::= 202 TLV-LENGTH NodeName SwitchAction FunctionName*
+  Ack             ::= 203 TLV-LENGTH NodeName AckStatus CommandSeq?
+  ShardSummary    ::= 205 TLV-LENGTH ShardName ShardNodes ShardCores NodeBusyCounter FunctionSummary*
+  FunctionSummary ::= 237 TLV-LENGTH FunctionName Instances ExecCounter MissCounter
+  ShardView       ::= 206 TLV-LENGTH ShardSummary*
+  NodeCommand     ::= 207 TLV-LENGTH NodeName CommandSeq? EnableFunction* DisableFunction* FunctionPriority*
+  EnableFunction  ::= 239 TLV-LENGTH function name
+  DisableFunction ::= 240 TLV-LENGTH function name
+  FunctionPriority ::= 241 TLV-LENGTH FunctionName Priority
+
+An empty BootstrapInfo/NodeStatusFetch element is a request, a non-empty one is the reply of the node.
+A StatusNotification is pushed by a node on its own, when one of its load thresholds is crossed.
+A NodeCommand carries all changes the orchestrator decided for one node in one interval and is answered by a single Ack,
+which is only positive if every change was applied. A NodeCommand with a CommandSeq is applied at most once by the node,
+retransmissions are answered with the stored result, and the Ack echoes the CommandSeq. FunctionSwitch is kept for older orchestrators.
+ShardSummary and ShardView are exchanged between the orchestrators of a sharded deployment and their coordinator.
+Unknown elements inside a message are skipped, so that fields can be added without breaking older peers.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+namespace orchestration_tlv{
+  enum : uint32_t {
+    BootstrapInfo   = 200,
+    NodeStatusFetch = 201,
+    FunctionSwitch  = 202,
+    Ack             = 203,
+    StatusNotification = 204,
+    ShardSummary    = 205,
+    ShardView       = 206,
+    NodeCommand     = 207,
+
+    NodeName        = 210,
+    ProcessorCore   = 211,
+    Ram             = 213,
+    Rom             = 214,
+    Link            = 215,
+    Runtime         = 216,
+    NodeBusyCounter = 217,
+    DataEntry       = 218,
+    DataName        = 219,
+    DataSize        = 220,
+    FunctionEntry   = 221,
+    FunctionName    = 222,
+    FunctionStatus  = 223,
+    ExecCounter     = 224,
+    MissCounter     = 225,
+    FunctionCpu     = 226,
+    FunctionRam     = 227,
+    FunctionRom     = 228,
+    FunctionSize    = 229,
+    InputData       = 230,
+    SwitchAction    = 231,
+    AckStatus       = 232,
+    ShardName       = 233,
+    ShardNodes      = 234,
+    ShardCores      = 235,
+    FunctionSummary = 237,
+    Instances       = 238,
+    EnableFunction  = 239,
+    DisableFunction = 240,
+    FunctionPriority = 241,
+    Priority        = 242,
+    CommandSeq      = 243
+  };
+} // namespace orchestration_tlv
+
+    //decoded form of a FunctionSwitch command
+    struct OrchestrationFunctionSwitch{
+      std::string nodeName;
+      bool enable;
+      std::vector<std::string> functions;
+    };
+
+    //all changes for one compute node in one orchestration interval
+    struct OrchestrationNodeCommand{
+      std::string nodeName;
+      std::vector<std::string> enable;
+      std::vector<std::string> disable;
+      std::vector<std::pair<std::string, uint32_t>> priorities;  //function, FIB cost of the local producer
+      uint32_t seq;                                              //0 if the command is not tracked
+    };
+
+    //decoded form of an Ack sent by a compute node
+    struct OrchestrationAck{
+      std::string nodeName;
+      bool success;
+      uint32_t seq;        //CommandSeq of the acknowledged command, 0 if none
+    };
+
+    /**
+     * Encoder/decoder of the orchestration TLV messages, shared by the NDN and UDP transports.
+     * Encoding is done straight from the compute node model into an EncodingBuffer,
+     * decoding walks the wire bytes in place and writes into the orchestrator storage structs.
+     * Decoders never throw, they return false on a malformed message.
+     */
+    class OrchestrationMessageCodec
+    {
+      public:
+        //empty request message of the given type (BootstrapInfo or NodeStatusFetch)
+        static ::ndn::Block
+        EncodeRequest(uint32_t type);
+
+        //status of a compute node, type is BootstrapInfo, NodeStatusFetch or StatusNotification
+        static ::ndn::Block
+        EncodeNodeStatus(uint32_t type, Ptr<IncOrchestrationComputeNode> node);
+
+        /**
+         * The overloads taking buf write the message into the last bytes of buf[0, capacity) and return its size,
+         * the message starts at buf + capacity - size. If the message does not fit, nothing is written and
+         * the returned size is larger than capacity, so that the caller can grow its buffer and retry.
+         */
+        static size_t
+        EncodeNodeStatus(uint8_t* buf, size_t capacity, uint32_t type, Ptr<IncOrchestrationComputeNode> node);
+
+        static ::ndn::Block
+        EncodeFunctionSwitch(const OrchestrationFunctionSwitch& command);
+
+        //builds the command from an orchestration name, eg: /Orchestrator/Node1/FunctionSwitch/Disable/Func1/Func2
+        static ::ndn::Block
+        EncodeFunctionSwitch(const Name& command);
+
+        static ::ndn::Block
+        EncodeNodeCommand(const OrchestrationNodeCommand& command);
+
+        static size_t
+        EncodeNodeCommand(uint8_t* buf, size_t capacity, const OrchestrationNodeCommand& command);
+
+        static ::ndn::Block
+        EncodeAck(const std::string& nodeName, bool success, uint32_t seq = 0);
+
+        static size_t
+        EncodeAck(uint8_t* buf, size_t capacity, const std::string& nodeName, bool success, uint32_t seq = 0);
+
+        static ::ndn::Block
+        EncodeShardSummary(const OrchestratorNodeInfoStorage::shardSummary& summary);
+
+        static ::ndn::Block
+        EncodeShardView(const std::vector<OrchestratorNodeInfoStorage::shardSummary>& view);
+
+        //splits an orchestration name into a FunctionSwitch command, function names keep their leading '/'
+        static OrchestrationFunctionSwitch
+        FunctionSwitchFromName(const Name& command);
+
+        //reads the outer TLV of a message without copying, value points into buf
+        static bool
+        ReadMessage(const uint8_t* buf, size_t len, uint32_t& type, const uint8_t*& value, size_t& valueLen);
+
+        //true if buf holds one complete orchestration message
+        static bool
+        IsOrchestrationMessage(const uint8_t* buf, size_t len);
+
+        //decodes a NodeInfo value into the current (second) fields of node
+        static bool
+        DecodeNodeStatus(const uint8_t* value, size_t valueLen, OrchestratorNodeInfoStorage::computeNode& node);
+
+        static bool
+        DecodeFunctionSwitch(const uint8_t* value, size_t valueLen, OrchestrationFunctionSwitch& command);
+
+        static bool
+        DecodeNodeCommand(const uint8_t* value, size_t valueLen, OrchestrationNodeCommand& command);
+
+        static bool
+        DecodeAck(const uint8_t* value, size_t valueLen, OrchestrationAck& ack);
+
+        static bool
+        DecodeShardSummary(const uint8_t* value, size_t valueLen, OrchestratorNodeInfoStorage::shardSummary& summary);
+
+        static bool
+        DecodeShardView(const uint8_t* value, size_t valueLen, std::vector<OrchestratorNodeInfoStorage::shardSummary>& view);
+
+      private:
+        template<class ENCODER>
+        static size_t
+        WriteNodeInfo(ENCODER& encoder, uint32_t type, Ptr<IncOrchestrationComputeNode> node);
+
+        template<class ENCODER>
+        static size_t
+        WriteFunctionSwitch(ENCODER& encoder, const OrchestrationFunctionSwitch& command);
+
+        template<class ENCODER>
+        static size_t
+        WriteNodeCommand(ENCODER& encoder, const OrchestrationNodeCommand& command);
+
+        template<class ENCODER>
+        static size_t
+        WriteAck(ENCODER& encoder, const std::string& nodeName, bool success, uint32_t seq);
+
+        template<class ENCODER>
+        static size_t
+        WriteShardSummary(ENCODER& encoder, const OrchestratorNodeInfoStorage::shardSummary& summary);
+
+        template<class ENCODER>
+        static size_t
+        WriteShardView(ENCODER& encoder, const std::vector<OrchestratorNodeInfoStorage::shardSummary>& view);
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
@@ -37,6 +37,7 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/incSIM-module.h"
+#include "ns3/orchestration-message-codec.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -76,6 +77,14 @@ UdpOrchestrationCommunicationApp::GetTypeId (void)
                             MakeTimeAccessor(&UdpOrchestrationCommunicationApp::m_ExeTime), MakeTimeChecker())
           .AddAttribute("Periodic", "Periodic interests?", BooleanValue(false),
                       MakeBooleanAccessor(&UdpOrchestrationCommunicationApp::m_periodic), MakeBooleanChecker())
+          .AddAttribute ("CommandTimeout", "Time to wait for the ack of a node command before it is retransmitted",
+                         TimeValue (MilliSeconds (500)),
+                         MakeTimeAccessor (&UdpOrchestrationCommunicationApp::m_command_timeout),
+                         MakeTimeChecker ())
+          .AddAttribute ("CommandRetries", "Retransmissions of a node command before it is reported as lost",
+                         UintegerValue (3),
+                         MakeUintegerAccessor (&UdpOrchestrationCommunicationApp::m_command_retries),
+                         MakeUintegerChecker<uint32_t> ())
           .AddTraceSource ("UdpTx", "A new packet is created and is sent",
                            MakeTraceSourceAccessor (&UdpOrchestrationCommunicationApp::m_txTrace),
                            "ns3::Packet::TxTracedCallback")
@@ -85,6 +94,12 @@ UdpOrchestrationCommunicationApp::GetTypeId (void)
           .AddTraceSource ("UdpDeciTx", "A packet has been received",
                            MakeTraceSourceAccessor (&UdpOrchestrationCommunicationApp::m_deciTxTrace),
                            "ns3::Packet::DeciTxTracedCallback")
+          .AddTraceSource ("StatusNotification", "A node pushed its status",
+                           MakeTraceSourceAccessor (&UdpOrchestrationCommunicationApp::m_statusNotificationTrace),
+                           "ns3::ndn::inc::UdpOrchestrationCommunicationApp::StatusNotificationCallback")
+          .AddTraceSource ("CommandDelivery", "A node command was acked, failed or lost",
+                           MakeTraceSourceAccessor (&UdpOrchestrationCommunicationApp::m_commandDeliveryTrace),
+                           "ns3::ndn::inc::UdpOrchestrationCommunicationApp::CommandDeliveryCallback")
           .AddTraceSource (
               "TxWithAddresses", "A new packet is created and is sent",
               MakeTraceSourceAccessor (&UdpOrchestrationCommunicationApp::m_txTraceWithAddresses),
@@ -97,6 +112,8 @@ UdpOrchestrationCommunicationApp::GetTypeId (void)
 }
 
 UdpOrchestrationCommunicationApp::UdpOrchestrationCommunicationApp ()
+  : m_rx_buffer (DEFAULT_BUFFER_SIZE),
+    m_tx_buffer (DEFAULT_BUFFER_SIZE)
 {
   NS_LOG_FUNCTION (this);
   m_sent = 0;
@@ -142,6 +159,17 @@ void
 UdpOrchestrationCommunicationApp::StartApplication (void)
 {
   NS_LOG_FUNCTION (this);
+  m_message_handler.SetStorage (OrchestratorNodeInfoStorage::GetStorage (GetNode ()));
+  m_command_tracker = CreateObject<OrchestrationCommandTracker> ();
+  m_command_tracker->SetAttribute ("Timeout", TimeValue (m_command_timeout));
+  m_command_tracker->SetAttribute ("MaxRetries", UintegerValue (m_command_retries));
+  m_command_tracker->SetSendCallback (MakeCallback (&UdpOrchestrationCommunicationApp::TransmitNodeCommand, this));
+  m_command_tracker->TraceConnectWithoutContext (
+      "CommandDelivery",
+      MakeCallback (&TracedCallback<std::string, uint32_t, Time, uint32_t,
+                                    OrchestrationCommandTracker::DeliveryStatus>::operator(),
+                    &m_commandDeliveryTrace));
+  m_message_handler.SetCommandTracker (m_command_tracker);
 
   if (m_socket == 0)
     {
@@ -209,6 +237,10 @@ UdpOrchestrationCommunicationApp::StopApplication ()
     }
 
   Simulator::Cancel (m_sendEvent);
+  if (m_command_tracker != 0)
+    {
+      m_command_tracker->Clear ();
+    }
 }
 
 void
@@ -428,8 +460,54 @@ UdpOrchestrationCommunicationApp::SendOnceWithFill (std::string fill)
 {
   NS_LOG_FUNCTION (this);
   //NS_ASSERT (m_sendEvent.IsExpired ());
-  Ptr<Packet> p = new Packet (fill);
+  SendDecision (new Packet (fill));
+}
+
+void
+UdpOrchestrationCommunicationApp::SendOnceWithBlock (const ::ndn::Block &message)
+{
+  NS_LOG_FUNCTION (this);
+  SendDecision (Create<Packet> (message.wire (), message.size ()));
+}
+
+void
+UdpOrchestrationCommunicationApp::SendNodeCommand (const OrchestrationNodeCommand &command)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_command_tracker == 0)
+    {
+      NS_LOG_WARN ("[Orchestrator] not started, dropping command for " << command.nodeName);
+      return;
+    }
+  m_command_tracker->Send (command);
+}
 
+Ptr<OrchestrationCommandTracker>
+UdpOrchestrationCommunicationApp::GetCommandTracker (void) const
+{
+  return m_command_tracker;
+}
+
+void
+UdpOrchestrationCommunicationApp::TransmitNodeCommand (const OrchestrationNodeCommand &command)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_socket == 0)
+    {
+      return;
+    }
+  size_t size = OrchestrationMessageCodec::EncodeNodeCommand (m_tx_buffer.data (), m_tx_buffer.size (), command);
+  if (size > m_tx_buffer.size ())
+    {
+      m_tx_buffer.resize (size);
+      size = OrchestrationMessageCodec::EncodeNodeCommand (m_tx_buffer.data (), m_tx_buffer.size (), command);
+    }
+  SendDecision (Create<Packet> (m_tx_buffer.data () + m_tx_buffer.size () - size, size));
+}
+
+void
+UdpOrchestrationCommunicationApp::SendDecision (Ptr<Packet> p)
+{
   Address localAddress;
   m_socket->GetSockName (localAddress);
   // call to the trace sinks before the packet is actually sent,
@@ -562,8 +640,6 @@ UdpOrchestrationCommunicationApp::HandleRead (Ptr<Socket> socket)
   Ptr<Packet> packet;
   Address from;
   Address localAddress;
-  std::string packet_data;
-  std::string actionToDo;
   while ((packet = socket->RecvFrom (from)))
     {
       if (InetSocketAddress::IsMatchingType (from))
@@ -573,12 +649,6 @@ UdpOrchestrationCommunicationApp::HandleRead (Ptr<Socket> socket)
                        << packet->GetSize () << " bytes from "
                        << InetSocketAddress::ConvertFrom (from).GetIpv4 () << " port "
                        << InetSocketAddress::ConvertFrom (from).GetPort ());
-          NS_LOG_INFO ("[Orchestrator] packet content:");
-          uint8_t *buffer = new uint8_t[packet->GetSize ()];
-          packet->CopyData (buffer, packet->GetSize ());
-          packet_data = std::string ((char *) buffer);
-          NS_LOG_INFO (packet_data << std::endl);
-          NS_LOG_INFO (std::endl);
           m_rxTrace(packet);
         }
       else if (Inet6SocketAddress::IsMatchingType (from))
@@ -588,43 +658,23 @@ UdpOrchestrationCommunicationApp::HandleRead (Ptr<Socket> socket)
                        << packet->GetSize () << " bytes from "
                        << Inet6SocketAddress::ConvertFrom (from).GetIpv6 () << " port "
                        << Inet6SocketAddress::ConvertFrom (from).GetPort ());
-          NS_LOG_INFO ("[Orchestrator] packet content: ");
-          uint8_t *buffer = new uint8_t[packet->GetSize ()];
-          packet->CopyData (buffer, packet->GetSize ());
-          packet_data = std::string ((char *) buffer);
-          NS_LOG_INFO (packet_data << std::endl);
-          NS_LOG_INFO (std::endl);
           m_rxTrace(packet);
         }
 
-      if (packet_data.find ("/Orchestrator") == 0)
+      //the payload is one orchestration TLV message, the message type tells what to do with it
+      uint32_t size = packet->GetSize ();
+      if (m_rx_buffer.size () < size)
         {
-          if (packet_data.find ("/BootstrapInfo/") != packet_data.npos)
-            {
-              actionToDo = "/BootstrapInfo";
-              int index = packet_data.find (actionToDo);
-              int last_position = index + actionToDo.size() + 1;
-              packet_data.erase (0, last_position);
-            }
-          else if (packet_data.find ("/NodeStatusFetch") != packet_data.npos)
-            {
-              actionToDo = "/NodeStatusFetch";
-              int index = packet_data.find (actionToDo);
-              int last_position = index + actionToDo.size() + 1;
-              packet_data.erase (0, last_position);
-
-            }
-          else
-            {
-              actionToDo = "/Others";
-            }
+          m_rx_buffer.resize (size);
         }
-      else
+      packet->CopyData (m_rx_buffer.data (), size);
+      uint32_t type;
+      std::string nodeName;
+      if (m_message_handler.HandleMessage (m_rx_buffer.data (), size, type, nodeName) &&
+          type == orchestration_tlv::StatusNotification)
         {
-          actionToDo = "/Others";
+          m_statusNotificationTrace (nodeName);
         }
-
-      m_message_handler.HandleMessage (actionToDo, packet_data);
     }
 }
 } //namespace inc
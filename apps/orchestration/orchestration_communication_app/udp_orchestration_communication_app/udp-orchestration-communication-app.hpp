@@ -30,6 +30,8 @@
 #include "ns3/ipv4-address.h"
 #include "ns3/traced-callback.h"
 #include "ns3/message_handler.hpp"
+#include "ndn-cxx/encoding/block.hpp"
+#include <vector>
 
 #include "ns3/inc-orchestration-compute-node.h"
 
@@ -141,6 +143,11 @@ public:
   void SetFill (uint8_t *fill, uint32_t fillSize, uint32_t dataSize);
   //send a temporary message, used for orchestrating nodes, does not change m_data
   void SendOnceWithFill(std::string fill);
+  //send an orchestration TLV message (eg. a FunctionSwitch command) once
+  void SendOnceWithBlock(const ::ndn::Block &message);
+  //send a node command, retransmitted by the command tracker until the node acks it
+  void SendNodeCommand(const OrchestrationNodeCommand &command);
+  Ptr<OrchestrationCommandTracker> GetCommandTracker (void) const;
   void SendOnce(void);
 
 
@@ -164,6 +171,16 @@ private:
    */
   void Send (void);
 
+  /**
+   * \brief Send an orchestration decision packet once
+   */
+  void SendDecision (Ptr<Packet> p);
+
+  /**
+   * \brief One transmission of a tracked node command
+   */
+  void TransmitNodeCommand (const OrchestrationNodeCommand &command);
+
 
   /**
    * \brief Handle a packet reception.
@@ -189,6 +206,12 @@ private:
   uint16_t m_peerPort; //!< Remote peer port
   EventId m_sendEvent; //!< Event to send the next packet
   OrchestrationMessageHandler m_message_handler;
+  Ptr<OrchestrationCommandTracker> m_command_tracker;
+  Time m_command_timeout;
+  uint32_t m_command_retries;
+  static const size_t DEFAULT_BUFFER_SIZE = 1500; //!< one Ethernet MTU, grown on demand
+  std::vector<uint8_t> m_rx_buffer; //!< receive buffer reused for every packet
+  std::vector<uint8_t> m_tx_buffer; //!< transmit buffer reused for every node command
 
   /// Callbacks for tracing the packet Tx events
   TracedCallback<Ptr<const Packet> > m_txTrace;
@@ -200,6 +223,14 @@ private:
   typedef void ( *TxTracedCallback)(shared_ptr<const Packet>);
   typedef void ( *RxTracedCallback)(shared_ptr<const Packet>);
   typedef void ( *DeciTxTracedCallback)(shared_ptr<const Packet>);
+  typedef void ( *StatusNotificationCallback)(std::string nodeName);
+  typedef OrchestrationCommandTracker::CommandDeliveryCallback CommandDeliveryCallback;
+
+  /// Callbacks for tracing acked, failed and lost node commands
+  TracedCallback<std::string, uint32_t, Time, uint32_t, OrchestrationCommandTracker::DeliveryStatus> m_commandDeliveryTrace;
+
+  /// Callbacks for tracing status notifications pushed by the node
+  TracedCallback<std::string> m_statusNotificationTrace;
 
   /// Callbacks for tracing the packet Tx events, includes source and destination addresses
   TracedCallback<Ptr<const Packet>, const Address &, const Address &> m_txTraceWithAddresses;
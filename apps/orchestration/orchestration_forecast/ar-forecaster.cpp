@@ -0,0 +1,114 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ar-forecaster.hpp"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.ArForecaster");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(ArForecaster);
+
+    TypeId
+    ArForecaster::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::ArForecaster")
+              .SetParent<DemandForecaster>()
+              .AddConstructor<ArForecaster>()
+              .AddAttribute("Order", "Number of past samples the forecast depends on",
+                            UintegerValue(3), MakeUintegerAccessor(&ArForecaster::m_order),
+                            MakeUintegerChecker<uint32_t>(1));
+      return tid;
+    }
+
+    ArForecaster::ArForecaster() {}
+
+    std::string
+    ArForecaster::GetName() const
+    {
+      return "AR";
+    }
+
+    double
+    ArForecaster::Forecast(const DemandSeries& series, uint32_t horizon) const
+    {
+      uint32_t n = series.Size();
+      double mean = series.Mean();
+      if(n <= m_order + 1)
+        return mean;
+
+      //autocovariances up to the order
+      std::vector<double> r(m_order + 1, 0);
+      for(uint32_t k = 0; k <= m_order; k++)
+      {
+        for(uint32_t t = k; t < n; t++)
+          r[k] += (series.At(t) - mean) * (series.At(t - k) - mean);
+        r[k] /= n;
+      }
+      if(r[0] <= 0)
+        return mean;
+
+      //Levinson-Durbin, phi[j] is the coefficient of the sample j steps back
+      std::vector<double> phi(m_order + 1, 0);
+      std::vector<double> previous(m_order + 1, 0);
+      double error = r[0];
+      for(uint32_t k = 1; k <= m_order; k++)
+      {
+        double reflection = r[k];
+        for(uint32_t j = 1; j < k; j++)
+          reflection -= previous[j] * r[k - j];
+        reflection /= error;
+        phi[k] = reflection;
+        for(uint32_t j = 1; j < k; j++)
+          phi[j] = previous[j] - reflection * previous[k - j];
+        error *= (1 - reflection * reflection);
+        previous = phi;
+        if(error <= 0)
+          break;
+      }
+
+      //iterate the model on the deviations from the mean
+      std::vector<double> deviations;
+      for(uint32_t t = n - m_order; t < n; t++)
+        deviations.push_back(series.At(t) - mean);
+      for(uint32_t h = 0; h < horizon; h++)
+      {
+        double next = 0;
+        for(uint32_t j = 1; j <= m_order; j++)
+          next += phi[j] * deviations[deviations.size() - j];
+        deviations.push_back(next);
+      }
+      return std::max(0.0, mean + deviations.back());
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
@@ -0,0 +1,60 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef AR_FORECASTER_H_
+#define AR_FORECASTER_H_
+
+#include "ns3/demand-forecaster.hpp"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    /**
+     * Autoregressive model of order Order, fitted to the kept samples with the Yule-Walker equations
+     * (solved by Levinson-Durbin) and iterated horizon steps ahead.
+     * With too few samples for the order the forecast is the mean of the series.
+     */
+    class ArForecaster : public DemandForecaster
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      ArForecaster();
+
+      virtual std::string
+      GetName() const;
+
+      virtual double
+      Forecast(const DemandSeries& series, uint32_t horizon) const;
+
+    private:
+      uint32_t m_order;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
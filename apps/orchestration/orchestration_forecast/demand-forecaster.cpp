@@ -0,0 +1,73 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "demand-forecaster.hpp"
+
+#include "ns3/log.h"
+#include "ns3/object-factory.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.DemandForecaster");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(DemandForecaster);
+
+    TypeId
+    DemandForecaster::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::DemandForecaster")
+              .SetParent<Object>();
+      return tid;
+    }
+
+    DemandForecaster::DemandForecaster() {}
+
+    DemandForecaster::~DemandForecaster() {}
+
+    Ptr<DemandForecaster>
+    DemandForecaster::CreateForecaster(const std::string& name)
+    {
+      std::string typeName = name;
+      if(name == "EWMA")
+        typeName = "ns3::ndn::inc::EwmaForecaster";
+      else if(name == "Holt-Winters")
+        typeName = "ns3::ndn::inc::HoltWintersForecaster";
+      else if(name == "AR")
+        typeName = "ns3::ndn::inc::ArForecaster";
+
+      TypeId tid;
+      if(!TypeId::LookupByNameFailSafe(typeName, &tid) || !tid.IsChildOf(DemandForecaster::GetTypeId()))
+      {
+        NS_FATAL_ERROR("Unknown demand forecaster " << name);
+      }
+      ObjectFactory factory;
+      factory.SetTypeId(tid);
+      return factory.Create<DemandForecaster>();
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
@@ -0,0 +1,70 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef DEMAND_FORECASTER_H_
+#define DEMAND_FORECASTER_H_
+
+#include "ns3/object.h"
+#include "ns3/demand-history.hpp"
+#include <string>
+
+/*
+A demand forecaster predicts the demand of a function some orchestration intervals ahead from its demand series.
+The management app samples the demand history once per interval, forecasts the demand of every function
+for the next interval and hands the forecast to the orchestration strategy, so that functions can be
+enabled before a demand ramp rather than one interval after it.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    class DemandForecaster : public Object
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      DemandForecaster();
+      virtual ~DemandForecaster();
+
+      /**
+       * Creates a forecaster by its short name ("EWMA", "Holt-Winters", "AR")
+       * or by its ns-3 TypeId name.
+       */
+      static Ptr<DemandForecaster>
+      CreateForecaster(const std::string& name);
+
+      virtual std::string
+      GetName() const = 0;
+
+      //demand expected horizon samples after the last one of series, never negative
+      virtual double
+      Forecast(const DemandSeries& series, uint32_t horizon) const = 0;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
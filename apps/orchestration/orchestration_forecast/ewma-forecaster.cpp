@@ -0,0 +1,71 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ewma-forecaster.hpp"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.EwmaForecaster");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(EwmaForecaster);
+
+    TypeId
+    EwmaForecaster::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::EwmaForecaster")
+              .SetParent<DemandForecaster>()
+              .AddConstructor<EwmaForecaster>()
+              .AddAttribute("Alpha", "Weight of the newest sample",
+                            DoubleValue(0.5), MakeDoubleAccessor(&EwmaForecaster::m_alpha),
+                            MakeDoubleChecker<double>(0.0, 1.0));
+      return tid;
+    }
+
+    EwmaForecaster::EwmaForecaster() {}
+
+    std::string
+    EwmaForecaster::GetName() const
+    {
+      return "EWMA";
+    }
+
+    double
+    EwmaForecaster::Forecast(const DemandSeries& series, uint32_t horizon) const
+    {
+      if(series.Size() == 0)
+        return 0;
+      double level = series.At(0);
+      for(uint32_t t = 1; t < series.Size(); t++)
+        level = m_alpha * series.At(t) + (1 - m_alpha) * level;
+      return level;
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
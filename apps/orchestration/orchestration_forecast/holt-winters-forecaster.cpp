@@ -0,0 +1,122 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "holt-winters-forecaster.hpp"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.HoltWintersForecaster");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(HoltWintersForecaster);
+
+    TypeId
+    HoltWintersForecaster::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::HoltWintersForecaster")
+              .SetParent<DemandForecaster>()
+              .AddConstructor<HoltWintersForecaster>()
+              .AddAttribute("Alpha", "Smoothing factor of the level",
+                            DoubleValue(0.5), MakeDoubleAccessor(&HoltWintersForecaster::m_alpha),
+                            MakeDoubleChecker<double>(0.0, 1.0))
+              .AddAttribute("Beta", "Smoothing factor of the trend",
+                            DoubleValue(0.1), MakeDoubleAccessor(&HoltWintersForecaster::m_beta),
+                            MakeDoubleChecker<double>(0.0, 1.0))
+              .AddAttribute("Gamma", "Smoothing factor of the seasonal component",
+                            DoubleValue(0.3), MakeDoubleAccessor(&HoltWintersForecaster::m_gamma),
+                            MakeDoubleChecker<double>(0.0, 1.0))
+              .AddAttribute("SeasonLength", "Samples per season",
+                            UintegerValue(24), MakeUintegerAccessor(&HoltWintersForecaster::m_season),
+                            MakeUintegerChecker<uint32_t>(1));
+      return tid;
+    }
+
+    HoltWintersForecaster::HoltWintersForecaster() {}
+
+    std::string
+    HoltWintersForecaster::GetName() const
+    {
+      return "Holt-Winters";
+    }
+
+    double
+    HoltWintersForecaster::Forecast(const DemandSeries& series, uint32_t horizon) const
+    {
+      uint32_t n = series.Size();
+      if(n == 0)
+        return 0;
+
+      if(n < 2 * m_season)
+      {
+        //not enough samples to initialise the season, Holt linear smoothing
+        double level = series.At(0);
+        double trend = (n > 1) ? series.At(1) - series.At(0) : 0;
+        for(uint32_t t = 1; t < n; t++)
+        {
+          double previous = level;
+          level = m_alpha * series.At(t) + (1 - m_alpha) * (level + trend);
+          trend = m_beta * (level - previous) + (1 - m_beta) * trend;
+        }
+        return std::max(0.0, level + horizon * trend);
+      }
+
+      //level and trend from the first two seasons, seasonal offsets from the first one
+      double first = 0;
+      double second = 0;
+      for(uint32_t i = 0; i < m_season; i++)
+      {
+        first += series.At(i);
+        second += series.At(m_season + i);
+      }
+      first /= m_season;
+      second /= m_season;
+      double level = first;
+      double trend = (second - first) / m_season;
+      std::vector<double> seasonal(m_season);
+      for(uint32_t i = 0; i < m_season; i++)
+        seasonal[i] = series.At(i) - first;
+
+      for(uint32_t t = m_season; t < n; t++)
+      {
+        double x = series.At(t);
+        double s = seasonal[t % m_season];
+        double previous = level;
+        level = m_alpha * (x - s) + (1 - m_alpha) * (level + trend);
+        trend = m_beta * (level - previous) + (1 - m_beta) * trend;
+        seasonal[t % m_season] = m_gamma * (x - level) + (1 - m_gamma) * s;
+      }
+      double forecast = level + horizon * trend + seasonal[(n - 1 + horizon) % m_season];
+      return std::max(0.0, forecast);
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
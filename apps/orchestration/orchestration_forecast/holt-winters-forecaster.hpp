@@ -0,0 +1,63 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef HOLT_WINTERS_FORECASTER_H_
+#define HOLT_WINTERS_FORECASTER_H_
+
+#include "ns3/demand-forecaster.hpp"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    /**
+     * Additive Holt-Winters (triple exponential smoothing) with level, trend and a season of SeasonLength samples,
+     * eg. 24 for a diurnal workload sampled every hour of simulated time.
+     * Until two full seasons are recorded it falls back to Holt linear smoothing (level and trend only).
+     */
+    class HoltWintersForecaster : public DemandForecaster
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      HoltWintersForecaster();
+
+      virtual std::string
+      GetName() const;
+
+      virtual double
+      Forecast(const DemandSeries& series, uint32_t horizon) const;
+
+    private:
+      double m_alpha;
+      double m_beta;
+      double m_gamma;
+      uint32_t m_season;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
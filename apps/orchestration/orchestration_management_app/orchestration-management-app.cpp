@@ -26,6 +26,7 @@
 #include "orchestration-management-app.hpp"
 
 #include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/string.h"
 #include "ns3/ptr.h"
 #include "ns3/log.h"
@@ -39,6 +40,9 @@
 #include "ns3/ndnSIM/helper/boost-graph-ndn-global-routing-helper.hpp"
 #include "ns3/node-list.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+#include <chrono>
 
 NS_LOG_COMPONENT_DEFINE ("ndn.inc.OrchestrationManagementApp");
 
@@ -72,14 +76,62 @@ namespace ns3 {
                              MakeStringChecker ())
               .AddAttribute ("CommunicationModel", "In-Band/Out-of-Band", StringValue (""),
                              MakeStringAccessor (&OrchestrationManagementApp::m_communication_model),
-                             MakeStringChecker ());
+                             MakeStringChecker ())
+              .AddAttribute ("ReactToPush",
+                             "Run an extra orchestration round when a node pushes its status",
+                             BooleanValue (false),
+                             MakeBooleanAccessor (&OrchestrationManagementApp::m_react_to_push),
+                             MakeBooleanChecker ())
+              .AddAttribute ("PushReactionDelay",
+                             "Time notifications are collected before the extra round is run",
+                             TimeValue (MilliSeconds (50)),
+                             MakeTimeAccessor (&OrchestrationManagementApp::m_push_reaction_delay),
+                             MakeTimeChecker ())
+              .AddAttribute ("Forecaster",
+                             "Demand forecaster the strategy plans with: EWMA, Holt-Winters or AR, empty for none",
+                             StringValue (""),
+                             MakeStringAccessor (&OrchestrationManagementApp::m_forecaster_name),
+                             MakeStringChecker ())
+              .AddAttribute ("ForecastHorizon", "Intervals ahead the demand is forecast",
+                             UintegerValue (1),
+                             MakeUintegerAccessor (&OrchestrationManagementApp::m_forecast_horizon),
+                             MakeUintegerChecker<uint32_t> (1))
+              .AddAttribute ("AsyncStrategy",
+                             "Run the strategy on a worker thread and apply its decision after a simulated delay",
+                             BooleanValue (false),
+                             MakeBooleanAccessor (&OrchestrationManagementApp::m_async),
+                             MakeBooleanChecker ())
+              .AddAttribute ("SolverThreads", "Worker threads for asynchronous strategies, 0 for one per hardware thread",
+                             UintegerValue (1),
+                             MakeUintegerAccessor (&OrchestrationManagementApp::m_solver_threads),
+                             MakeUintegerChecker<uint32_t> ())
+              .AddAttribute ("DecisionLatency", "Modelled simulated time an asynchronous decision takes",
+                             TimeValue (Seconds (0)),
+                             MakeTimeAccessor (&OrchestrationManagementApp::m_decision_latency),
+                             MakeTimeChecker ())
+              .AddAttribute ("MeasuredLatencyScale",
+                             "Simulated seconds added per measured wall clock second of an asynchronous decision, "
+                             "0 keeps runs reproducible",
+                             DoubleValue (0.0),
+                             MakeDoubleAccessor (&OrchestrationManagementApp::m_latency_scale),
+                             MakeDoubleChecker<double> (0.0))
+              .AddTraceSource ("DemandForecast",
+                               "Trace called for every function each time the demand is forecast",
+                               MakeTraceSourceAccessor (&OrchestrationManagementApp::m_demandForecast),
+                               "ns3::ndn::inc::OrchestrationManagementApp::DemandForecastCallback")
+              .AddTraceSource ("StrategyDecision",
+                               "Trace called every time the orchestration strategy decided a batch of actions",
+                               MakeTraceSourceAccessor (&OrchestrationManagementApp::m_strategyDecision),
+                               "ns3::ndn::inc::OrchestrationManagementApp::StrategyDecisionCallback");
       return tid;
     }
 
     OrchestrationManagementApp::OrchestrationManagementApp ()
+      : m_orchestrated (false),
+        m_deciding (false),
+        m_remote_demand (0)
     {
       NS_LOG_FUNCTION (this);
-      //do nothing
     }
 
     OrchestrationManagementApp::~OrchestrationManagementApp ()
@@ -90,6 +142,37 @@ namespace ns3 {
     void
     OrchestrationManagementApp::StartApplication ()
     {
+      m_storage_handler = OrchestratorNodeInfoStorage::GetStorage (GetNode ());
+      if (!m_orchestration_strategy.empty ())
+        {
+          m_strategy = OrchestrationStrategy::CreateStrategy (m_orchestration_strategy);
+        }
+      if (!m_forecaster_name.empty ())
+        {
+          m_forecaster = DemandForecaster::CreateForecaster (m_forecaster_name);
+          m_history = CreateObject<DemandHistory> ();
+        }
+      if (m_async == true && m_strategy != 0)
+        {
+          m_pool = CreateObject<StrategyWorkerPool> ();
+          m_pool->SetAttribute ("Threads", UintegerValue (m_solver_threads));
+        }
+
+      if (m_react_to_push == true)
+        {
+          //communication apps of both models report pushed status with the same trace
+          for (uint32_t i = 0; i < GetNode ()->GetNApplications (); i++)
+            {
+              Ptr<Application> app = GetNode ()->GetApplication (i);
+              if (DynamicCast<NdnOrchestrationCommunicationApp> (app) != 0 ||
+                  DynamicCast<UdpOrchestrationCommunicationApp> (app) != 0)
+                {
+                  app->TraceConnectWithoutContext (
+                      "StatusNotification",
+                      MakeCallback (&OrchestrationManagementApp::OnStatusNotification, this));
+                }
+            }
+        }
 
       if (m_periodic == false)
         {
@@ -119,6 +202,32 @@ namespace ns3 {
     OrchestrationManagementApp::StopApplication ()
     {
       NS_LOG_FUNCTION (this);
+      Simulator::Cancel (m_push_reaction_event);
+      Simulator::Cancel (m_decision_event);
+      //the worker still reads the decision input, so wait for it before the app goes away
+      if (m_pending.valid ())
+        {
+          m_pending.wait ();
+          m_pending = std::future<StrategyDecision> ();
+        }
+      m_decision_input = NodeInfoSnapshot ();
+      m_deciding = false;
+      if (m_pool != 0)
+        {
+          m_pool->Dispose ();
+          m_pool = 0;
+        }
+    }
+
+    void
+    OrchestrationManagementApp::OnStatusNotification (std::string nodeName)
+    {
+      NS_LOG_INFO ("Status pushed by node " << nodeName << " at time " << Simulator::Now ());
+      //before the first round the storage is still filled by bootstrap, the periodic round will handle it
+      if (m_orchestrated == false || m_push_reaction_event.IsRunning () || m_strategy == 0)
+        return;
+      m_push_reaction_event = Simulator::Schedule (
+          m_push_reaction_delay, &OrchestrationManagementApp::RunStrategy, this);
     }
 
     void
@@ -126,192 +235,217 @@ namespace ns3 {
     {
       if(m_first_time)
       {
-        m_storage_handler.calculate_hop_distance();
+        m_storage_handler->calculate_hop_distance();
         m_first_time = false;
       }
-      if (m_orchestration_strategy.compare ("Function Switch") == 0)
+      //the history and the strategy of a round read the same epoch
+      NodeInfoSnapshot state = m_storage_handler->takeSnapshot ();
+      //one sample per periodic round, extra rounds after a push would distort the series
+      if (m_history != 0)
         {
-          FunctionSwitchHandler ();
+          m_history->Sample (state);
         }
-
-      if(m_orchestration_strategy.compare("Heuristics")==0)
+      if (m_strategy != 0)
         {
-
+          RunStrategyOn (state);
         }
 
+      m_orchestrated = true;
       if (m_periodic == true)
         ScheduleNextPacket ();
     }
 
-    void
-    OrchestrationManagementApp::FunctionSwitchHandler ()
+namespace {
+    StrategyDecision
+    Decide (OrchestrationStrategy* strategy, const NodeInfoSnapshot& snapshot, Time interval)
     {
-      NS_LOG_INFO("Inside Function Switch Handler at time " << Simulator::Now());
-      bool enable_status, disable_flag, enable_flag;
-      m_excluded_list.clear ();
-      uint32_t execution_counter, node_busy_counter;
-      std::string orchestration_control_enable_interest;
-      std::string orchestration_control_disable_interest;
-      std::vector<std::string> busy_node_functions;
+      StrategyDecision decision;
+      decision.epoch = snapshot.GetEpoch ();
+      //wall clock time of the decision, the simulated orchestrator decides instantly unless it runs asynchronously
+      auto start = std::chrono::steady_clock::now ();
+      decision.actions = strategy->Decide (snapshot, interval);
+      decision.latencyUs = std::chrono::duration<double, std::micro> (std::chrono::steady_clock::now () - start).count ();
+      decision.quality = strategy->Evaluate (snapshot, decision.actions, interval);
+      decision.notes = strategy->TakeNotes ();
+      return decision;
+    }
+}
 
-      //disable function from busy nodes
-      for (std::map<std::string,
-                    ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_iterator iter =
-               m_storage_handler.cbegin ();
-           iter != m_storage_handler.cend (); ++iter)
-           {
-             int sum_exe_counter=0;
-             for(auto f_it = (iter->second).functions_current.begin(); f_it != (iter->second).functions_current.end(); f_it++)
-             {
-               sum_exe_counter = sum_exe_counter + f_it->func_exe_counter;
-             }
-             if(sum_exe_counter > ((m_interval/3.0)*(iter->second).cpu.first)*(4/5))
-             {
-               orchestration_control_disable_interest = "";
-               disable_flag = false;
-               orchestration_control_disable_interest = ("/Orchestrator" + iter->first + "/FunctionSwitch/Disable");
+    void
+    OrchestrationManagementApp::RunStrategy ()
+    {
+      //status messages arriving while the strategy runs go into the next epoch
+      RunStrategyOn (m_storage_handler->takeSnapshot ());
+    }
 
-               for (auto func_iter = (iter->second.functions_current).begin ();
-               func_iter != (iter->second.functions_current).end (); ++func_iter)
-               {
-                 enable_status=func_iter->status;
-                 execution_counter = func_iter->func_exe_counter;
-                 NS_LOG_INFO("execution count of func " <<func_iter->funcName.toUri() << "  in node "<<iter->first <<" is "<<execution_counter);
-                 if((enable_status == true) && (execution_counter == 0))
-                 {
-                   orchestration_control_disable_interest.append (func_iter->funcName.toUri ()); //disable function at this node
-                   disable_flag = true;
-                   //busy_node_functions.push_back(func_iter->funcName.toUri ());
-                 }
-                 if((enable_status == true) && (execution_counter > 8))
-                 {
-                    busy_node_functions.push_back(func_iter->funcName.toUri ());
-                 }
-               }
-               Ptr<Node> Current_Node = this->GetNode ();
-               if (m_communication_model.compare ("In-Band") == 0)
-                {
-                  Ptr<ndn::inc::NdnOrchestrationCommunicationApp> m_comm_handler =  Current_Node->GetApplication (0)
-                      ->GetObject<ndn::inc::NdnOrchestrationCommunicationApp> ();
-                  if (disable_flag == true)
-                    m_comm_handler->SendOrchestrationRequest (orchestration_control_disable_interest);
-                }
-               if (m_communication_model.compare ("Out-of-Band") == 0)
-                {
-                  Ptr<ndn::inc::UdpOrchestrationCommunicationApp> m_comm_handler =
-                    Current_Node->GetApplication (0)
-                       ->GetObject<ndn::inc::UdpOrchestrationCommunicationApp> ();
-                  if (disable_flag == true)
-                    m_comm_handler->SendOnceWithFill (orchestration_control_disable_interest);
-                }
-             }
-           }
+    void
+    OrchestrationManagementApp::RunStrategyOn (const NodeInfoSnapshot& state)
+    {
+      if (m_deciding)
+        {
+          NS_LOG_INFO ("Decision of the previous round still running at time " << Simulator::Now () << ", round skipped");
+          return;
+        }
+      NS_LOG_INFO ("Running orchestration strategy " << m_strategy->GetName () << " at time " << Simulator::Now ()
+                   << " on epoch " << state.GetEpoch ());
+      if (m_forecaster != 0)
+        {
+          std::map<std::string, double> forecast;
+          for (auto& function : m_history->GetFunctions ())
+            {
+              const DemandSeries* series = m_history->GetFunctionSeries (function);
+              forecast[function] = m_forecaster->Forecast (*series, m_forecast_horizon);
+              m_demandForecast (function, series->Last (), forecast[function]);
+            }
+          m_strategy->SetDemandForecast (forecast);
+        }
 
-        //enabling functions in nodes which only forward interest i.e.; total execution counter =0;
-        for(std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_reverse_iterator it = m_storage_handler.crbegin (); it != m_storage_handler.crend (); ++it)
+      //functions the other shards have enabled nowhere, their requests may end up at the nodes of this shard
+      std::map<std::string, double> remote;
+      m_remote_demand = 0;
+      for (auto& shard : m_storage_handler->getRemoteSummaries ())
         {
-          bool enable_flag = false;
-          orchestration_control_enable_interest = ("/Orchestrator" + it->first + "/FunctionSwitch/Enable");
-          int sum_exe_counter=0;
-          for(auto f_it = (it->second).functions_current.begin(); f_it != (it->second).functions_current.end(); f_it++)
-          {
-            sum_exe_counter = sum_exe_counter + f_it->func_exe_counter;
-            bool enable_status;
-            int missed_execution_counter;
-            enable_status = f_it->status;
-            missed_execution_counter = f_it->func_interest_counter;
-            if(enable_status == false && (missed_execution_counter>5))
+          for (auto& function : shard.second.functions)
             {
-              orchestration_control_enable_interest.append (f_it->funcName.toUri());
-              enable_flag = true;
+              if (function.instances > 0 || function.missed == 0)
+                continue;
+              remote[function.funcName] += function.missed;
+              m_remote_demand += function.missed;
             }
-          }
-          if((sum_exe_counter==0) || (sum_exe_counter < ((m_interval/3.0)*(it->second).cpu.first)/2)) //enabling functions in nodes that only forward interests or is only half utilized
-          {
-            for(auto f_it = (it->second).functions_current.begin(); f_it != (it->second).functions_current.end(); f_it++)
-             {
-               if((f_it->status==false) && (std::find(busy_node_functions.begin(), busy_node_functions.end(), f_it->funcName.toUri())!=busy_node_functions.end()))
-               {
-                orchestration_control_enable_interest.append (f_it->funcName.toUri());
-                enable_flag = true;
-               }
-             }
-          }
-            Ptr<Node> Current_Node = this->GetNode ();
-            if (m_communication_model.compare ("In-Band") == 0)
-              {
-                Ptr<ndn::inc::NdnOrchestrationCommunicationApp> m_comm_handler = Current_Node->GetApplication (0)->GetObject<ndn::inc::NdnOrchestrationCommunicationApp> ();
-                if (enable_flag == true)
-                m_comm_handler->SendOrchestrationRequest (orchestration_control_enable_interest);
-              }
-            if (m_communication_model.compare ("Out-of-Band") == 0)
-              {
-                Ptr<ndn::inc::UdpOrchestrationCommunicationApp> m_comm_handler = Current_Node->GetApplication (0)->GetObject<ndn::inc::UdpOrchestrationCommunicationApp> ();
-                if (enable_flag == true)
-                m_comm_handler->SendOnceWithFill (orchestration_control_enable_interest);
-              }
         }
-        //enable functions in nodes whose missed execution counter is greater than a threshold and function status is disabled
-        for (std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_reverse_iterator iter =
-               m_storage_handler.crbegin (); iter != m_storage_handler.crend (); iter++)
+      m_strategy->SetRemoteDemand (remote);
+
+      if (m_pool == 0)
+        {
+          m_decision = Decide (PeekPointer (m_strategy), state, m_interval);
+          ApplyDecision ();
+          return;
+        }
+
+      //the worker reads the snapshot through a pointer: the table holds ns-3 Ptrs, so its last reference
+      //must be dropped on the event loop and not by a copy the worker thread releases
+      m_deciding = true;
+      m_decision_start = Simulator::Now ();
+      m_decision_input = state;
+      auto promise = std::make_shared<std::promise<StrategyDecision>> ();
+      m_pending = promise->get_future ();
+      OrchestrationStrategy* strategy = PeekPointer (m_strategy);
+      const NodeInfoSnapshot* snapshot = &m_decision_input;
+      Time interval = m_interval;
+      m_pool->Submit ([promise, strategy, snapshot, interval] () {
+        promise->set_value (Decide (strategy, *snapshot, interval));
+      });
+      m_decision_event = Simulator::Schedule (m_decision_latency, &OrchestrationManagementApp::CollectDecision, this);
+    }
+
+    void
+    OrchestrationManagementApp::CollectDecision ()
+    {
+      //blocks only if the strategy takes longer in wall clock time than the simulation needs to get here
+      m_decision = m_pending.get ();
+      m_decision_input = NodeInfoSnapshot ();
+      Time delay = m_decision_latency + Seconds (m_latency_scale * m_decision.latencyUs / 1e6);
+      Time ready = m_decision_start + delay;
+      NS_LOG_INFO ("Decision of epoch " << m_decision.epoch << " took " << m_decision.latencyUs
+                   << " us, simulated decision delay " << delay.GetSeconds () << "s");
+      if (ready > Simulator::Now ())
+        {
+          m_decision_event = Simulator::Schedule (ready - Simulator::Now (), &OrchestrationManagementApp::ApplyDecision, this);
+          return;
+        }
+      ApplyDecision ();
+    }
+
+    void
+    OrchestrationManagementApp::ApplyDecision ()
+    {
+      m_deciding = false;
+      for (auto& note : m_decision.notes)
         {
-          bool enable_flag = false;
-          orchestration_control_enable_interest = ("/Orchestrator" + iter->first + "/FunctionSwitch/Enable");
-          for(auto f_it = (iter->second).functions_current.begin(); f_it != (iter->second).functions_current.end(); f_it++)
-          {
-            bool enable_status;
-            int missed_execution_counter;
-            enable_status = f_it->status;
-            missed_execution_counter = f_it->func_interest_counter;
-            if(enable_status == false && missed_execution_counter>10)
+          NS_LOG_INFO ("Strategy " << m_strategy->GetName () << ": " << note);
+        }
+      NS_LOG_INFO ("Strategy " << m_strategy->GetName () << " decided " << m_decision.actions.size () << " actions in "
+                   << m_decision.latencyUs << " us, serving " << m_decision.quality.served << " of "
+                   << m_decision.quality.demand);
+      m_strategyDecision (m_strategy->GetName (), m_decision.latencyUs, m_decision.actions.size (),
+                          m_decision.quality.score, m_remote_demand);
+
+      EnforceActions (m_decision.actions);
+    }
+
+    void
+    OrchestrationManagementApp::EnforceActions (const std::vector<OrchestrationAction>& actions)
+    {
+      //all changes of one node travel in a single command and are answered by a single ack
+      std::map<std::string, OrchestrationNodeCommand> commands;
+      for (auto& action : actions)
+        {
+          switch (action.type)
             {
-              orchestration_control_enable_interest.append (f_it->funcName.toUri());
-              enable_flag = true;
+            case OrchestrationAction::Enable:
+              commands[action.node].enable.push_back (action.function);
+              break;
+            case OrchestrationAction::Disable:
+              commands[action.node].disable.push_back (action.function);
+              break;
+            case OrchestrationAction::Migrate:
+              commands[action.node].disable.push_back (action.function);
+              commands[action.target].enable.push_back (action.function);
+              break;
+            case OrchestrationAction::Prioritize:
+              commands[action.node].priorities.push_back (std::make_pair (action.function, action.priority));
+              break;
             }
-          }
-          Ptr<Node> Current_Node = this->GetNode ();
-          if (m_communication_model.compare ("In-Band") == 0)
-          {
-             Ptr<ndn::inc::NdnOrchestrationCommunicationApp> m_comm_handler = Current_Node->GetApplication (0)->GetObject<ndn::inc::NdnOrchestrationCommunicationApp> ();
-             if (enable_flag == true)
-             m_comm_handler->SendOrchestrationRequest (orchestration_control_enable_interest);
-          }
-          if (m_communication_model.compare ("Out-of-Band") == 0)
-          {
-             Ptr<ndn::inc::UdpOrchestrationCommunicationApp> m_comm_handler = Current_Node->GetApplication (0)->GetObject<ndn::inc::UdpOrchestrationCommunicationApp> ();
-             if (enable_flag == true)
-               m_comm_handler->SendOnceWithFill (orchestration_control_enable_interest);
-          }
+        }
+      //nodes that bring up instances are commanded first, so a migrated function is not missing in between
+      for (auto& node : commands)
+        {
+          node.second.nodeName = node.first;
+          if (!node.second.enable.empty ())
+            SendNodeCommand (node.second);
+        }
+      for (auto& node : commands)
+        {
+          if (node.second.enable.empty ())
+            SendNodeCommand (node.second);
         }
     }
 
-    bool
-    OrchestrationManagementApp::CheckAtleastOnceEnabled (std::string compute_node_name,
-                                                         std::string func_name)
+    void
+    OrchestrationManagementApp::SendNodeCommand (const OrchestrationNodeCommand& command)
     {
-      for (std::map<std::string,
-                    ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_iterator iter =
-               m_storage_handler.cbegin ();
-           iter != m_storage_handler.cend (); iter++)
+      //the orchestrator may share its node with compute node apps, so use the first communication app of the node
+      Ptr<Node> Current_Node = this->GetNode ();
+      for (uint32_t i = 0; i < Current_Node->GetNApplications (); i++)
         {
-          for (auto func_iter = (iter->second.functions_current).begin ();
-               func_iter != (iter->second.functions_current).end (); ++func_iter)
+          Ptr<Application> app = Current_Node->GetApplication (i);
+          if (m_communication_model.compare ("In-Band") == 0)
             {
-              std::vector<std::pair<std::string, std::string>>::iterator it;
-              it = std::find (m_excluded_list.begin (), m_excluded_list.end (),
-                              std::make_pair (iter->first, func_name));
-              if ((func_iter->funcName == func_name) // if the function is same
-                  && (iter->first.compare (compute_node_name) != 0) //if node is different
-                  && (func_iter->status == true) //if function is enabled
-                  && (it == m_excluded_list.end ()) //if not already on exclude list
-                  )
-                {
-                  m_excluded_list.push_back (std::make_pair (compute_node_name, func_name));
-                  return true;
-                }
+              Ptr<ndn::inc::NdnOrchestrationCommunicationApp> m_comm_handler =
+                  DynamicCast<ndn::inc::NdnOrchestrationCommunicationApp> (app);
+              if (m_comm_handler == 0)
+                continue;
+              m_comm_handler->SendNodeCommand (command);
+              return;
+            }
+          if (m_communication_model.compare ("Out-of-Band") == 0)
+            {
+              Ptr<ndn::inc::UdpOrchestrationCommunicationApp> m_comm_handler =
+                  DynamicCast<ndn::inc::UdpOrchestrationCommunicationApp> (app);
+              if (m_comm_handler == 0)
+                continue;
+              m_comm_handler->SendNodeCommand (command);
+              return;
             }
         }
-      return false;
+      NS_LOG_WARN ("No " << m_communication_model << " communication app on node " << Current_Node->GetId ()
+                   << ", dropping command for " << command.nodeName);
+    }
+
+    Ptr<DemandHistory>
+    OrchestrationManagementApp::GetDemandHistory () const
+    {
+      return m_history;
     }
 
     } // namespace inc
@@ -30,12 +30,28 @@
 #include "ns3/ndnSIM-module.h"
 #include "ns3/node-info-storage.hpp"
 #include "ns3/ndn-orchestration-communication-app.hpp"
+#include "ns3/orchestration-strategy.hpp"
+#include "ns3/demand-history.hpp"
+#include "ns3/demand-forecaster.hpp"
+#include "ns3/strategy-worker-pool.hpp"
+#include "ns3/traced-callback.h"
 #include "ndn-cxx/name.hpp"
+#include <future>
+#include <memory>
 
 
 namespace ns3{
   namespace ndn{
     namespace inc{
+	//outcome of one strategy run
+	struct StrategyDecision{
+		std::vector<OrchestrationAction> actions;
+		OrchestrationQuality quality;
+		double latencyUs;	//wall clock time the strategy took
+		uint64_t epoch;		//epoch of the storage snapshot the strategy decided on
+		std::vector<std::string> notes;	//log output of the strategy, logged when the decision is applied
+	};
+
 	/**
 	 * A helper class assists ndn/udp orchestrators on decision making.
 	 * Helps decoupling orchestration logic from communication tasks.
@@ -62,22 +78,72 @@ namespace ns3{
 		 void
 		 orchestrate();
 
+		 //snapshot of the storage -> strategy -> one node command per node
+		 void
+		 RunStrategy();
+
+		 void
+		 RunStrategyOn(const NodeInfoSnapshot& state);
+
+		 /**
+		  * With AsyncStrategy the strategy runs on a worker thread while the simulation goes on.
+		  * The decision is applied DecisionLatency + MeasuredLatencyScale * (measured wall clock time)
+		  * after the round started, rounds that fall into a running decision are skipped.
+		  */
+		 void
+		 CollectDecision();
+
 		 void
-		 FunctionSwitchHandler();
+		 ApplyDecision();
+
+		 void
+		 EnforceActions(const std::vector<OrchestrationAction>& actions);
+
+		 void
+		 SendNodeCommand(const OrchestrationNodeCommand& command);
+
+		 //runs an extra orchestration round shortly after a node pushed its status
+		 void
+		 OnStatusNotification(std::string nodeName);
+
+		 typedef void (*StrategyDecisionCallback)(std::string strategy, double latencyUs, uint32_t actions, double quality,
+		                                          double remoteDemand);
+		 typedef void (*DemandForecastCallback)(std::string function, double observed, double forecast);
 
-		 bool
-		 CheckAtleastOnceEnabled(std::string compute_node_name, std::string func_name);
+		 Ptr<DemandHistory>
+		 GetDemandHistory() const;
 
 		private:
-		OrchestratorNodeInfoStorage m_storage_handler;
+		Ptr<OrchestratorNodeInfoStorage> m_storage_handler;
 		std::string m_orchestration_strategy;
 		std::string m_communication_model;
 		bool m_periodic;
 		bool m_first_time;
-		std::vector<std::pair<std::string, std::string>> m_excluded_list;
-		std::vector<std::string> m_included_list;
 		Time m_ExeTime;
       	Time m_interval;
+		bool m_react_to_push;
+		Time m_push_reaction_delay;
+		bool m_orchestrated;
+		EventId m_push_reaction_event;
+		Ptr<OrchestrationStrategy> m_strategy;
+		TracedCallback<std::string, double, uint32_t, double, double> m_strategyDecision;
+		std::string m_forecaster_name;
+		uint32_t m_forecast_horizon;
+		Ptr<DemandForecaster> m_forecaster;
+		Ptr<DemandHistory> m_history;
+		TracedCallback<std::string, double, double> m_demandForecast;
+		double m_remote_demand;	//remote demand of the other shards the running round plans for, see SetRemoteDemand
+		bool m_async;
+		uint32_t m_solver_threads;
+		Time m_decision_latency;
+		double m_latency_scale;
+		Ptr<StrategyWorkerPool> m_pool;
+		bool m_deciding;		//a decision is being computed or waits to be applied
+		Time m_decision_start;
+		NodeInfoSnapshot m_decision_input;	//held and released on the event loop, the worker only reads it
+		std::future<StrategyDecision> m_pending;
+		StrategyDecision m_decision;
+		EventId m_decision_event;
 
 
     };
@@ -0,0 +1,114 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ndn-shard-agent-app.hpp"
+
+#include "ns3/string.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/orchestration-message-codec.hpp"
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.NdnShardAgentApp");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(NdnShardAgentApp);
+
+    TypeId
+    NdnShardAgentApp::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::NdnShardAgentApp")
+              .SetGroupName("Ndn")
+              .SetParent<App>()
+              .AddConstructor<NdnShardAgentApp>()
+              .AddAttribute("ShardName", "Name of the shard the orchestrator on this node owns", StringValue(""),
+                            MakeStringAccessor(&NdnShardAgentApp::m_shard), MakeStringChecker())
+              .AddAttribute("Prefix", "Prefix the coordinator sends summary requests under",
+                            StringValue("/Orchestrator/Shard"),
+                            MakeNameAccessor(&NdnShardAgentApp::m_prefix), MakeNameChecker());
+      return tid;
+    }
+
+    NdnShardAgentApp::NdnShardAgentApp()
+    {
+      NS_LOG_FUNCTION_NOARGS();
+    }
+
+    NdnShardAgentApp::~NdnShardAgentApp() {}
+
+    void
+    NdnShardAgentApp::StartApplication()
+    {
+      App::StartApplication();
+      NS_ASSERT_MSG(!m_shard.empty(), "NdnShardAgentApp needs a ShardName");
+      m_storage = OrchestratorNodeInfoStorage::GetStorage(GetNode());
+      Name prefix = m_prefix;
+      prefix.append(m_shard);
+      FibHelper::AddRoute(GetNode(), prefix, m_face, 0);
+    }
+
+    void
+    NdnShardAgentApp::OnInterest(std::shared_ptr<const ndn::Interest> interest)
+    {
+      App::OnInterest(interest); // tracing inside
+      if (!m_active)
+        return;
+
+      if (interest->hasApplicationParameters())
+      {
+        //the request carries the summaries of the other shards
+        const ::ndn::Block& parameters = interest->getApplicationParameters();
+        uint32_t type;
+        const uint8_t* value;
+        size_t valueLen;
+        std::vector<OrchestratorNodeInfoStorage::shardSummary> view;
+        if(OrchestrationMessageCodec::ReadMessage(parameters.value(), parameters.value_size(), type, value, valueLen) &&
+           type == orchestration_tlv::ShardView &&
+           OrchestrationMessageCodec::DecodeShardView(value, valueLen, view))
+        {
+          for(auto& summary : view)
+            m_storage->setRemoteSummary(summary);
+        }
+      }
+
+      auto data = make_shared<Data>();
+      data->setName(interest->getName());
+      data->setContent(OrchestrationMessageCodec::EncodeShardSummary(m_storage->getShardSummary(m_shard)));
+      data->setFreshnessPeriod(::ndn::time::milliseconds(1));
+      Signature signature;
+      SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
+      signature.setInfo(signatureInfo);
+      signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0));
+      data->setSignature(signature);
+      data->wireEncode();
+      m_transmittedDatas(data, this, m_face);
+      m_appLink->onReceiveData(*data);
+    }
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,65 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef NDN_SHARD_AGENT_APP_H_
+#define NDN_SHARD_AGENT_APP_H_
+
+#include "ns3/ndnSIM/apps/ndn-app.hpp"
+#include "ns3/node-info-storage.hpp"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    class NdnShardAgentApp : public App
+    {
+      /*
+       Installed next to the orchestrator of one shard. Answers the summary requests of NdnShardCoordinatorApp
+       from the storage of its node and keeps the summaries of the other shards the requests carry, which the
+       OrchestrationManagementApp of the node turns into remote demand for its strategy.
+      */
+    public:
+      static TypeId
+      GetTypeId();
+
+      NdnShardAgentApp();
+      ~NdnShardAgentApp();
+
+      virtual void
+      StartApplication();
+
+      // (overridden from ndn::App) Callback that will be called when the coordinator asks for the summary
+      virtual void
+      OnInterest(std::shared_ptr<const ndn::Interest> interest);
+
+    private:
+      std::string m_shard;
+      Name m_prefix;
+      Ptr<OrchestratorNodeInfoStorage> m_storage;
+    };
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
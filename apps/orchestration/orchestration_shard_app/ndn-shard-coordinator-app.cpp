@@ -0,0 +1,166 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ndn-shard-coordinator-app.hpp"
+
+#include "ns3/string.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/orchestration-message-codec.hpp"
+
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.NdnShardCoordinatorApp");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(NdnShardCoordinatorApp);
+
+    TypeId
+    NdnShardCoordinatorApp::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::NdnShardCoordinatorApp")
+              .SetGroupName("Ndn")
+              .SetParent<App>()
+              .AddConstructor<NdnShardCoordinatorApp>()
+              .AddAttribute("Shards", "Comma separated names of the shards to coordinate", StringValue(""),
+                            MakeStringAccessor(&NdnShardCoordinatorApp::m_shardList), MakeStringChecker())
+              .AddAttribute("Prefix", "Prefix the shard orchestrators answer summary requests under",
+                            StringValue("/Orchestrator/Shard"),
+                            MakeNameAccessor(&NdnShardCoordinatorApp::m_prefix), MakeNameChecker())
+              .AddAttribute("ExecutionTime", "Time of the first exchange", TimeValue(Seconds(12.0)),
+                            MakeTimeAccessor(&NdnShardCoordinatorApp::m_ExeTime), MakeTimeChecker())
+              .AddAttribute("Interval", "Interval of the exchange, also the lifetime of a request", TimeValue(Seconds(1.0)),
+                            MakeTimeAccessor(&NdnShardCoordinatorApp::m_interval), MakeTimeChecker())
+              .AddTraceSource("ShardSummary", "Trace called every time a shard summary arrives",
+                            MakeTraceSourceAccessor(&NdnShardCoordinatorApp::m_shardSummaryTrace),
+                            "ns3::ndn::inc::NdnShardCoordinatorApp::ShardSummaryCallback");
+      return tid;
+    }
+
+    NdnShardCoordinatorApp::NdnShardCoordinatorApp()
+      : m_seq(0)
+    {
+      NS_LOG_FUNCTION_NOARGS();
+    }
+
+    NdnShardCoordinatorApp::~NdnShardCoordinatorApp() {}
+
+    void
+    NdnShardCoordinatorApp::StartApplication()
+    {
+      App::StartApplication();
+      m_shards.clear();
+      std::istringstream shards(m_shardList);
+      std::string shard;
+      while(std::getline(shards, shard, ','))
+      {
+        if(!shard.empty())
+          m_shards.push_back(shard);
+      }
+      m_exchangeEvent = Simulator::Schedule(m_ExeTime, &NdnShardCoordinatorApp::Exchange, this);
+    }
+
+    void
+    NdnShardCoordinatorApp::StopApplication()
+    {
+      Simulator::Cancel(m_exchangeEvent);
+      App::StopApplication();
+    }
+
+    void
+    NdnShardCoordinatorApp::Exchange()
+    {
+      //requests older than their lifetime will not be answered anymore
+      for(auto it = m_pending.begin(); it != m_pending.end();)
+      {
+        if(Simulator::Now() - it->second.second >= m_interval)
+          it = m_pending.erase(it);
+        else
+          ++it;
+      }
+
+      for(auto& shard : m_shards)
+      {
+        std::vector<OrchestratorNodeInfoStorage::shardSummary> others;
+        for(auto& summary : m_view)
+        {
+          if(summary.first != shard)
+            others.push_back(summary.second);
+        }
+        Name name = m_prefix;
+        name.append(shard).append("Summary").appendNumber(m_seq);
+        shared_ptr<Interest> interest = make_shared<Interest>(name);
+        interest->setCanBePrefix(false);
+        interest->setMustBeFresh(true);
+        interest->setInterestLifetime(::ndn::time::milliseconds(m_interval.GetMilliSeconds()));
+        interest->setApplicationParameters(OrchestrationMessageCodec::EncodeShardView(others));
+        m_pending[m_seq] = std::make_pair(shard, Simulator::Now());
+        m_seq++;
+        NS_LOG_INFO("[Shard Coordinator] Sending Interest: " << *interest);
+        m_transmittedInterests(interest, this, m_face);
+        m_appLink->onReceiveInterest(*interest);
+      }
+      m_exchangeEvent = Simulator::Schedule(m_interval, &NdnShardCoordinatorApp::Exchange, this);
+    }
+
+    void
+    NdnShardCoordinatorApp::OnData(std::shared_ptr<const ndn::Data> data)
+    {
+      App::OnData(data); // tracing inside
+      const Name& name = data->getName();
+      if(name.size() == 0 || !name.get(-1).isNumber())
+        return;
+      auto pending = m_pending.find(name.get(-1).toNumber());
+      if(pending == m_pending.end())
+        return;
+
+      const ::ndn::Block& content = data->getContent();
+      uint32_t type;
+      const uint8_t* value;
+      size_t valueLen;
+      OrchestratorNodeInfoStorage::shardSummary summary;
+      if(!OrchestrationMessageCodec::ReadMessage(content.value(), content.value_size(), type, value, valueLen) ||
+         type != orchestration_tlv::ShardSummary ||
+         !OrchestrationMessageCodec::DecodeShardSummary(value, valueLen, summary))
+      {
+        NS_LOG_WARN("Dropping malformed summary of shard " << pending->second.first);
+        m_pending.erase(pending);
+        return;
+      }
+      Time delay = Simulator::Now() - pending->second.second;
+      NS_LOG_INFO("Shard " << summary.shard << " reports " << summary.nodes << " nodes, "
+                  << summary.functions.size() << " functions after " << delay.GetMilliSeconds() << " ms");
+      m_view[summary.shard] = summary;
+      m_shardSummaryTrace(summary.shard, delay, content.value_size());
+      m_pending.erase(pending);
+    }
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,84 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef NDN_SHARD_COORDINATOR_APP_H_
+#define NDN_SHARD_COORDINATOR_APP_H_
+
+#include "ns3/ndnSIM/apps/ndn-app.hpp"
+#include "ns3/node-info-storage.hpp"
+#include "ns3/traced-callback.h"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    class NdnShardCoordinatorApp : public App
+    {
+      /*
+       Parent of a sharded orchestrator deployment. Every Interval it asks each shard orchestrator for the
+       summary of its nodes with an Interest <Prefix>/<shard>/Summary/<seq>. The ApplicationParameters of that
+       Interest carry the latest summaries of all other shards, so one round trip exchanges the state both ways.
+       The shard side is answered by NdnShardAgentApp.
+      */
+    public:
+      static TypeId
+      GetTypeId();
+
+      NdnShardCoordinatorApp();
+      ~NdnShardCoordinatorApp();
+
+      virtual void
+      StartApplication();
+
+      virtual void
+      StopApplication();
+
+      // (overridden from ndn::App) Callback that will be called when a shard summary arrives
+      virtual void
+      OnData(std::shared_ptr<const ndn::Data> data);
+
+      typedef void (*ShardSummaryCallback)(std::string shard, Time delay, uint32_t bytes);
+
+    private:
+      void
+      Exchange();
+
+    private:
+      std::string m_shardList;
+      Name m_prefix;
+      Time m_ExeTime;
+      Time m_interval;
+      std::vector<std::string> m_shards;
+      std::map<std::string, OrchestratorNodeInfoStorage::shardSummary> m_view; //latest summary of every shard that answered
+      //sequence number -> (shard, send time) of the outstanding requests
+      std::map<uint64_t, std::pair<std::string, Time>> m_pending;
+      uint64_t m_seq;
+      EventId m_exchangeEvent;
+      TracedCallback<std::string, Time, uint32_t> m_shardSummaryTrace;
+    };
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
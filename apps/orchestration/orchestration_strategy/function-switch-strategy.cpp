@@ -0,0 +1,131 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "function-switch-strategy.hpp"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.FunctionSwitchStrategy");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(FunctionSwitchStrategy);
+
+    TypeId
+    FunctionSwitchStrategy::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::FunctionSwitchStrategy")
+              .SetParent<OrchestrationStrategy>()
+              .AddConstructor<FunctionSwitchStrategy>()
+              .AddAttribute("BusyUtilization", "Share of the node capacity above which a node counts as busy",
+                            DoubleValue(0.8), MakeDoubleAccessor(&FunctionSwitchStrategy::m_busyUtilization),
+                            MakeDoubleChecker<double>(0.0))
+              .AddAttribute("IdleUtilization", "Share of the node capacity below which a node takes over hot functions",
+                            DoubleValue(0.5), MakeDoubleAccessor(&FunctionSwitchStrategy::m_idleUtilization),
+                            MakeDoubleChecker<double>(0.0))
+              .AddAttribute("HotThreshold", "Executions above which a function on a busy node is hot",
+                            UintegerValue(8), MakeUintegerAccessor(&FunctionSwitchStrategy::m_hotThreshold),
+                            MakeUintegerChecker<uint32_t>())
+              .AddAttribute("MissThreshold", "Missed executions above which a disabled function is enabled",
+                            UintegerValue(5), MakeUintegerAccessor(&FunctionSwitchStrategy::m_missThreshold),
+                            MakeUintegerChecker<uint32_t>())
+              .AddAttribute("ForceMissThreshold", "Missed executions above which a disabled function is always enabled",
+                            UintegerValue(10), MakeUintegerAccessor(&FunctionSwitchStrategy::m_forceMissThreshold),
+                            MakeUintegerChecker<uint32_t>());
+      return tid;
+    }
+
+    FunctionSwitchStrategy::FunctionSwitchStrategy() {}
+
+    std::string
+    FunctionSwitchStrategy::GetName() const
+    {
+      return "Function Switch";
+    }
+
+    std::vector<OrchestrationAction>
+    FunctionSwitchStrategy::Decide(const NodeInfoSnapshot& snapshot, Time interval)
+    {
+      const NodeInfoTable& table = snapshot.GetTable();
+      std::vector<OrchestrationAction> actions;
+      Placement enabled;
+      std::vector<bool> busy_node_functions(table.GetFunctionCount(), false);
+      std::vector<uint32_t> sum_exe_counter(table.GetNodeCount(), 0);
+
+      //disable function from busy nodes
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+      {
+        const NodeInfoTable::functionCell* row = table.GetRow(node, false);
+        const std::vector<uint32_t>& functions = table.GetNodeFunctions(node, false);
+        for(uint32_t function : functions)
+        {
+          sum_exe_counter[node] += row[function].func_exe_counter;
+        }
+        if(sum_exe_counter[node] <= GetNodeCapacity(table.Cpu(node).first, interval) * m_busyUtilization)
+          continue;
+        for(uint32_t function : functions)
+        {
+          if(row[function].status && row[function].func_exe_counter == 0)
+          {
+            actions.push_back({OrchestrationAction::Disable, table.GetNodeID(node), table.GetFunctionUri(function), ""});
+          }
+          if(row[function].status && row[function].func_exe_counter > m_hotThreshold)
+          {
+            busy_node_functions[function] = true;
+          }
+        }
+      }
+
+      //enabling functions in nodes which only forward interest or are under-utilized, and functions missed too often
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+      {
+        const NodeInfoTable::functionCell* row = table.GetRow(node, false);
+        bool idle = sum_exe_counter[node] == 0 ||
+                    sum_exe_counter[node] < GetNodeCapacity(table.Cpu(node).first, interval) * m_idleUtilization;
+        for(uint32_t function : table.GetNodeFunctions(node, false))
+        {
+          if(row[function].status)
+            continue;
+          //enable functions whose missed execution counter is greater than a threshold and function status is disabled
+          if(row[function].func_interest_counter > std::min(m_missThreshold, m_forceMissThreshold) ||
+             (idle && busy_node_functions[function]))
+            enabled.insert(std::make_pair(node, function));
+        }
+      }
+
+      for(auto& p : enabled)
+      {
+        actions.push_back({OrchestrationAction::Enable, table.GetNodeID(p.first), table.GetFunctionUri(p.second), ""});
+      }
+      return actions;
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
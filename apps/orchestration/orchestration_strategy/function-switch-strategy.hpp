@@ -0,0 +1,66 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef FUNCTION_SWITCH_STRATEGY_H_
+#define FUNCTION_SWITCH_STRATEGY_H_
+
+#include "ns3/orchestration-strategy.hpp"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    /**
+     * The threshold based function switch of HYdrO, as formerly hard-coded in the management app:
+     *  1. busy nodes (executions above BusyUtilization of capacity) disable their idle functions
+     *  2. under-utilized nodes (below IdleUtilization) enable functions that are hot on busy nodes,
+     *     any node enables disabled functions missed more than MissThreshold times
+     *  3. any node enables disabled functions missed more than ForceMissThreshold times
+     */
+    class FunctionSwitchStrategy : public OrchestrationStrategy
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      FunctionSwitchStrategy();
+
+      virtual std::string
+      GetName() const;
+
+      virtual std::vector<OrchestrationAction>
+      Decide(const NodeInfoSnapshot& snapshot, Time interval);
+
+    private:
+      double m_busyUtilization;
+      double m_idleUtilization;
+      uint32_t m_hotThreshold;
+      uint32_t m_missThreshold;
+      uint32_t m_forceMissThreshold;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
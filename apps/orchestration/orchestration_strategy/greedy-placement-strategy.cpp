@@ -0,0 +1,168 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "greedy-placement-strategy.hpp"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.GreedyPlacementStrategy");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(GreedyPlacementStrategy);
+
+    TypeId
+    GreedyPlacementStrategy::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::GreedyPlacementStrategy")
+              .SetParent<OrchestrationStrategy>()
+              .AddConstructor<GreedyPlacementStrategy>()
+              .AddAttribute("MinInstances", "Nodes a function stays enabled on even without demand",
+                            UintegerValue(1), MakeUintegerAccessor(&GreedyPlacementStrategy::m_minInstances),
+                            MakeUintegerChecker<uint32_t>())
+              .AddAttribute("SaturatedPriority", "FIB cost of the local producer on a host a split function saturates, 0 to disable",
+                            UintegerValue(0), MakeUintegerAccessor(&GreedyPlacementStrategy::m_saturatedPriority),
+                            MakeUintegerChecker<uint32_t>());
+      return tid;
+    }
+
+    GreedyPlacementStrategy::GreedyPlacementStrategy() {}
+
+    std::string
+    GreedyPlacementStrategy::GetName() const
+    {
+      return "Greedy";
+    }
+
+    std::vector<OrchestrationAction>
+    GreedyPlacementStrategy::Decide(const NodeInfoSnapshot& snapshot, Time interval)
+    {
+      struct bin{
+        double capacity;
+        bool limited;     //nodes reporting 0 RAM/ROM do not account memory
+        uint32_t ram;
+        uint32_t rom;
+      };
+      struct candidate{
+        uint32_t node;
+        bool enabled;
+        uint32_t ram;
+        uint32_t rom;
+      };
+
+      const NodeInfoTable& table = snapshot.GetTable();
+      std::vector<bin> bins(table.GetNodeCount());
+      std::vector<std::vector<candidate>> hosts(table.GetFunctionCount());
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+      {
+        uint32_t ram = table.Ram(node).first;
+        uint32_t rom = table.Rom(node).first;
+        bins[node] = {GetNodeCapacity(table.Cpu(node).first, interval), ram > 0 || rom > 0, ram, rom};
+        const NodeInfoTable::functionCell* row = table.GetRow(node, false);
+        for(uint32_t function : table.GetNodeFunctions(node, false))
+        {
+          hosts[function].push_back({node, row[function].status, row[function].ram, row[function].rom});
+        }
+      }
+
+      std::vector<double> demand = GetFunctionDemand(table);
+      std::vector<uint32_t> order(demand.size());
+      for(uint32_t f = 0; f < demand.size(); f++)
+        order[f] = f;
+      std::stable_sort(order.begin(), order.end(), [&demand](uint32_t a, uint32_t b) { return demand[a] > demand[b]; });
+
+      Placement placement;
+      std::vector<OrchestrationAction> priorities;
+      for(uint32_t function : order)
+      {
+        std::vector<candidate>& candidates = hosts[function];
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [&bins](const candidate& a, const candidate& b) {
+                           if(a.enabled != b.enabled)
+                             return a.enabled;
+                           return bins[a.node].capacity > bins[b.node].capacity;
+                         });
+
+        double remaining = demand[function];
+        uint32_t instances = 0;
+        std::vector<std::pair<uint32_t, bool>> placed;    //host, capacity used up
+        for(auto& c : candidates)
+        {
+          if(remaining <= 0 && instances >= m_minInstances)
+            break;
+          bin& b = bins[c.node];
+          if(b.limited && (c.ram > b.ram || c.rom > b.rom))
+            continue;
+          if(remaining > 0 && b.capacity <= 0 && instances >= m_minInstances)
+            continue;
+
+          placement.insert(std::make_pair(c.node, function));
+          instances++;
+          if(b.limited)
+          {
+            b.ram -= c.ram;
+            b.rom -= c.rom;
+          }
+          double share = std::min(remaining, std::max(b.capacity, 0.0));
+          b.capacity -= share;
+          remaining -= share;
+          placed.push_back(std::make_pair(c.node, b.capacity <= 0));
+        }
+        bool spare = std::any_of(placed.begin(), placed.end(),
+                                 [](const std::pair<uint32_t, bool>& p) { return !p.second; });
+        for(auto& p : placed)
+        {
+          uint32_t priority = (m_saturatedPriority > 0 && spare && p.second) ? m_saturatedPriority : 0;
+          auto key = std::make_pair(table.GetNodeID(p.first), table.GetFunctionUri(function));
+          auto last = m_priorities.find(key);
+          if(priority == (last == m_priorities.end() ? 0 : last->second))
+            continue;
+          m_priorities[key] = priority;
+          OrchestrationAction action;
+          action.type = OrchestrationAction::Prioritize;
+          action.node = key.first;
+          action.function = key.second;
+          action.priority = priority;
+          priorities.push_back(action);
+        }
+        if(remaining > 0)
+        {
+          std::ostringstream note;
+          note << "Function " << table.GetFunctionUri(function) << " exceeds the free capacity by " << remaining;
+          Note(note.str());
+        }
+      }
+      std::vector<OrchestrationAction> actions = DiffPlacement(table, placement);
+      actions.insert(actions.end(), priorities.begin(), priorities.end());
+      return actions;
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
@@ -0,0 +1,68 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef GREEDY_PLACEMENT_STRATEGY_H_
+#define GREEDY_PLACEMENT_STRATEGY_H_
+
+#include "ns3/orchestration-strategy.hpp"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    /**
+     * First-fit decreasing bin packing of function demand onto node capacity.
+     * Functions are packed by decreasing demand onto the nodes that host them, nodes where the
+     * function is already enabled first (to keep switching low), then by remaining capacity.
+     * A function is split across several nodes when one node cannot take its whole demand.
+     * Node RAM/ROM bound the functions enabled per node.
+     * With SaturatedPriority set, a host whose capacity a split function used up gets that FIB cost
+     * for its local producer, so it forwards requests to the other hosts instead of queueing them,
+     * and the cost is lowered back to 0 once the host has spare capacity again.
+     */
+    class GreedyPlacementStrategy : public OrchestrationStrategy
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      GreedyPlacementStrategy();
+
+      virtual std::string
+      GetName() const;
+
+      virtual std::vector<OrchestrationAction>
+      Decide(const NodeInfoSnapshot& snapshot, Time interval);
+
+    private:
+      uint32_t m_minInstances;
+      uint32_t m_saturatedPriority;
+      //last priority sent per (node, function), only changes are sent again
+      std::map<std::pair<std::string, std::string>, uint32_t> m_priorities;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
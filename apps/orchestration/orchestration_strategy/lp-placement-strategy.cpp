@@ -0,0 +1,224 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "lp-placement-strategy.hpp"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.LpPlacementStrategy");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(LpPlacementStrategy);
+
+    static const double FLOW_EPSILON = 1e-9;
+
+    TypeId
+    LpPlacementStrategy::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::LpPlacementStrategy")
+              .SetParent<OrchestrationStrategy>()
+              .AddConstructor<LpPlacementStrategy>()
+              .AddAttribute("MinShare", "Share of the demand of a function a node must carry in the relaxation to enable it",
+                            DoubleValue(0.05), MakeDoubleAccessor(&LpPlacementStrategy::m_minShare),
+                            MakeDoubleChecker<double>(0.0, 1.0));
+      return tid;
+    }
+
+    LpPlacementStrategy::LpPlacementStrategy() {}
+
+    std::string
+    LpPlacementStrategy::GetName() const
+    {
+      return "LP";
+    }
+
+    void
+    LpPlacementStrategy::AddEdge(uint32_t from, uint32_t to, double capacity)
+    {
+      m_graph[from].push_back({to, static_cast<uint32_t>(m_graph[to].size()), capacity});
+      m_graph[to].push_back({from, static_cast<uint32_t>(m_graph[from].size() - 1), 0});
+    }
+
+    double
+    LpPlacementStrategy::MaxFlow(uint32_t source, uint32_t sink)
+    {
+      double total = 0;
+      //(vertex, edge index) each vertex was reached by
+      std::vector<std::pair<uint32_t, uint32_t>> parent(m_graph.size());
+      while(true)
+      {
+        std::vector<bool> visited(m_graph.size(), false);
+        std::queue<uint32_t> queue;
+        queue.push(source);
+        visited[source] = true;
+        while(!queue.empty() && !visited[sink])
+        {
+          uint32_t v = queue.front();
+          queue.pop();
+          for(uint32_t i = 0; i < m_graph[v].size(); i++)
+          {
+            const edge& e = m_graph[v][i];
+            if(!visited[e.to] && e.capacity > FLOW_EPSILON)
+            {
+              visited[e.to] = true;
+              parent[e.to] = std::make_pair(v, i);
+              queue.push(e.to);
+            }
+          }
+        }
+        if(!visited[sink])
+          break;
+
+        double flow = std::numeric_limits<double>::infinity();
+        for(uint32_t v = sink; v != source; v = parent[v].first)
+          flow = std::min(flow, m_graph[parent[v].first][parent[v].second].capacity);
+        for(uint32_t v = sink; v != source; v = parent[v].first)
+        {
+          edge& e = m_graph[parent[v].first][parent[v].second];
+          e.capacity -= flow;
+          m_graph[v][e.reverse].capacity += flow;
+        }
+        total += flow;
+      }
+      return total;
+    }
+
+    std::vector<OrchestrationAction>
+    LpPlacementStrategy::Decide(const NodeInfoSnapshot& snapshot, Time interval)
+    {
+      struct assignment{
+        uint32_t function;
+        uint32_t node;
+        bool enabled;
+        uint32_t ram;
+        uint32_t rom;
+        uint32_t edge;      //index of the function -> node edge
+        double flow;
+      };
+
+      const NodeInfoTable& table = snapshot.GetTable();
+      std::vector<double> demand = GetFunctionDemand(table);
+      const uint32_t functions = demand.size();
+      const uint32_t nodes = table.GetNodeCount();
+
+      //vertices: source, sink, functions, nodes
+      const uint32_t source = 0;
+      const uint32_t sink = 1;
+      const uint32_t firstFunction = 2;
+      const uint32_t firstNode = firstFunction + functions;
+      m_graph.assign(firstNode + nodes, std::vector<edge>());
+
+      std::vector<assignment> assignments;
+      for(uint32_t n = 0; n < nodes; n++)
+      {
+        const NodeInfoTable::functionCell* row = table.GetRow(n, false);
+        for(uint32_t f : table.GetNodeFunctions(n, false))
+        {
+          assignments.push_back({f, n, row[f].status, row[f].ram, row[f].rom, 0, 0});
+        }
+      }
+      //BFS explores edges in insertion order, so the flow prefers nodes the function is enabled on
+      std::stable_sort(assignments.begin(), assignments.end(),
+                       [](const assignment& a, const assignment& b) { return a.enabled && !b.enabled; });
+
+      for(uint32_t f = 0; f < functions; f++)
+        AddEdge(source, firstFunction + f, demand[f]);
+      for(auto& a : assignments)
+      {
+        a.edge = m_graph[firstFunction + a.function].size();
+        AddEdge(firstFunction + a.function, firstNode + a.node, std::numeric_limits<double>::infinity());
+      }
+      for(uint32_t n = 0; n < nodes; n++)
+        AddEdge(firstNode + n, sink, GetNodeCapacity(table.Cpu(n).first, interval));
+
+      double totalDemand = 0;
+      for(double d : demand)
+        totalDemand += d;
+      double bound = MaxFlow(source, sink);
+      std::ostringstream note;
+      note << "LP relaxation serves " << bound << " of " << totalDemand;
+      Note(note.str());
+
+      std::vector<std::vector<assignment>> byFunction(functions);
+      for(auto& a : assignments)
+      {
+        const edge& e = m_graph[firstFunction + a.function][a.edge];
+        a.flow = m_graph[e.to][e.reverse].capacity;
+        byFunction[a.function].push_back(a);
+      }
+
+      //round, functions with the highest demand get node memory first
+      std::vector<uint32_t> order(functions);
+      for(uint32_t f = 0; f < functions; f++)
+        order[f] = f;
+      std::stable_sort(order.begin(), order.end(), [&demand](uint32_t a, uint32_t b) { return demand[a] > demand[b]; });
+
+      std::vector<uint32_t> ram(nodes);
+      std::vector<uint32_t> rom(nodes);
+      std::vector<bool> limited(nodes);
+      for(uint32_t n = 0; n < nodes; n++)
+      {
+        ram[n] = table.Ram(n).first;
+        rom[n] = table.Rom(n).first;
+        limited[n] = ram[n] > 0 || rom[n] > 0;   //nodes reporting 0 RAM/ROM do not account memory
+      }
+
+      Placement placement;
+      for(uint32_t f : order)
+      {
+        std::vector<assignment>& candidates = byFunction[f];
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const assignment& a, const assignment& b) { return a.flow > b.flow; });
+        double threshold = std::max(m_minShare * demand[f], FLOW_EPSILON);
+        bool placed = false;
+        for(auto& a : candidates)
+        {
+          //below the threshold only the first fitting node, to keep the function reachable
+          if(a.flow < threshold && placed)
+            break;
+          if(limited[a.node] && (a.ram > ram[a.node] || a.rom > rom[a.node]))
+            continue;
+          if(limited[a.node])
+          {
+            ram[a.node] -= a.ram;
+            rom[a.node] -= a.rom;
+          }
+          placement.insert(std::make_pair(a.node, f));
+          placed = true;
+        }
+      }
+      return DiffPlacement(table, placement);
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
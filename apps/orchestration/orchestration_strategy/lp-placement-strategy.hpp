@@ -0,0 +1,78 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef LP_PLACEMENT_STRATEGY_H_
+#define LP_PLACEMENT_STRATEGY_H_
+
+#include "ns3/orchestration-strategy.hpp"
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    /**
+     * Placement from the LP relaxation of the demand assignment:
+     *   maximize  sum x(f,n)
+     *   s.t.      sum_n x(f,n) <= demand(f),  sum_f x(f,n) <= capacity(n),  x(f,n) = 0 if n does not host f
+     * This is a transportation problem, so it is solved exactly as a max-flow
+     * source -> function -> node -> sink. The fractional assignment is rounded by enabling
+     * every function on the nodes carrying at least MinShare of its demand, within node RAM/ROM.
+     */
+    class LpPlacementStrategy : public OrchestrationStrategy
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      LpPlacementStrategy();
+
+      virtual std::string
+      GetName() const;
+
+      virtual std::vector<OrchestrationAction>
+      Decide(const NodeInfoSnapshot& snapshot, Time interval);
+
+    private:
+      struct edge{
+        uint32_t to;
+        uint32_t reverse;
+        double capacity;
+      };
+
+      void
+      AddEdge(uint32_t from, uint32_t to, double capacity);
+
+      //Edmonds-Karp, returns the total flow from source to sink
+      double
+      MaxFlow(uint32_t source, uint32_t sink);
+
+    private:
+      double m_minShare;
+      std::vector<std::vector<edge>> m_graph;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
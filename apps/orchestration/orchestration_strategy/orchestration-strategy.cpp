@@ -0,0 +1,273 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "orchestration-strategy.hpp"
+
+#include "ns3/log.h"
+#include "ns3/object-factory.h"
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.OrchestrationStrategy");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(OrchestrationStrategy);
+
+    TypeId
+    OrchestrationStrategy::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::OrchestrationStrategy")
+              .SetParent<Object>()
+              .AddAttribute("ExecutionTime", "Expected execution time of one function call on one core",
+                            TimeValue(Seconds(3.0)), MakeTimeAccessor(&OrchestrationStrategy::m_execTime),
+                            MakeTimeChecker());
+      return tid;
+    }
+
+    OrchestrationStrategy::OrchestrationStrategy() {}
+
+    OrchestrationStrategy::~OrchestrationStrategy() {}
+
+    Ptr<OrchestrationStrategy>
+    OrchestrationStrategy::CreateStrategy(const std::string& name)
+    {
+      std::string typeName = name;
+      if(name == "Function Switch")
+        typeName = "ns3::ndn::inc::FunctionSwitchStrategy";
+      else if(name == "Greedy" || name == "Heuristics")
+        typeName = "ns3::ndn::inc::GreedyPlacementStrategy";
+      else if(name == "LP")
+        typeName = "ns3::ndn::inc::LpPlacementStrategy";
+
+      TypeId tid;
+      if(!TypeId::LookupByNameFailSafe(typeName, &tid) || !tid.IsChildOf(OrchestrationStrategy::GetTypeId()))
+      {
+        NS_FATAL_ERROR("Unknown orchestration strategy " << name);
+      }
+      ObjectFactory factory;
+      factory.SetTypeId(tid);
+      return factory.Create<OrchestrationStrategy>();
+    }
+
+    double
+    OrchestrationStrategy::GetNodeCapacity(uint32_t cores, Time interval) const
+    {
+      if(m_execTime.IsZero())
+        return 0;
+      return interval.GetSeconds() / m_execTime.GetSeconds() * cores;
+    }
+
+    void
+    OrchestrationStrategy::SetDemandForecast(const std::map<std::string, double>& forecast)
+    {
+      m_forecast = forecast;
+    }
+
+    void
+    OrchestrationStrategy::SetRemoteDemand(const std::map<std::string, double>& demand)
+    {
+      m_remote = demand;
+    }
+
+    std::vector<std::string>
+    OrchestrationStrategy::TakeNotes()
+    {
+      std::vector<std::string> notes;
+      notes.swap(m_notes);
+      return notes;
+    }
+
+    void
+    OrchestrationStrategy::Note(const std::string& note)
+    {
+      m_notes.push_back(note);
+    }
+
+    std::vector<double>
+    OrchestrationStrategy::GetFunctionDemand(const NodeInfoTable& table) const
+    {
+      std::vector<double> demand = GetObservedDemand(table);
+      //a forecast of a function no node has cannot be placed anyway
+      for(auto& func : m_forecast)
+      {
+        uint32_t function = table.FindFunction(func.first);
+        if(function != NodeInfoTable::NOT_FOUND)
+          demand[function] = std::max(demand[function], func.second);
+      }
+      for(auto& func : m_remote)
+      {
+        uint32_t function = table.FindFunction(func.first);
+        if(function != NodeInfoTable::NOT_FOUND)
+          demand[function] += func.second;
+      }
+      return demand;
+    }
+
+    std::vector<double>
+    OrchestrationStrategy::GetObservedDemand(const NodeInfoTable& table)
+    {
+      std::vector<double> demand(table.GetFunctionCount(), 0);
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+      {
+        const NodeInfoTable::functionCell* row = table.GetRow(node, false);
+        for(uint32_t function : table.GetNodeFunctions(node, false))
+          demand[function] += row[function].func_exe_counter + row[function].func_interest_counter;
+      }
+      return demand;
+    }
+
+    OrchestrationStrategy::Placement
+    OrchestrationStrategy::GetEnabledPlacement(const NodeInfoTable& table)
+    {
+      Placement placement;
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+      {
+        const NodeInfoTable::functionCell* row = table.GetRow(node, false);
+        for(uint32_t function : table.GetNodeFunctions(node, false))
+        {
+          if(row[function].status)
+            placement.insert(std::make_pair(node, function));
+        }
+      }
+      return placement;
+    }
+
+    std::vector<OrchestrationAction>
+    OrchestrationStrategy::DiffPlacement(const NodeInfoTable& table, const Placement& desired)
+    {
+      Placement current = GetEnabledPlacement(table);
+      //per function, the nodes it is removed from and added to
+      std::map<uint32_t, std::vector<uint32_t>> removed;
+      std::map<uint32_t, std::vector<uint32_t>> added;
+      for(auto& placement : current)
+      {
+        if(desired.find(placement) == desired.end())
+          removed[placement.second].push_back(placement.first);
+      }
+      for(auto& placement : desired)
+      {
+        if(current.find(placement) == current.end())
+          added[placement.second].push_back(placement.first);
+      }
+
+      std::vector<OrchestrationAction> actions;
+      for(auto& func : removed)
+      {
+        std::vector<uint32_t>& targets = added[func.first];
+        for(uint32_t node : func.second)
+        {
+          OrchestrationAction action = OrchestrationAction();
+          action.node = table.GetNodeID(node);
+          action.function = table.GetFunctionUri(func.first);
+          if(!targets.empty())
+          {
+            action.type = OrchestrationAction::Migrate;
+            action.target = table.GetNodeID(targets.back());
+            targets.pop_back();
+          }
+          else
+          {
+            action.type = OrchestrationAction::Disable;
+          }
+          actions.push_back(action);
+        }
+      }
+      for(auto& func : added)
+      {
+        for(uint32_t node : func.second)
+        {
+          OrchestrationAction action = OrchestrationAction();
+          action.type = OrchestrationAction::Enable;
+          action.node = table.GetNodeID(node);
+          action.function = table.GetFunctionUri(func.first);
+          actions.push_back(action);
+        }
+      }
+      return actions;
+    }
+
+    OrchestrationQuality
+    OrchestrationStrategy::Evaluate(const NodeInfoSnapshot& snapshot, const std::vector<OrchestrationAction>& actions,
+                                    Time interval) const
+    {
+      const NodeInfoTable& table = snapshot.GetTable();
+      Placement placement = GetEnabledPlacement(table);
+      for(auto& action : actions)
+      {
+        uint32_t function = table.FindFunction(action.function);
+        if(function == NodeInfoTable::NOT_FOUND || action.type == OrchestrationAction::Prioritize)
+          continue;
+        uint32_t node = table.FindNode(action.node);
+        if(action.type == OrchestrationAction::Enable)
+        {
+          if(node != NodeInfoTable::NOT_FOUND)
+            placement.insert(std::make_pair(node, function));
+          continue;
+        }
+        placement.erase(std::make_pair(node, function));
+        uint32_t target = table.FindNode(action.target);
+        if(action.type == OrchestrationAction::Migrate && target != NodeInfoTable::NOT_FOUND)
+          placement.insert(std::make_pair(target, function));
+      }
+
+      OrchestrationQuality quality = {0, 0, 0, 0, 0, 1};
+      std::vector<double> capacity(table.GetNodeCount());
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+        capacity[node] = GetNodeCapacity(table.Cpu(node).first, interval);
+
+      //capacity that enables each function, to split its demand proportionally
+      std::vector<double> enabledCapacity(table.GetFunctionCount(), 0);
+      for(auto& p : placement)
+        enabledCapacity[p.second] += capacity[p.first];
+      quality.instances = placement.size();
+
+      std::vector<double> demand = GetObservedDemand(table);
+      std::vector<double> load(table.GetNodeCount(), 0);
+      for(uint32_t function = 0; function < demand.size(); function++)
+      {
+        quality.demand += demand[function];
+        if(demand[function] > 0 && enabledCapacity[function] <= 0)
+          quality.unserved += demand[function];
+      }
+      for(auto& p : placement)
+      {
+        if(enabledCapacity[p.second] > 0)
+          load[p.first] += demand[p.second] * capacity[p.first] / enabledCapacity[p.second];
+      }
+      for(uint32_t node = 0; node < load.size(); node++)
+      {
+        if(load[node] > capacity[node])
+          quality.overload += load[node] - capacity[node];
+      }
+      quality.served = quality.demand - quality.unserved - quality.overload;
+      if(quality.demand > 0)
+        quality.score = quality.served / quality.demand;
+      return quality;
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
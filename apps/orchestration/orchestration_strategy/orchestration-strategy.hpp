@@ -0,0 +1,163 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef ORCHESTRATION_STRATEGY_H_
+#define ORCHESTRATION_STRATEGY_H_
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/node-info-table.hpp"
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+/*
+An orchestration strategy turns a snapshot of the orchestrator node info storage into a batch of actions.
+The management app takes the snapshot, runs the strategy and enforces the actions through the communication app,
+so strategies never talk to the network themselves.
+Strategies read the columns of the snapshot table directly and work on its dense node and function IDs,
+names are only looked up for the actions they return.
+
+Load model shared by all strategies (and by Evaluate):
+  demand of a function   = executions + missed executions reported by all nodes in the last interval
+  capacity of a node     = interval / ExecutionTime * processor cores
+  an enabled function shares its demand among the nodes it is enabled on, proportional to their capacity
+When the management app runs a demand forecaster, strategies plan for the larger of the observed and the forecast demand.
+A shard orchestrator also plans for the demand other shards report for functions they have enabled nowhere, as those
+requests are left to the nodes upstream. Evaluate always scores against the observed demand.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+    struct OrchestrationAction{
+      enum Type {
+        Enable,
+        Disable,
+        Migrate,    //disable at node, enable at target
+        Prioritize  //set the priority of an enabled function at node
+      };
+      Type type;
+      std::string node;        //node ID as used in the storage, eg: /Node1
+      std::string function;    //function name, eg: /Func1
+      std::string target;      //only for Migrate
+      uint32_t priority;       //only for Prioritize, lower is preferred
+    };
+
+    //how well a placement serves the demand of the last interval
+    struct OrchestrationQuality{
+      double demand;       //total demand
+      double served;       //demand that can be executed within node capacities
+      double overload;     //demand above node capacities
+      double unserved;     //demand of functions enabled nowhere
+      uint32_t instances;  //enabled (node, function) pairs
+      double score;        //served / demand, 1 without demand
+    };
+
+    class OrchestrationStrategy : public Object
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      OrchestrationStrategy();
+      virtual ~OrchestrationStrategy();
+
+      /**
+       * Creates a strategy by its short name ("Function Switch", "Greedy", "LP")
+       * or by its ns-3 TypeId name. "Heuristics" is kept as an alias of "Greedy".
+       */
+      static Ptr<OrchestrationStrategy>
+      CreateStrategy(const std::string& name);
+
+      virtual std::string
+      GetName() const = 0;
+
+      virtual std::vector<OrchestrationAction>
+      Decide(const NodeInfoSnapshot& snapshot, Time interval) = 0;
+
+      //demand per function expected in the next interval, cleared with an empty map
+      void
+      SetDemandForecast(const std::map<std::string, double>& forecast);
+
+      //demand per function of the other shards that none of them serves, cleared with an empty map
+      void
+      SetRemoteDemand(const std::map<std::string, double>& demand);
+
+      //quality of the placement that results from applying actions to snapshot
+      OrchestrationQuality
+      Evaluate(const NodeInfoSnapshot& snapshot, const std::vector<OrchestrationAction>& actions, Time interval) const;
+
+      /**
+       * Messages of the last Decide, cleared by the call.
+       * Decide may run on a worker thread where NS_LOG is not safe to use, so strategies collect
+       * their log output with Note and the management app logs it on the simulator thread.
+       */
+      std::vector<std::string>
+      TakeNotes();
+
+    protected:
+      void
+      Note(const std::string& note);
+
+      //(node, function) IDs of the snapshot table
+      typedef std::set<std::pair<uint32_t, uint32_t>> Placement;
+
+      //capacity of a node with cores processor cores
+      double
+      GetNodeCapacity(uint32_t cores, Time interval) const;
+
+      //demand to plan for per function ID: the observed demand, raised to the forecast where one is set,
+      //plus the remote demand
+      std::vector<double>
+      GetFunctionDemand(const NodeInfoTable& table) const;
+
+      static std::vector<double>
+      GetObservedDemand(const NodeInfoTable& table);
+
+      //(node, function) pairs enabled in the table
+      static Placement
+      GetEnabledPlacement(const NodeInfoTable& table);
+
+      /**
+       * Turns a desired placement into actions against the table.
+       * A function disabled at one node and enabled at another one becomes a Migrate.
+       */
+      static std::vector<OrchestrationAction>
+      DiffPlacement(const NodeInfoTable& table, const Placement& desired);
+
+    protected:
+      Time m_execTime;
+      std::map<std::string, double> m_forecast;
+      std::map<std::string, double> m_remote;
+      std::vector<std::string> m_notes;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
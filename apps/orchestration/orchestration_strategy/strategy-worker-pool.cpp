@@ -0,0 +1,127 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "strategy-worker-pool.hpp"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.StrategyWorkerPool");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    NS_OBJECT_ENSURE_REGISTERED(StrategyWorkerPool);
+
+    TypeId
+    StrategyWorkerPool::GetTypeId()
+    {
+      static TypeId tid =
+          TypeId("ns3::ndn::inc::StrategyWorkerPool")
+              .SetParent<Object>()
+              .AddConstructor<StrategyWorkerPool>()
+              .AddAttribute("Threads", "Number of worker threads, 0 for one per hardware thread",
+                            UintegerValue(1), MakeUintegerAccessor(&StrategyWorkerPool::m_threads),
+                            MakeUintegerChecker<uint32_t>());
+      return tid;
+    }
+
+    StrategyWorkerPool::StrategyWorkerPool()
+      : m_stop(false)
+    {
+    }
+
+    StrategyWorkerPool::~StrategyWorkerPool()
+    {
+      Shutdown();
+    }
+
+    void
+    StrategyWorkerPool::DoDispose()
+    {
+      Shutdown();
+      Object::DoDispose();
+    }
+
+    uint32_t
+    StrategyWorkerPool::GetThreads() const
+    {
+      if(m_threads == 0)
+        return std::max(1u, std::thread::hardware_concurrency());
+      return m_threads;
+    }
+
+    void
+    StrategyWorkerPool::Submit(std::function<void()> job)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        NS_ASSERT_MSG(!m_stop, "Job submitted to a disposed worker pool");
+        m_jobs.push_back(std::move(job));
+      }
+      if(m_workers.empty())
+      {
+        uint32_t threads = GetThreads();
+        NS_LOG_INFO("Starting " << threads << " strategy worker threads");
+        for(uint32_t i = 0; i < threads; i++)
+          m_workers.emplace_back(&StrategyWorkerPool::Work, this);
+      }
+      m_wakeup.notify_one();
+    }
+
+    void
+    StrategyWorkerPool::Work()
+    {
+      while(true)
+      {
+        std::function<void()> job;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_wakeup.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+          if(m_jobs.empty())
+            return;
+          job = std::move(m_jobs.front());
+          m_jobs.pop_front();
+        }
+        job();
+      }
+    }
+
+    void
+    StrategyWorkerPool::Shutdown()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_wakeup.notify_all();
+      for(auto& worker : m_workers)
+        worker.join();
+      m_workers.clear();
+    }
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
@@ -0,0 +1,87 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef STRATEGY_WORKER_POOL_H_
+#define STRATEGY_WORKER_POOL_H_
+
+#include "ns3/object.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+Worker threads the management app runs orchestration strategies on, when it decides asynchronously.
+A job only ever reads state handed to it by value (a snapshot of the node info storage), it must not schedule
+simulator events, send packets or copy or release ns-3 Ptrs: the reference counts of ns-3 objects are not atomic.
+Results are handed back through a std::future that the event loop collects in a scheduled event.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    class StrategyWorkerPool : public Object
+    {
+    public:
+      static TypeId
+      GetTypeId();
+
+      StrategyWorkerPool();
+      virtual ~StrategyWorkerPool();
+
+      //queues job, the workers are started on the first call
+      void
+      Submit(std::function<void()> job);
+
+      uint32_t
+      GetThreads() const;
+
+    protected:
+      virtual void
+      DoDispose();
+
+    private:
+      void
+      Work();
+
+      //lets the queued jobs finish and joins the workers
+      void
+      Shutdown();
+
+    private:
+      uint32_t m_threads;
+      std::vector<std::thread> m_workers;
+      std::deque<std::function<void()>> m_jobs;
+      std::mutex m_mutex;
+      std::condition_variable m_wakeup;
+      bool m_stop;
+    };
+  }//namespace inc
+ } // namespace ndn
+} // namespace ns3
+
+#endif
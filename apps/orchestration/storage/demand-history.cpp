@@ -0,0 +1,193 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "demand-history.hpp"
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.DemandHistory");
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+    DemandSeries::DemandSeries(uint32_t capacity)
+      : m_values(capacity, 0)
+      , m_head(0)
+      , m_size(0)
+    {
+    }
+
+    void
+    DemandSeries::Push(double value)
+    {
+      if(m_values.empty())
+        return;
+      if(m_size < m_values.size())
+      {
+        m_values[(m_head + m_size) % m_values.size()] = value;
+        m_size++;
+      }
+      else
+      {
+        m_values[m_head] = value;
+        m_head = (m_head + 1) % m_values.size();
+      }
+    }
+
+    uint32_t
+    DemandSeries::Size() const
+    {
+      return m_size;
+    }
+
+    uint32_t
+    DemandSeries::Capacity() const
+    {
+      return m_values.size();
+    }
+
+    double
+    DemandSeries::At(uint32_t i) const
+    {
+      NS_ASSERT_MSG(i < m_size, "Demand sample " << i << " out of range");
+      return m_values[(m_head + i) % m_values.size()];
+    }
+
+    double
+    DemandSeries::Last() const
+    {
+      return m_size == 0 ? 0 : At(m_size - 1);
+    }
+
+    double
+    DemandSeries::Mean() const
+    {
+      if(m_size == 0)
+        return 0;
+      double sum = 0;
+      for(uint32_t i = 0; i < m_size; i++)
+        sum += At(i);
+      return sum / m_size;
+    }
+
+    NS_OBJECT_ENSURE_REGISTERED(DemandHistory);
+
+    TypeId
+    DemandHistory::GetTypeId (void)
+    {
+      static TypeId tid = TypeId ("ns3::ndn::inc::DemandHistory")
+        .SetParent<Object> ()
+        .AddConstructor<DemandHistory>()
+        .AddAttribute("Capacity", "Samples kept per series, older ones are dropped",
+                      UintegerValue(96), MakeUintegerAccessor(&DemandHistory::m_capacity),
+                      MakeUintegerChecker<uint32_t>(1));
+      return tid;
+    }
+
+    DemandHistory::DemandHistory()
+      : m_samples(0)
+    {
+    }
+
+    DemandHistory::~DemandHistory()
+    {
+    }
+
+    void
+    DemandHistory::Sample(const NodeInfoSnapshot& snapshot)
+    {
+      const NodeInfoTable& table = snapshot.GetTable();
+      std::vector<double> totals(table.GetFunctionCount(), 0);
+      std::vector<bool> reported(table.GetFunctionCount(), false);
+      uint32_t functions = 0;
+      for(uint32_t node = 0; node < table.GetNodeCount(); node++)
+      {
+        const NodeInfoTable::functionCell* row = table.GetRow(node, false);
+        for(uint32_t function : table.GetNodeFunctions(node, false))
+        {
+          auto key = std::make_pair(table.GetNodeID(node), table.GetFunctionUri(function));
+          auto it = m_node_series.find(key);
+          if(it == m_node_series.end())
+            it = m_node_series.emplace(key, NodeSeries{DemandSeries(m_capacity), 0, 0}).first;
+          NodeSeries& last = it->second;
+          uint32_t executions = row[function].func_exe_counter;
+          uint32_t missed = row[function].func_interest_counter;
+          double demand = (executions >= last.executions ? executions - last.executions : executions) +
+                          (missed >= last.missed ? missed - last.missed : missed);
+          last.executions = executions;
+          last.missed = missed;
+          last.series.Push(demand);
+          totals[function] += demand;
+          if(!reported[function])
+            functions++;
+          reported[function] = true;
+        }
+      }
+      for(uint32_t function = 0; function < totals.size(); function++)
+      {
+        if(!reported[function])
+          continue;
+        const std::string& name = table.GetFunctionUri(function);
+        auto it = m_function_series.find(name);
+        if(it == m_function_series.end())
+          it = m_function_series.emplace(name, DemandSeries(m_capacity)).first;
+        it->second.Push(totals[function]);
+      }
+      m_samples++;
+      NS_LOG_DEBUG("Sample " << m_samples << " of " << functions << " functions on " << table.GetNodeCount() << " nodes");
+    }
+
+    const DemandSeries*
+    DemandHistory::GetSeries(const std::string& node, const std::string& function) const
+    {
+      auto it = m_node_series.find(std::make_pair(node, function));
+      return it == m_node_series.end() ? nullptr : &it->second.series;
+    }
+
+    const DemandSeries*
+    DemandHistory::GetFunctionSeries(const std::string& function) const
+    {
+      auto it = m_function_series.find(function);
+      return it == m_function_series.end() ? nullptr : &it->second;
+    }
+
+    std::vector<std::string>
+    DemandHistory::GetFunctions() const
+    {
+      std::vector<std::string> functions;
+      for(auto& series : m_function_series)
+        functions.push_back(series.first);
+      return functions;
+    }
+
+    uint32_t
+    DemandHistory::GetSamples() const
+    {
+      return m_samples;
+    }
+}
+}
+}
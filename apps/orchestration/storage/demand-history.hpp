@@ -0,0 +1,118 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_DEMAND_HISTORY_H
+#define INC_DEMAND_HISTORY_H
+
+#include "ns3/object.h"
+#include "ns3/node-info-table.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+The demand history keeps the demand (executions + missed executions) each orchestration interval,
+per (node, function) and summed up per function, in ring buffers of bounded size.
+Unlike the node info storage, which only holds the counters of the last status fetch,
+it gives forecasters a time series to work on. The nodes report running totals, so a sample is the growth of the
+counters since the previous one; a counter below its previous value was reset (the miss counter is reset when the
+function is enabled) and counts from zero again.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    //fixed capacity ring buffer of demand samples, the oldest sample is dropped when it is full
+    class DemandSeries{
+        public:
+            explicit DemandSeries(uint32_t capacity = 0);
+
+            void
+            Push(double value);
+
+            uint32_t
+            Size() const;
+
+            uint32_t
+            Capacity() const;
+
+            //i-th kept sample, 0 is the oldest one
+            double
+            At(uint32_t i) const;
+
+            double
+            Last() const;
+
+            double
+            Mean() const;
+
+        private:
+            std::vector<double> m_values;
+            uint32_t m_head;    //position of the oldest sample
+            uint32_t m_size;
+    };
+
+    class DemandHistory: public Object{
+        public:
+            static TypeId GetTypeId (void);
+
+            DemandHistory();
+            ~DemandHistory();
+
+            //appends the demand since the previous call of every (node, function) and of every function total of the snapshot
+            void
+            Sample(const NodeInfoSnapshot& snapshot);
+
+            //nullptr if nothing was recorded for the pair
+            const DemandSeries*
+            GetSeries(const std::string& node, const std::string& function) const;
+
+            //demand of a function summed up over all nodes
+            const DemandSeries*
+            GetFunctionSeries(const std::string& function) const;
+
+            std::vector<std::string>
+            GetFunctions() const;
+
+            //number of samples taken so far, may exceed the capacity
+            uint32_t
+            GetSamples() const;
+
+        private:
+            struct NodeSeries{
+                DemandSeries series;
+                uint32_t executions;    //counters of the previous sample
+                uint32_t missed;
+            };
+
+            uint32_t m_capacity;
+            uint32_t m_samples;
+            std::map<std::pair<std::string, std::string>, NodeSeries> m_node_series;
+            std::map<std::string, DemandSeries> m_function_series;
+    };
+}
+}
+}
+#endif
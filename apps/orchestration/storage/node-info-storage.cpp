@@ -36,13 +36,17 @@
 #include "ns3/names.h"
 #include "ns3/node-list.h"
 #include "ns3/channel-list.h"
+#include "ns3/simulator.h"
 #include "ns3/object-factory.h"
 
 #include "ns3/ndnSIM/model/ndn-global-router.hpp"
-#include "ns3/ndnSIM/helper/boost-graph-ndn-global-routing-helper.hpp"
-#include <boost/graph/dijkstra_shortest_paths.hpp>
 #include "ns3/node-list.h"
 
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <thread>
+
 
 NS_LOG_COMPONENT_DEFINE ("OrchestratorNodeInfoStorage");
 namespace ns3{
@@ -61,67 +65,126 @@ namespace ns3{
       return tid;
     }
 
-    OrchestratorNodeInfoStorage::OrchestratorNodeInfoStorage(){
+    OrchestratorNodeInfoStorage::OrchestratorNodeInfoStorage()
+        : m_table(std::make_shared<NodeInfoTable>())
+        , m_epoch(1)
+        , m_frozen(false)
+    {
         NS_LOG_FUNCTION (this);
     }
 
     OrchestratorNodeInfoStorage::~OrchestratorNodeInfoStorage(){
         NS_LOG_FUNCTION (this);
     }
-    map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode> OrchestratorNodeInfoStorage::m_nodeInfoTable;
 
-    std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_iterator
-    OrchestratorNodeInfoStorage::cbegin()
+    Ptr<OrchestratorNodeInfoStorage>
+    OrchestratorNodeInfoStorage::GetStorage(Ptr<Node> node)
+    {
+        Ptr<OrchestratorNodeInfoStorage> storage = node->GetObject<OrchestratorNodeInfoStorage>();
+        if(storage == 0)
+        {
+            storage = CreateObject<OrchestratorNodeInfoStorage>();
+            node->AggregateObject(storage);
+        }
+        return storage;
+    }
+    std::unordered_map<std::string, uint32_t> OrchestratorNodeInfoStorage::m_vertexIndex;
+    std::vector<std::vector<std::pair<uint32_t, int32_t>>> OrchestratorNodeInfoStorage::m_adjacency;
+    std::vector<int32_t> OrchestratorNodeInfoStorage::m_distance;
+    uint32_t OrchestratorNodeInfoStorage::m_vertices = 0;
+
+    const NodeInfoTable&
+    OrchestratorNodeInfoStorage::getTable() const
+    {
+        return *m_table;
+    }
+
+    const NodeInfoTable&
+    OrchestratorNodeInfoStorage::table() const
+    {
+        return *m_table;
+    }
+
+    NodeInfoTable&
+    OrchestratorNodeInfoStorage::writableTable()
     {
-        return m_nodeInfoTable.cbegin();
+        //the first update after a snapshot opens the next epoch,
+        //the table is copied once if a snapshot of the closed epoch is still held
+        if(m_frozen)
+        {
+            m_epoch++;
+            m_frozen = false;
+        }
+        if(m_table.use_count() > 1)
+        {
+            NS_LOG_DEBUG("Copying the node info table for epoch " << m_epoch);
+            m_table = std::make_shared<NodeInfoTable>(*m_table);
+        }
+        return *m_table;
     }
 
-    std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_iterator
-    OrchestratorNodeInfoStorage::cend()
+    NodeInfoSnapshot
+    OrchestratorNodeInfoStorage::takeSnapshot()
     {
-        return m_nodeInfoTable.cend();
+        m_frozen = true;
+        return NodeInfoSnapshot(m_epoch, m_table);
     }
 
-    std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_reverse_iterator
-    OrchestratorNodeInfoStorage::crbegin()
+    uint64_t
+    OrchestratorNodeInfoStorage::getEpoch() const
     {
-        return m_nodeInfoTable.crbegin();
+        return m_epoch;
     }
 
-    std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_reverse_iterator
-    OrchestratorNodeInfoStorage::crend()
+    uint32_t
+    OrchestratorNodeInfoStorage::findNode(const std::string& nodeID)
     {
-        return m_nodeInfoTable.crend();
+        uint32_t node = table().FindNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            NS_LOG_WARN("Node " << nodeID << " not found");
+        return node;
     }
 
+    uint32_t
+    OrchestratorNodeInfoStorage::findFunction(const std::string& nodeID, uint32_t index, bool defaultvalue, uint32_t& node)
+    {
+        node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return NodeInfoTable::NOT_FOUND;
+        const std::vector<uint32_t>& functions = table().GetNodeFunctions(node, defaultvalue);
+        if(index >= functions.size())
+        {
+            NS_LOG_WARN("Node " << nodeID << " has no function " << index);
+            return NodeInfoTable::NOT_FOUND;
+        }
+        return functions[index];
+    }
 
 //Node info
     OrchestratorNodeInfoStorage::computeNode
-    OrchestratorNodeInfoStorage::getNodeInfo(std::string nodeID)
+    OrchestratorNodeInfoStorage::getNodeInfo(const std::string& nodeID)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            return itr->second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return computeNode();
+        return table().GetNode(node);
     }
 
     void
-    OrchestratorNodeInfoStorage::printCurrentNodeInfo(std::string nodeID)
+    OrchestratorNodeInfoStorage::printCurrentNodeInfo(const std::string& nodeID)
     {
         std::cout<<"Print Current Node Info";
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            std::cout<< "Name : "<<(itr->second).nodeName<<std::endl
-            <<"CPU :"<<(itr->second).cpu.second<<std::endl
-            <<"RAM :"<<(itr->second).ram.second<<std::endl
-            <<"ROM :"<<(itr->second).rom.second<<std::endl;
-            for(auto i = (itr->second.functions_current).begin(); i != ((itr->second).functions_current).end(); i++)
-                std::cout<<"Function Info ="<<i->funcName<<"-"<<i->status<<":"<<i->func_exe_counter<<";"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if (node != NodeInfoTable::NOT_FOUND){
+            std::cout<< "Name : "<<table().NodeName(node)<<std::endl
+            <<"CPU :"<<table().Cpu(node).second<<std::endl
+            <<"RAM :"<<table().Ram(node).second<<std::endl
+            <<"ROM :"<<table().Rom(node).second<<std::endl;
+            for(uint32_t function : table().GetNodeFunctions(node, false))
+            {
+                const NodeInfoTable::functionCell& cell = table().Cell(node, function, false);
+                std::cout<<"Function Info ="<<table().GetFunctionName(function)<<"-"<<cell.status<<":"<<cell.func_exe_counter<<";"<<std::endl;
+            }
         }
         else{
             std::cout<<"Node not found"<<std::endl;
@@ -129,18 +192,20 @@ namespace ns3{
     }
 
     void
-    OrchestratorNodeInfoStorage::printDefaultNodeInfo(std::string nodeID)
+    OrchestratorNodeInfoStorage::printDefaultNodeInfo(const std::string& nodeID)
     {
         std::cout<<"Print Default Node Info"<<std::endl;
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            std::cout<< "Name : "<<(itr->second).nodeName<<std::endl
-            <<"CPU :"<<(itr->second).cpu.first<<std::endl
-            <<"RAM :"<<(itr->second).ram.first<<std::endl
-            <<"ROM :"<<(itr->second).rom.first<<std::endl;
-            for(auto i = (itr->second.functions_current).begin(); i != ((itr->second).functions_current).end(); i++)
-                std::cout<<"Function Info ="<<i->funcName<<"-"<<i->status<<":"<<i->func_exe_counter<<";"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if (node != NodeInfoTable::NOT_FOUND){
+            std::cout<< "Name : "<<table().NodeName(node)<<std::endl
+            <<"CPU :"<<table().Cpu(node).first<<std::endl
+            <<"RAM :"<<table().Ram(node).first<<std::endl
+            <<"ROM :"<<table().Rom(node).first<<std::endl;
+            for(uint32_t function : table().GetNodeFunctions(node, false))
+            {
+                const NodeInfoTable::functionCell& cell = table().Cell(node, function, false);
+                std::cout<<"Function Info ="<<table().GetFunctionName(function)<<"-"<<cell.status<<":"<<cell.func_exe_counter<<";"<<std::endl;
+            }
         }
         else{
             std::cout<<"Node not found"<<std::endl;
@@ -148,849 +213,853 @@ namespace ns3{
     }
 
     bool
-    OrchestratorNodeInfoStorage::AddNodeToTable(std::string nodeID, computeNode nodeToAdd)
+    OrchestratorNodeInfoStorage::AddNodeToTable(const std::string& nodeID, const computeNode& nodeToAdd)
     {
-        pair <map<std::string, computeNode>::iterator, bool> itr;
-        itr = m_nodeInfoTable.insert(std::pair<std::string, computeNode>(nodeID,nodeToAdd));
-        //std::cout<<"Node Table updated :"<<m_nodeInfoTable.size();
-        return itr.second;
+        return writableTable().AddNode(nodeID, nodeToAdd) != NodeInfoTable::NOT_FOUND;
+    }
+
+    bool
+    OrchestratorNodeInfoStorage::updateNodeStatus(const std::string& nodeID, const computeNode& status)
+    {
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return false;
+        NodeInfoTable& table = writableTable();
+        table.Cpu(node).second = status.cpu.second;
+        table.Ram(node).second = status.ram.second;
+        table.Rom(node).second = status.rom.second;
+        table.BusyCounter(node).second = status.nodeBusyCounter.second;
+        table.Links(node, false) = status.links.second;
+        table.Runtimes(node, false) = status.runtimes_supported.second;
+        if(!status.data_current.empty())
+            table.Data(node, false) = status.data_current;
+        for(auto& func : status.functions_current)
+        {
+            uint32_t function = table.FindFunction(func.funcName.toUri());
+            if(function != NodeInfoTable::NOT_FOUND && table.Cell(node, function, false).position != NodeInfoTable::NOT_FOUND)
+                table.SetFunctionInfo(node, function, func, false);
+        }
+        return true;
     }
 
     uint32_t
     OrchestratorNodeInfoStorage::getTableSize()
     {
-        return m_nodeInfoTable.size();
+        return table().GetNodeCount();
     }
 
     Name
-    OrchestratorNodeInfoStorage::getNodeName(std::string nodeID)
+    OrchestratorNodeInfoStorage::getNodeName(const std::string& nodeID)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            return (itr->second).nodeName;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return Name();
+        return table().NodeName(node);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeName(std::string nodeID,Name nameToSet)
+    OrchestratorNodeInfoStorage::setNodeName(const std::string& nodeID, Name nameToSet)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            (itr->second).nodeName = nameToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().NodeName(node) = nameToSet;
+        return true;
     }
 
     Ptr<ns3::ndn::inc::IncOrchestrationComputeNode>
-    OrchestratorNodeInfoStorage::getNodePointer(std::string nodeID)
+    OrchestratorNodeInfoStorage::getNodePointer(const std::string& nodeID)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            return (itr->second).node_ptr;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return 0;
+        return table().NodePointer(node);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodePointer(std::string nodeID,Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> pointerToSet)
+    OrchestratorNodeInfoStorage::setNodePointer(const std::string& nodeID, Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> pointerToSet)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            (itr->second).node_ptr = pointerToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().NodePointer(node) = pointerToSet;
+        return true;
     }
 
-    uint32_t
-    OrchestratorNodeInfoStorage::getNodeRAM(std::string nodeID, bool defaultvalue=true)
+namespace {
+    inline uint32_t&
+    pick(std::pair<uint32_t, uint32_t>& value, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)return (itr->second).ram.first;
-            if (defaultvalue == false)return (itr->second).ram.second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return 0;
-        }
+        return defaultvalue ? value.first : value.second;
+    }
 
+    inline uint32_t
+    pick(const std::pair<uint32_t, uint32_t>& value, bool defaultvalue)
+    {
+        return defaultvalue ? value.first : value.second;
+    }
+
+    const std::vector<std::string> EMPTY_STRINGS;
+    const std::vector<OrchestratorNodeInfoStorage::dataInfo> EMPTY_DATA;
+}
+
+    uint32_t
+    OrchestratorNodeInfoStorage::getNodeRAM(const std::string& nodeID, bool defaultvalue)
+    {
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? 0 : pick(table().Ram(node), defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeRAM(std::string nodeID, uint32_t ramToSet, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setNodeRAM(const std::string& nodeID, uint32_t ramToSet, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)(itr->second).ram.first = ramToSet;
-            if (defaultvalue == false)(itr->second).ram.second = ramToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        pick(writableTable().Ram(node), defaultvalue) = ramToSet;
+        return true;
     }
 
     uint32_t
-    OrchestratorNodeInfoStorage::getNodeROM(std::string nodeID, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getNodeROM(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)return (itr->second).rom.first;
-            if (defaultvalue == false)return (itr->second).rom.second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return 0;
-        }
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? 0 : pick(table().Rom(node), defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeROM(std::string nodeID, uint32_t romToSet, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setNodeROM(const std::string& nodeID, uint32_t romToSet, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)(itr->second).rom.first=romToSet;
-            if (defaultvalue == false)(itr->second).rom.second=romToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        pick(writableTable().Rom(node), defaultvalue) = romToSet;
+        return true;
     }
 
     uint32_t
-    OrchestratorNodeInfoStorage::getNodeBusyCounter(std::string nodeID, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getNodeBusyCounter(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)return (itr->second).nodeBusyCounter.first;
-            if (defaultvalue == false)return (itr->second).nodeBusyCounter.second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return 0;
-        }
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? 0 : pick(table().BusyCounter(node), defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeBusyCounter(std::string nodeID, uint32_t nbToSet, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setNodeBusyCounter(const std::string& nodeID, uint32_t nbToSet, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)(itr->second).nodeBusyCounter.first=nbToSet;
-            if (defaultvalue == false)(itr->second).nodeBusyCounter.second=nbToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        pick(writableTable().BusyCounter(node), defaultvalue) = nbToSet;
+        return true;
     }
 
-
     uint32_t
-    OrchestratorNodeInfoStorage::getNodeCPU(std::string nodeID, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getNodeCPU(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)return (itr->second).cpu.first;
-            if (defaultvalue == false)return (itr->second).cpu.second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return 0;
-        }
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? 0 : pick(table().Cpu(node), defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeCPU(std::string nodeID, uint32_t cpuToSet, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setNodeCPU(const std::string& nodeID, uint32_t cpuToSet, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)(itr->second).cpu.first=cpuToSet;
-            if (defaultvalue == false)(itr->second).ram.second=cpuToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        pick(writableTable().Cpu(node), defaultvalue) = cpuToSet;
+        return true;
     }
 
-    std::vector<std::string>
-    OrchestratorNodeInfoStorage::getNodeLinks(std::string nodeID, bool defaultvalue=true)
+    const std::vector<std::string>&
+    OrchestratorNodeInfoStorage::getNodeLinks(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)return (itr->second).links.first;
-            if (defaultvalue == false)return (itr->second).links.second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? EMPTY_STRINGS : table().Links(node, defaultvalue);
     }
 
-        bool
-    OrchestratorNodeInfoStorage::setNodeLinks(std::string nodeID, std::vector<std::string> linksToSet, bool defaultvalue=true)
+    bool
+    OrchestratorNodeInfoStorage::setNodeLinks(const std::string& nodeID, const std::vector<std::string>& linksToSet, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)(itr->second).links.first=linksToSet;
-            if (defaultvalue == false)(itr->second).links.second=linksToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Links(node, defaultvalue) = linksToSet;
+        return true;
     }
 
     bool
-    OrchestratorNodeInfoStorage::addLinkToNode(std::string nodeID, string linkToAdd, bool defaultvalue=false)
+    OrchestratorNodeInfoStorage::addLinkToNode(const std::string& nodeID, const std::string& linkToAdd, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if(defaultvalue==true)
-            ((itr->second).links.first).push_back(linkToAdd);
-            else
-            ((itr->second).links.second).push_back(linkToAdd);
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Links(node, defaultvalue).push_back(linkToAdd);
+        return true;
     }
 
-    std::vector<std::string>
-    OrchestratorNodeInfoStorage::getNodeRuntimes(std::string nodeID, bool defaultvalue=true)
+    const std::vector<std::string>&
+    OrchestratorNodeInfoStorage::getNodeRuntimes(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)return (itr->second).runtimes_supported.first;
-            if (defaultvalue == false)return (itr->second).runtimes_supported.second;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? EMPTY_STRINGS : table().Runtimes(node, defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeRuntimes(std::string nodeID, std::vector<std::string>rtToSet, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setNodeRuntimes(const std::string& nodeID, const std::vector<std::string>& rtToSet, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if (defaultvalue == true)(itr->second).runtimes_supported.first=rtToSet;
-            if (defaultvalue == false)(itr->second).runtimes_supported.second=rtToSet;
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Runtimes(node, defaultvalue) = rtToSet;
+        return true;
     }
 
     bool
-    OrchestratorNodeInfoStorage::addRuntimeToNode(std::string nodeID, string rtToAdd, bool defaultvalue=false)
+    OrchestratorNodeInfoStorage::addRuntimeToNode(const std::string& nodeID, const std::string& rtToAdd, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if(defaultvalue==true)((itr->second).runtimes_supported.first).push_back(rtToAdd);
-            if(defaultvalue==false)((itr->second).runtimes_supported.second).push_back(rtToAdd);
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Runtimes(node, defaultvalue).push_back(rtToAdd);
+        return true;
     }
 
     std::vector<OrchestratorNodeInfoStorage::functionInfo>
-    OrchestratorNodeInfoStorage::getFunctionsAtNode(std::string nodeID, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getFunctionsAtNode(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-            if(defaultvalue==true)return (itr->second).functions_initial;
-            if(defaultvalue==false)return (itr->second).functions_current;
-        }
-
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+        std::vector<functionInfo> functions;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return functions;
+        for(uint32_t function : table().GetNodeFunctions(node, defaultvalue))
+            functions.push_back(table().GetFunctionInfo(node, function, defaultvalue));
+        return functions;
     }
 
     bool
-    OrchestratorNodeInfoStorage::addFunctionToNode(std::string nodeID, functionInfo funcToAdd, bool defaultvalue = false)
+    OrchestratorNodeInfoStorage::addFunctionToNode(const std::string& nodeID, const functionInfo& funcToAdd, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if(defaultvalue==true)((itr->second).functions_initial).push_back(funcToAdd);
-            if(defaultvalue==false)((itr->second).functions_current).push_back(funcToAdd);
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        NodeInfoTable& table = writableTable();
+        uint32_t function = table.AddFunction(funcToAdd.funcName);
+        table.AttachFunction(node, function, defaultvalue);
+        table.SetFunctionInfo(node, function, funcToAdd, defaultvalue);
+        return true;
     }
 
-    std::vector<OrchestratorNodeInfoStorage::dataInfo>
-    OrchestratorNodeInfoStorage::getDataAtNode(std::string nodeID, bool defaultvalue=true)
+    const std::vector<OrchestratorNodeInfoStorage::dataInfo>&
+    OrchestratorNodeInfoStorage::getDataAtNode(const std::string& nodeID, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-            if(defaultvalue==true)return (itr->second).data_initial;
-            if(defaultvalue==false)return (itr->second).data_current;
-        }
+        uint32_t node = findNode(nodeID);
+        return node == NodeInfoTable::NOT_FOUND ? EMPTY_DATA : table().Data(node, defaultvalue);
+    }
 
-        else{
-            std::cout<<"Node not found"<<std::endl;
-        }
+    const std::vector<OrchestratorNodeInfoStorage::dataInfo>&
+    OrchestratorNodeInfoStorage::getNodeDataList(const std::string& nodeID, bool defaultvalue)
+    {
+        return getDataAtNode(nodeID, defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::addDataToNode(std::string nodeID, dataInfo dataToAdd, bool defaultvalue = false)
+    OrchestratorNodeInfoStorage::addDataToNode(const std::string& nodeID, const dataInfo& dataToAdd, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if(defaultvalue==true)((itr->second).data_initial).push_back(dataToAdd);
-            if(defaultvalue==false)((itr->second).data_current).push_back(dataToAdd);
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
+            return false;
+        writableTable().Data(node, defaultvalue).push_back(dataToAdd);
+        return true;
+    }
+
+    bool
+    OrchestratorNodeInfoStorage::setNodeDataList(const std::string& nodeID, const std::vector<dataInfo>& data_list, bool defaultvalue)
+    {
+        uint32_t node = findNode(nodeID);
+        if(node == NodeInfoTable::NOT_FOUND)
             return false;
+        writableTable().Data(node, defaultvalue) = data_list;
+        return true;
+    }
+
+    static const int32_t HOP_DISTANCE_INFINITY = std::numeric_limits<int32_t>::max();
+
+    uint32_t
+    OrchestratorNodeInfoStorage::get_vertex(std::string node, bool create)
+    {
+        auto it = m_vertexIndex.find(node);
+        if(it != m_vertexIndex.end())
+            return it->second;
+        if(!create)
+            return m_vertices;
+        uint32_t vertex = m_vertices;
+        m_vertexIndex[node] = vertex;
+        resize_distance(m_vertices + 1);
+        return vertex;
+    }
+
+    void
+    OrchestratorNodeInfoStorage::resize_distance(uint32_t vertices)
+    {
+        std::vector<int32_t> distance(static_cast<size_t>(vertices) * vertices, HOP_DISTANCE_INFINITY);
+        for(uint32_t i = 0; i < vertices; i++)
+        {
+            for(uint32_t j = 0; j < vertices; j++)
+            {
+                if(i == j)
+                    distance[static_cast<size_t>(i) * vertices + j] = 0;
+                else if(i < m_vertices && j < m_vertices)
+                    distance[static_cast<size_t>(i) * vertices + j] = m_distance[static_cast<size_t>(i) * m_vertices + j];
+            }
         }
+        m_distance.swap(distance);
+        m_adjacency.resize(vertices);
+        m_vertices = vertices;
+    }
+
+    void
+    OrchestratorNodeInfoStorage::clear_hop_distance()
+    {
+        m_vertexIndex.clear();
+        m_adjacency.clear();
+        m_distance.clear();
+        m_vertices = 0;
     }
 
     bool
-    OrchestratorNodeInfoStorage::setNodeDataList(std::string nodeID, std::vector<dataInfo> data_list, bool defaultvalue = false)
+    OrchestratorNodeInfoStorage::has_unit_weights()
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if(itr!=m_nodeInfoTable.end())
+        for(auto& edges : m_adjacency)
         {
-            if(defaultvalue == true)
+            for(auto& edge : edges)
             {
-                itr->second.data_initial.clear();
-                for(auto iter = data_list.begin(); iter!= data_list.end(); iter++)
-                    itr->second.data_initial.push_back(*iter);
-                return true;
+                if(edge.second != 1)
+                    return false;
             }
-            else if (defaultvalue == false)
+        }
+        return true;
+    }
+
+    void
+    OrchestratorNodeInfoStorage::shortest_paths(uint32_t source, bool unitWeights)
+    {
+        int32_t* row = &m_distance[static_cast<size_t>(source) * m_vertices];
+        std::fill(row, row + m_vertices, HOP_DISTANCE_INFINITY);
+        row[source] = 0;
+        if(unitWeights)
+        {
+            std::vector<uint32_t> queue;
+            queue.reserve(m_vertices);
+            queue.push_back(source);
+            for(size_t head = 0; head < queue.size(); head++)
             {
-                itr->second.data_current.clear();
-                for(auto iter = data_list.begin(); iter!= data_list.end(); iter++)
-                    itr->second.data_current.push_back(*iter);
-                return true;
+                uint32_t v = queue[head];
+                for(auto& edge : m_adjacency[v])
+                {
+                    if(row[edge.first] == HOP_DISTANCE_INFINITY)
+                    {
+                        row[edge.first] = row[v] + 1;
+                        queue.push_back(edge.first);
+                    }
+                }
             }
+            return;
         }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return false;
+        typedef std::pair<int32_t, uint32_t> entry;
+        std::priority_queue<entry, std::vector<entry>, std::greater<entry>> heap;
+        heap.push(std::make_pair(0, source));
+        while(!heap.empty())
+        {
+            entry top = heap.top();
+            heap.pop();
+            if(top.first > row[top.second])
+                continue;
+            for(auto& edge : m_adjacency[top.second])
+            {
+                int64_t candidate = static_cast<int64_t>(top.first) + edge.second;
+                if(candidate < row[edge.first])
+                {
+                    row[edge.first] = static_cast<int32_t>(candidate);
+                    heap.push(std::make_pair(row[edge.first], edge.first));
+                }
+            }
         }
     }
 
     bool
     OrchestratorNodeInfoStorage::calculate_hop_distance()
     {
-        boost::NdnGlobalRouterGraph graph;
-        //std::cout<<"Node list size is "<< NodeList::GetNNodes()<<std::endl;
-        //std::cout<<"m_nodeInfoTable size is"<<m_nodeInfoTable.size()<<std::endl;
-        map<std::string, computeNode>::iterator itr1;
-        for (itr1 = m_nodeInfoTable.begin(); itr1 != m_nodeInfoTable.end(); itr1++)
+        //the topology is static and the matrix is shared, the first orchestrator computes it for all shards
+        if(m_vertices > 0)
+            return true;
+        m_vertices = NodeList::GetNNodes();
+        m_adjacency.assign(m_vertices, std::vector<std::pair<uint32_t, int32_t>>());
+        m_distance.assign(static_cast<size_t>(m_vertices) * m_vertices, HOP_DISTANCE_INFINITY);
+        Simulator::ScheduleDestroy(&OrchestratorNodeInfoStorage::clear_hop_distance);
+
+        //vertex = ns-3 node ID, keyed by the name the nodes report to the orchestrator
+        for(uint32_t i = 0; i < NodeList::GetNNodes(); i++)
         {
-            //ns3::Ptr<ns3::Node> src_node = NodeList::GetNode(i);
-            //std::cout<<"first node in the table is "<<itr1->first<<std::endl;
-            string src_node_name =itr1->first;
-            src_node_name.erase(0,1);
-            ns3::Ptr<ns3::Node> src_node = Names::Find<Node>(src_node_name);
-            //std::cout<<"src node is "<<src_node->GetId();
-            Ptr<GlobalRouter> source = src_node->GetObject<GlobalRouter>();
-            if (source == 0)
+            Ptr<Node> node = NodeList::GetNode(i);
+            std::string name = Names::FindName(node);
+            if(!name.empty())
+                m_vertexIndex[Name(name).toUri()] = node->GetId();
+
+            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+            if(router == 0)
             {
-                std::cout<<"Node " << src_node->GetId() << " does not export GlobalRouter interface"<<std::endl;
+                NS_LOG_DEBUG("Node " << node->GetId() << " does not export GlobalRouter interface");
                 continue;
             }
-            //std::cout<<"Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
-              //                                      << Names::FindName(source->GetObject<Node>()) << ")"<<std::endl;
-            boost::DistancesMap distances;
-            dijkstra_shortest_paths(graph, source,
-                              // predecessor_map (boost::ref(predecessors))
-                              // .
-                                distance_map(boost::ref(distances))
-                                .distance_inf(boost::WeightInf)
-                                .distance_zero(boost::WeightZero)
-                                .distance_compare(boost::WeightCompare())
-                                .distance_combine(boost::WeightCombine()));
-
-            for (const auto& dist : distances)
+            for(const auto& incidency : router->GetIncidencies())
             {
-                ns3::Ptr<ns3::Node> dest_node = NodeList::GetNode(dist.first->GetId());
-                Name dest_node_name = Names::FindName(dest_node);
-                Name src_node_name = Names::FindName(src_node);
-                map<std::string, computeNode>::iterator itr2;
-                for(itr2 = m_nodeInfoTable.begin(); itr2 != m_nodeInfoTable.end(); itr2++)
-                {
-                    if(dest_node_name == (src_node_name))
-                    {
-                        ((itr1->second).hop_distance).insert(std::make_pair(dest_node_name.toUri(), 0));
-                        break;
-                    }
-                    else if(dest_node_name == itr2->second.nodeName)
-                    {
-                       ((itr1->second).hop_distance).insert(std::make_pair(dest_node_name.toUri(), std::get<1>(dist.second)));
-                       break;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                }
+                Ptr<Node> neighbour = std::get<2>(incidency)->GetObject<Node>();
+                m_adjacency[node->GetId()].push_back(
+                    std::make_pair(neighbour->GetId(), static_cast<int32_t>(std::get<1>(incidency)->getMetric())));
             }
         }
-        map<std::string, computeNode>::iterator mapIt;
-        for(mapIt= m_nodeInfoTable.begin(); mapIt != m_nodeInfoTable.end(); mapIt++)
+
+        //rows are independent, so the sources are split over worker threads
+        bool unitWeights = has_unit_weights();
+        uint32_t workers = std::max(1u, std::min<uint32_t>(std::thread::hardware_concurrency(), m_vertices / 64));
+        std::vector<std::thread> threads;
+        for(uint32_t w = 0; w < workers; w++)
         {
-            std::set<std::pair<std::string, int>>::iterator setIt;
-            //for(setIt = mapIt->second.hop_distance.begin(); setIt != mapIt->second.hop_distance.end(); setIt++)
-              //  std::cout<< "The hop distance from Node "<< mapIt->second.nodeName <<" to "<<(*setIt).first << " is " << (*setIt).second<<std::endl;
-        }
+            threads.emplace_back([w, workers, unitWeights]() {
+                for(uint32_t source = w; source < m_vertices; source += workers)
+                    shortest_paths(source, unitWeights);
+            });
+        }
+        for(auto& thread : threads)
+            thread.join();
+        NS_LOG_INFO("Hop distances of " << m_vertices << " nodes calculated with " << workers << " threads");
         return true;
     }
 
     int
     OrchestratorNodeInfoStorage::get_distance(std::string src_node, std::string dest_node)
     {
-        map<std::string, computeNode>::iterator mapIt;
         if(src_node == dest_node)
-        return 0;
-        for(mapIt = m_nodeInfoTable.begin(); mapIt != m_nodeInfoTable.end(); mapIt++)
+            return 0;
+        uint32_t src = get_vertex(src_node, false);
+        uint32_t dest = get_vertex(dest_node, false);
+        if(src >= m_vertices || dest >= m_vertices)
+            return 0;
+        int32_t distance = m_distance[static_cast<size_t>(src) * m_vertices + dest];
+        return distance == HOP_DISTANCE_INFINITY ? 0 : distance;
+    }
+
+    void
+    OrchestratorNodeInfoStorage::repair_link_removal(uint32_t a, uint32_t b, int32_t metric)
+    {
+        //only sources whose shortest path tree contains the link can change
+        bool unitWeights = has_unit_weights();
+        for(uint32_t source = 0; source < m_vertices; source++)
         {
-            if(src_node == (*mapIt).first)
+            int32_t to_a = m_distance[static_cast<size_t>(source) * m_vertices + a];
+            int32_t to_b = m_distance[static_cast<size_t>(source) * m_vertices + b];
+            if(to_a != HOP_DISTANCE_INFINITY && to_b != HOP_DISTANCE_INFINITY &&
+               static_cast<int64_t>(to_a) + metric == to_b)
             {
-                std::set<std::pair<std::string, int>>::iterator setIt;
-                for(setIt = mapIt->second.hop_distance.begin(); setIt != mapIt->second.hop_distance.end(); setIt++)
-                {
-                    if(dest_node == setIt->first)
-                    {
-                        return setIt->second;
-                    }
-                    else
-                    {
-                        continue;
-                    }
-                }
-                return 0;
+                shortest_paths(source, unitWeights);
             }
         }
-
     }
 
-
-    //Function Info
-    OrchestratorNodeInfoStorage::functionInfo
-    OrchestratorNodeInfoStorage::getFuncInfo(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    bool
+    OrchestratorNodeInfoStorage::update_link(std::string node_a, std::string node_b, int metric)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if(defaultvalue==true)return ((itr->second).functions_initial).at(index);
-            if(defaultvalue==false)return((itr->second).functions_current).at(index);
+        //calculate_hop_distance skips a matrix that already exists, so it must be built first
+        if(m_vertices == 0 || metric <= 0 || node_a == node_b)
+            return false;
+        uint32_t a = get_vertex(node_a, true);
+        uint32_t b = get_vertex(node_b, true);
+        for(auto link : {std::make_pair(a, b), std::make_pair(b, a)})
+        {
+            std::vector<std::pair<uint32_t, int32_t>>& edges = m_adjacency[link.first];
+            auto edge = std::find_if(edges.begin(), edges.end(),
+                                     [&link](const std::pair<uint32_t, int32_t>& e) { return e.first == link.second; });
+            int32_t old_metric = HOP_DISTANCE_INFINITY;
+            if(edge == edges.end())
+                edges.push_back(std::make_pair(link.second, metric));
+            else
+            {
+                old_metric = edge->second;
+                edge->second = metric;
             }
-        else
-            std::cout<<"Node not found"<<std::endl;
-    }
 
-    std::pair<bool, uint32_t>
-    OrchestratorNodeInfoStorage::getFuncIndex(std::string nodeID, std::string funcName, bool defaultvalue)
-    {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end()){
-            if(defaultvalue==true)
+            if(metric > old_metric)
             {
-                for(uint32_t i=0;i<(itr->second).functions_initial.size();i++)
-                {
-                    if(funcName.compare(((itr->second).functions_initial.at(i)).funcName.toUri())==0)
-                        return std::make_pair(true,i);
-                }
-                return std::make_pair(false,0);
+                repair_link_removal(link.first, link.second, old_metric);
             }
-            else
+            else if(metric < old_metric)
             {
-                for(uint32_t i=0;i<(itr->second).functions_current.size();i++)
+                //a shorter link can only shorten paths s -> link.first -> link.second -> t
+                for(uint32_t s = 0; s < m_vertices; s++)
                 {
-                    if(funcName.compare(((itr->second).functions_current.at(i)).funcName.toUri())==0)
-                        return std::make_pair(true, i);
+                    int32_t to_first = m_distance[static_cast<size_t>(s) * m_vertices + link.first];
+                    if(to_first == HOP_DISTANCE_INFINITY)
+                        continue;
+                    int32_t* row = &m_distance[static_cast<size_t>(s) * m_vertices];
+                    const int32_t* from_second = &m_distance[static_cast<size_t>(link.second) * m_vertices];
+                    for(uint32_t t = 0; t < m_vertices; t++)
+                    {
+                        if(from_second[t] == HOP_DISTANCE_INFINITY)
+                            continue;
+                        int64_t candidate = static_cast<int64_t>(to_first) + metric + from_second[t];
+                        if(candidate < row[t])
+                            row[t] = static_cast<int32_t>(candidate);
+                    }
                 }
-                return std::make_pair(false, 0);
             }
         }
-
+        return true;
     }
 
     bool
-    OrchestratorNodeInfoStorage::setFuncInfo(std::string nodeID, uint32_t index, functionInfo funcToUpdate, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::remove_link(std::string node_a, std::string node_b)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
+        uint32_t a = get_vertex(node_a, false);
+        uint32_t b = get_vertex(node_b, false);
+        if(a >= m_vertices || b >= m_vertices)
+            return false;
+        bool removed = false;
+        for(auto link : {std::make_pair(a, b), std::make_pair(b, a)})
         {
-          if (defaultvalue==true)
-          {
-            ((itr->second).functions_initial).at(index).funcName = funcToUpdate.funcName;
-            ((itr->second).functions_initial).at(index).func_exe_counter = funcToUpdate.func_exe_counter;
-            ((itr->second).functions_initial).at(index).func_interest_counter = funcToUpdate.func_interest_counter;
-            ((itr->second).functions_initial).at(index).status = funcToUpdate.status;
-            ((itr->second).functions_initial).at(index).exec_time = funcToUpdate.exec_time;
-            ((itr->second).functions_initial).at(index).cores = funcToUpdate.cores;
-            ((itr->second).functions_initial).at(index).ram = funcToUpdate.ram;
-            ((itr->second).functions_initial).at(index).rom = funcToUpdate.rom;
-            ((itr->second).functions_initial).at(index).size_bytes = funcToUpdate.size_bytes;
-            return true;
-          }
-          else
-          {
-            ((itr->second).functions_current).at(index).funcName = funcToUpdate.funcName;
-            ((itr->second).functions_current).at(index).func_exe_counter = funcToUpdate.func_exe_counter;
-            ((itr->second).functions_current).at(index).func_interest_counter = funcToUpdate.func_interest_counter;
-            ((itr->second).functions_current).at(index).status = funcToUpdate.status;
-            ((itr->second).functions_current).at(index).exec_time = funcToUpdate.exec_time;
-            ((itr->second).functions_current).at(index).cores = funcToUpdate.cores;
-            ((itr->second).functions_current).at(index).ram = funcToUpdate.ram;
-            ((itr->second).functions_current).at(index).rom = funcToUpdate.rom;
-            ((itr->second).functions_current).at(index).size_bytes = funcToUpdate.size_bytes;
-            (((itr->second).functions_current).at(index).input_data_list).clear();
-            std::vector<std::string>::iterator itr1;
-            for(itr1 = funcToUpdate.input_data_list.begin(); itr1!= funcToUpdate.input_data_list.end(); itr1++)
-                (((itr->second).functions_current).at(index).input_data_list).push_back(*itr1);
-            return true;
-          }
+            std::vector<std::pair<uint32_t, int32_t>>& edges = m_adjacency[link.first];
+            auto edge = std::find_if(edges.begin(), edges.end(),
+                                     [&link](const std::pair<uint32_t, int32_t>& e) { return e.first == link.second; });
+            if(edge == edges.end())
+                continue;
+            int32_t metric = edge->second;
+            edges.erase(edge);
+            repair_link_removal(link.first, link.second, metric);
+            removed = true;
         }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        return removed;
+    }
+
+    bool
+    OrchestratorNodeInfoStorage::remove_node(std::string node)
+    {
+        uint32_t v = get_vertex(node, false);
+        if(v >= m_vertices)
             return false;
+        //the node keeps its vertex, it is only cut off from the topology
+        std::vector<uint32_t> neighbours;
+        for(auto& edge : m_adjacency[v])
+            neighbours.push_back(edge.first);
+        for(uint32_t u = 0; u < m_vertices; u++)
+        {
+            for(auto& edge : m_adjacency[u])
+            {
+                if(edge.first == v && std::find(neighbours.begin(), neighbours.end(), u) == neighbours.end())
+                    neighbours.push_back(u);
+            }
+        }
+        for(uint32_t u : neighbours)
+        {
+            std::vector<std::pair<uint32_t, int32_t>>& edges = m_adjacency[u];
+            auto edge = std::find_if(edges.begin(), edges.end(),
+                                     [v](const std::pair<uint32_t, int32_t>& e) { return e.first == v; });
+            if(edge == edges.end())
+                continue;
+            int32_t metric = edge->second;
+            edges.erase(edge);
+            repair_link_removal(u, v, metric);
         }
+        for(auto& edge : std::vector<std::pair<uint32_t, int32_t>>(m_adjacency[v]))
+        {
+            m_adjacency[v].erase(std::find(m_adjacency[v].begin(), m_adjacency[v].end(), edge));
+            repair_link_removal(v, edge.first, edge.second);
+        }
+        return true;
     }
 
-    Name
-    OrchestratorNodeInfoStorage::getFuncName(std::string nodeID, uint32_t index, bool defaultvalue = true)
+
+    //Shard Info
+    OrchestratorNodeInfoStorage::shardSummary
+    OrchestratorNodeInfoStorage::getShardSummary(std::string shard)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
+        shardSummary summary;
+        summary.shard = shard;
+        summary.nodes = table().GetNodeCount();
+        summary.cores = 0;
+        summary.busy = 0;
+        std::vector<functionSummary> functions(table().GetFunctionCount(), functionSummary());
+        std::vector<bool> reported(table().GetFunctionCount(), false);
+        for(uint32_t node = 0; node < table().GetNodeCount(); node++)
         {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).funcName;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).funcName;
+            summary.cores += table().Cpu(node).first;
+            summary.busy += table().BusyCounter(node).second;
+            const NodeInfoTable::functionCell* row = table().GetRow(node, false);
+            for(uint32_t function = 0; function < table().GetFunctionCount(); function++)
+            {
+                if(row[function].position == NodeInfoTable::NOT_FOUND)
+                    continue;
+                reported[function] = true;
+                functions[function].instances += row[function].status ? 1 : 0;
+                functions[function].executions += row[function].func_exe_counter;
+                functions[function].missed += row[function].func_interest_counter;
+            }
         }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return 0;
+        //ordered by name, as before the table was columnar
+        std::map<std::string, uint32_t> byName;
+        for(uint32_t function = 0; function < table().GetFunctionCount(); function++)
+        {
+            if(reported[function])
+                byName[table().GetFunctionUri(function)] = function;
+        }
+        for(auto& f : byName)
+        {
+            functions[f.second].funcName = f.first;
+            summary.functions.push_back(functions[f.second]);
         }
+        return summary;
+    }
 
+    void
+    OrchestratorNodeInfoStorage::setRemoteSummary(shardSummary summary)
+    {
+        m_remoteSummaries[summary.shard] = summary;
     }
 
-    bool
-    OrchestratorNodeInfoStorage::setFuncName(std::string nodeID, uint32_t index, Name nameToSet, bool defaultvalue=true)
+    std::map<std::string, OrchestratorNodeInfoStorage::shardSummary>
+    OrchestratorNodeInfoStorage::getRemoteSummaries()
+    {
+        return m_remoteSummaries;
+    }
+
+    //Function Info
+    OrchestratorNodeInfoStorage::functionInfo
+    OrchestratorNodeInfoStorage::getFuncInfo(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return functionInfo();
+        return table().GetFunctionInfo(node, function, defaultvalue);
+    }
 
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
+    std::pair<bool, uint32_t>
+    OrchestratorNodeInfoStorage::getFuncIndex(const std::string& nodeID, const std::string& funcName, bool defaultvalue)
+    {
+        uint32_t node = findNode(nodeID);
+        uint32_t function = table().FindFunction(funcName);
+        if(node == NodeInfoTable::NOT_FOUND || function == NodeInfoTable::NOT_FOUND)
+            return std::make_pair(false, 0);
+        uint32_t position = table().Cell(node, function, defaultvalue).position;
+        if(position == NodeInfoTable::NOT_FOUND)
+            return std::make_pair(false, 0);
+        return std::make_pair(true, position);
+    }
+
+    bool
+    OrchestratorNodeInfoStorage::setFuncInfo(const std::string& nodeID, uint32_t index, const functionInfo& funcToUpdate, bool defaultvalue)
+    {
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return false;
+        NodeInfoTable& table = writableTable();
+        if(table.GetFunctionUri(function) != funcToUpdate.funcName.toUri())
         {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).funcName = nameToSet;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).funcName = nameToSet;
-          return true;
+            if(!table.RenameFunction(node, index, funcToUpdate.funcName, defaultvalue))
+                return false;
+            function = table.FindFunction(funcToUpdate.funcName.toUri());
         }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        table.SetFunctionInfo(node, function, funcToUpdate, defaultvalue);
+        return true;
+    }
+
+    Name
+    OrchestratorNodeInfoStorage::getFuncName(const std::string& nodeID, uint32_t index, bool defaultvalue)
+    {
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return Name();
+        return table().GetFunctionName(function);
+    }
+
+    bool
+    OrchestratorNodeInfoStorage::setFuncName(const std::string& nodeID, uint32_t index, Name nameToSet, bool defaultvalue)
+    {
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        return writableTable().RenameFunction(node, index, nameToSet, defaultvalue);
     }
 
     uint32_t
-    OrchestratorNodeInfoStorage::getFuncExeCounter(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getFuncExeCounter(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).func_exe_counter;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).func_exe_counter;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return 0;
-        }
+        return table().Cell(node, function, defaultvalue).func_exe_counter;
     }
 
     bool
-    OrchestratorNodeInfoStorage::setFuncExeCounter(std::string nodeID, uint32_t index, uint32_t counter, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setFuncExeCounter(const std::string& nodeID, uint32_t index, uint32_t counter, bool defaultvalue)
     {
-         map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).func_exe_counter = 0;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).func_exe_counter = counter;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        //the default counters only ever get reset
+        writableTable().Cell(node, function, defaultvalue).func_exe_counter = defaultvalue ? 0 : counter;
+        return true;
     }
 
     uint32_t
-    OrchestratorNodeInfoStorage::getFuncInterestCounter(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getFuncInterestCounter(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).func_interest_counter;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).func_interest_counter;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return 0;
-        }
+        return table().Cell(node, function, defaultvalue).func_interest_counter;
     }
 
     bool
-    OrchestratorNodeInfoStorage::setFuncInterestCounter(std::string nodeID, uint32_t index, uint32_t counter, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setFuncInterestCounter(const std::string& nodeID, uint32_t index, uint32_t counter, bool defaultvalue)
     {
-         map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).func_interest_counter = 0;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).func_interest_counter = counter;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Cell(node, function, defaultvalue).func_interest_counter = defaultvalue ? 0 : counter;
+        return true;
     }
 
     bool
-    OrchestratorNodeInfoStorage::getFuncStatus(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getFuncStatus(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).status;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).status;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return false;
+        return table().Cell(node, function, defaultvalue).status;
     }
 
-    uint32_t
-    OrchestratorNodeInfoStorage::getFuncCpu(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    bool
+    OrchestratorNodeInfoStorage::setFuncStatus(const std::string& nodeID, uint32_t index, bool status, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).cores;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).cores;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return false;
+        writableTable().Cell(node, function, defaultvalue).status = status;
+        return true;
     }
 
     uint32_t
-    OrchestratorNodeInfoStorage::getFuncRam(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getFuncCpu(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).ram;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).ram;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return 0;
+        return table().Cell(node, function, defaultvalue).cores;
     }
 
-    uint32_t
-    OrchestratorNodeInfoStorage::getFuncRom(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    bool
+    OrchestratorNodeInfoStorage::setFuncCpu(const std::string& nodeID, uint32_t index, uint32_t cores, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).rom;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).rom;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return false;
+        writableTable().Cell(node, function, defaultvalue).cores = cores;
+        return true;
     }
 
     uint32_t
-    OrchestratorNodeInfoStorage::getFuncSize(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::getFuncRam(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).size_bytes;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).size_bytes;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return 0;
+        return table().Cell(node, function, defaultvalue).ram;
     }
 
-    std::vector<std::string>
-    OrchestratorNodeInfoStorage::getFuncInputs(std::string nodeID, uint32_t index, bool defaultvalue=true)
+    bool
+    OrchestratorNodeInfoStorage::setFuncRam(const std::string& nodeID, uint32_t index, uint32_t ram, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)return ((itr->second).functions_initial).at(index).input_data_list;
-          if(defaultvalue==false)return ((itr->second).functions_current).at(index).input_data_list;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return false;
+        writableTable().Cell(node, function, defaultvalue).ram = ram;
+        return true;
     }
 
-
-    bool
-    OrchestratorNodeInfoStorage::setFuncStatus(std::string nodeID, uint32_t index, bool status, bool defaultvalue=true)
+    uint32_t
+    OrchestratorNodeInfoStorage::getFuncRom(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).status = status;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).status = status;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return false;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return 0;
+        return table().Cell(node, function, defaultvalue).rom;
     }
 
     bool
-    OrchestratorNodeInfoStorage::setFuncCpu(std::string nodeID, uint32_t index, uint32_t cores, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setFuncRom(const std::string& nodeID, uint32_t index, uint32_t rom, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).cores = cores;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).cores = cores;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Cell(node, function, defaultvalue).rom = rom;
+        return true;
     }
 
-    bool
-    OrchestratorNodeInfoStorage::setFuncRam(std::string nodeID, uint32_t index, uint32_t ram, bool defaultvalue=true)
+    uint32_t
+    OrchestratorNodeInfoStorage::getFuncSize(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).ram = ram;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).ram = ram;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return false;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return 0;
+        return table().Cell(node, function, defaultvalue).size_bytes;
     }
 
     bool
-    OrchestratorNodeInfoStorage::setFuncRom(std::string nodeID, uint32_t index, uint32_t rom, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setFuncSize(const std::string& nodeID, uint32_t index, uint32_t size, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).rom = rom;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).rom = rom;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        writableTable().Cell(node, function, defaultvalue).size_bytes = size;
+        return true;
     }
 
-    bool
-    OrchestratorNodeInfoStorage::setFuncSize(std::string nodeID, uint32_t index, uint32_t size, bool defaultvalue=true)
+    const std::vector<std::string>&
+    OrchestratorNodeInfoStorage::getFuncInputs(const std::string& nodeID, uint32_t index, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if (itr != m_nodeInfoTable.end())
-        {
-          if(defaultvalue==true)((itr->second).functions_initial).at(index).size_bytes = size;
-          if(defaultvalue==false)((itr->second).functions_current).at(index).size_bytes = size;
-          return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
-            return false;
-        }
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
+            return EMPTY_STRINGS;
+        return table().Inputs(node, function, defaultvalue);
     }
 
     bool
-    OrchestratorNodeInfoStorage::setFuncInputs(std::string nodeID, uint32_t index, std::vector<std::string>inputs, bool defaultvalue=true)
+    OrchestratorNodeInfoStorage::setFuncInputs(const std::string& nodeID, uint32_t index, const std::vector<std::string>& inputs, bool defaultvalue)
     {
-        map<std::string, computeNode>::iterator itr;
-        itr = m_nodeInfoTable.find(nodeID);
-        if(itr!=m_nodeInfoTable.end())
-        {
-            for(auto iter = inputs.begin(); iter != inputs.end(); iter++)
-            {
-                if(defaultvalue==true)((itr->second).functions_initial).at(index).input_data_list.push_back(*iter);
-                if(defaultvalue==false)((itr->second).functions_current).at(index).input_data_list.push_back(*iter);
-            }
-            return true;
-        }
-        else{
-            std::cout<<"Node not found"<<std::endl;
+        uint32_t node;
+        uint32_t function = findFunction(nodeID, index, defaultvalue, node);
+        if(function == NodeInfoTable::NOT_FOUND)
             return false;
-        }
+        std::vector<std::string>& list = writableTable().Inputs(node, function, defaultvalue);
+        list.insert(list.end(), inputs.begin(), inputs.end());
+        return true;
     }
 }}}
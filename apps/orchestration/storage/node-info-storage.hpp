@@ -29,8 +29,11 @@
 #include "ndn-cxx/name.hpp"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/inc-orchestration-compute-node.h"
+#include "ns3/node-info-table.hpp"
 #include "ns3/nstime.h"
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -39,6 +42,12 @@ The node-info-storage stores the information pertaining to the nodes in the netw
 This information is obtained from the nodes via the APIs that communication application uses to update the information.
 It also provides handles/APIs to access complete and specific information from individual/all nodes in the network
 for the OAM application to make informed decisions.
+The information is kept column-wise in a NodeInfoTable, node and function names are resolved through its hash indices.
+
+Status messages update the table in place, between two orchestration rounds the nodes would therefore be seen
+half old, half new. A strategy instead decides on a NodeInfoSnapshot: an immutable table of one epoch, shared
+copy-on-write with the storage. Taking a snapshot is O(1). The first update afterwards opens the next epoch and
+copies the table once if the snapshot is still held. A snapshot can be read from any thread.
 */
 
 namespace ns3{
@@ -46,132 +55,195 @@ namespace ndn{
 namespace inc{
     class OrchestratorNodeInfoStorage: public Object{
         public:
-            //function properties
-            struct functionInfo{
-                Name funcName;
-                double exec_time;
-                uint32_t func_exe_counter;
-                uint32_t func_interest_counter;
-                uint32_t cores;
-                uint32_t ram;
-                uint32_t rom;
-                uint32_t size_bytes;
-                std::vector<std::string> input_data_list;
-                bool status;
+            //rows of the storage, see NodeInfoTable
+            typedef NodeInfoTable::functionInfo functionInfo;
+            typedef NodeInfoTable::dataInfo dataInfo;
+            typedef NodeInfoTable::computeNode computeNode;
+
+            //summarised state of the nodes of one orchestrator, exchanged between shards
+            struct functionSummary{
+                std::string funcName;
+                uint32_t instances;
+                uint32_t executions;
+                uint32_t missed;
             };
 
-            struct dataInfo{
-                Name dataName;
-                uint32_t size_bytes;
-            };
-
-            struct computeNode{
-                Name nodeName;
-                Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> node_ptr;
-                std::pair<uint32_t, uint32_t> ram;
-                std::pair<uint32_t, uint32_t> rom;
-                std::pair<uint32_t, uint32_t> cpu;
-                std::pair<uint32_t, uint32_t> nodeBusyCounter;
-                std::pair<std::vector<std::string>, std::vector<std::string>> links;
-                std::pair<std::vector<std::string>, std::vector<std::string>> runtimes_supported;
-                std::vector<ns3::ndn::inc::OrchestratorNodeInfoStorage::dataInfo> data_initial;
-                std::vector<ns3::ndn::inc::OrchestratorNodeInfoStorage::dataInfo> data_current;
-                std::vector<ns3::ndn::inc::OrchestratorNodeInfoStorage::functionInfo> functions_initial;
-                std::vector<ns3::ndn::inc::OrchestratorNodeInfoStorage::functionInfo> functions_current;
-                std::set<std::pair<std::string, int>> hop_distance;
+            struct shardSummary{
+                std::string shard;
+                uint32_t nodes;
+                uint32_t cores;
+                uint32_t busy;
+                std::vector<ns3::ndn::inc::OrchestratorNodeInfoStorage::functionSummary> functions;
             };
 
 
         private:
-            static
-            std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode> m_nodeInfoTable;
+            //one table per orchestrator, see GetStorage, shared with the snapshots taken of it
+            std::shared_ptr<NodeInfoTable> m_table;
+            uint64_t m_epoch;
+            bool m_frozen;  //a snapshot of m_epoch was taken, the next update opens a new epoch
+            std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::shardSummary> m_remoteSummaries;
+
+            //hop distances between all simulation nodes, row-major m_vertices x m_vertices, indexed by vertex
+            //(the ns-3 node ID for nodes known at calculate_hop_distance), shared like the node info table
+            static std::unordered_map<std::string, uint32_t> m_vertexIndex;
+            static std::vector<std::vector<std::pair<uint32_t, int32_t>>> m_adjacency;
+            static std::vector<int32_t> m_distance;
+            static uint32_t m_vertices;
+
+            //m_vertices for a node not known at calculate_hop_distance, unless create adds a vertex for it
+            static uint32_t
+            get_vertex(std::string node, bool create);
+
+            static void
+            resize_distance(uint32_t vertices);
+
+            static void
+            clear_hop_distance();
+
+            //BFS when all links have metric 1, Dijkstra otherwise
+            static void
+            shortest_paths(uint32_t source, bool unitWeights);
+
+            static bool
+            has_unit_weights();
+
+            //recompute the rows of all sources with a shortest path over link (a, b) of the given metric
+            static void
+            repair_link_removal(uint32_t a, uint32_t b, int32_t metric);
         public:
-            std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_iterator cbegin();
-            std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_iterator cend();
-            std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_reverse_iterator crbegin();
-            std::map<std::string, ns3::ndn::inc::OrchestratorNodeInfoStorage::computeNode>::const_reverse_iterator crend();
             static TypeId GetTypeId (void);
 
             //constructor, deconstructor
             OrchestratorNodeInfoStorage();
             ~OrchestratorNodeInfoStorage();
 
+            //storage of the orchestrator on node, created and aggregated to the node on first use.
+            //All orchestration apps of one node share it, orchestrators on different nodes own disjoint shards.
+            static Ptr<OrchestratorNodeInfoStorage> GetStorage(Ptr<Node> node);
+
+
+            //columnar view of the live table for scans over all nodes and functions,
+            //references into it stay valid until the next update of the storage
+            const NodeInfoTable& getTable() const;
+
+            //freezes the current state as one epoch, later updates go into the next epoch.
+            //The table is only copied when it is updated while a snapshot is still held.
+            NodeInfoSnapshot takeSnapshot();
+            //epoch the next snapshot will carry
+            uint64_t getEpoch() const;
 
             // getters and setters:
+            // the getters of lists return references into the table, an empty list for unknown nodes
 
             //Node info
-            computeNode getNodeInfo(std::string);
-            void printCurrentNodeInfo(std::string);
-            void printDefaultNodeInfo(std::string);
+            //row of the node assembled from the columns
+            computeNode getNodeInfo(const std::string& nodeID);
+            void printCurrentNodeInfo(const std::string& nodeID);
+            void printDefaultNodeInfo(const std::string& nodeID);
             uint32_t getTableSize();
-            bool AddNodeToTable(std::string,computeNode);
-            Name getNodeName(std::string nodeID);
-            bool setNodeName(std::string nodeID,Name);
-            Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> getNodePointer(std::string nodeID);
-            bool setNodePointer(std::string nodeID, Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> value);
+            bool AddNodeToTable(const std::string& nodeID, const computeNode& nodeToAdd);
+            //applies the current state of a node status report, functions the node did not bootstrap with are ignored
+            bool updateNodeStatus(const std::string& nodeID, const computeNode& status);
+            Name getNodeName(const std::string& nodeID);
+            bool setNodeName(const std::string& nodeID, Name);
+            Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> getNodePointer(const std::string& nodeID);
+            bool setNodePointer(const std::string& nodeID, Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> value);
 
-            uint32_t getNodeRAM(std::string, bool);
-            bool setNodeRAM(std::string, uint32_t, bool);
+            uint32_t getNodeRAM(const std::string& nodeID, bool);
+            bool setNodeRAM(const std::string& nodeID, uint32_t, bool);
 
-            uint32_t getNodeROM(std::string, bool);
-            bool setNodeROM(std::string, uint32_t, bool);
+            uint32_t getNodeROM(const std::string& nodeID, bool);
+            bool setNodeROM(const std::string& nodeID, uint32_t, bool);
 
-            uint32_t getNodeBusyCounter(std::string, bool);
-            bool setNodeBusyCounter(std::string, uint32_t, bool);
+            uint32_t getNodeBusyCounter(const std::string& nodeID, bool);
+            bool setNodeBusyCounter(const std::string& nodeID, uint32_t, bool);
 
-            uint32_t getNodeCPU(std::string, bool);
-            bool setNodeCPU(std::string, uint32_t, bool);
+            uint32_t getNodeCPU(const std::string& nodeID, bool);
+            bool setNodeCPU(const std::string& nodeID, uint32_t, bool);
 
-            std::vector<std::string> getNodeLinks(std::string, bool);
-            bool setNodeLinks(std::string,std::vector<std::string>, bool);
-            std::vector<dataInfo> getNodeDataList(std::string, bool);
-            bool setNodeDataList(std::string,std::vector<dataInfo>, bool);
+            const std::vector<std::string>& getNodeLinks(const std::string& nodeID, bool);
+            bool setNodeLinks(const std::string& nodeID, const std::vector<std::string>&, bool);
+            const std::vector<dataInfo>& getNodeDataList(const std::string& nodeID, bool);
+            bool setNodeDataList(const std::string& nodeID, const std::vector<dataInfo>&, bool);
 
-            bool addLinkToNode(std::string,string, bool);
+            bool addLinkToNode(const std::string& nodeID, const std::string&, bool);
 
-            std::vector<std::string> getNodeRuntimes(std::string, bool);
-            bool setNodeRuntimes(std::string,std::vector<std::string>, bool);
-            bool addRuntimeToNode(std::string,string, bool);
+            const std::vector<std::string>& getNodeRuntimes(const std::string& nodeID, bool);
+            bool setNodeRuntimes(const std::string& nodeID, const std::vector<std::string>&, bool);
+            bool addRuntimeToNode(const std::string& nodeID, const std::string&, bool);
 
-            std::vector<functionInfo> getFunctionsAtNode(std::string nodeID, bool);
-            bool addFunctionToNode(std::string nodeID, functionInfo funcToAdd, bool);
+            //assembled from the function matrix in the order the node reported its functions
+            std::vector<functionInfo> getFunctionsAtNode(const std::string& nodeID, bool);
+            bool addFunctionToNode(const std::string& nodeID, const functionInfo& funcToAdd, bool);
 
             bool
-            addDataToNode(std::string nodeID, dataInfo dataToAdd, bool);
-            std::vector<OrchestratorNodeInfoStorage::dataInfo>
-            getDataAtNode(std::string nodeID, bool defaultvalue);
+            addDataToNode(const std::string& nodeID, const dataInfo& dataToAdd, bool);
+            const std::vector<OrchestratorNodeInfoStorage::dataInfo>&
+            getDataAtNode(const std::string& nodeID, bool defaultvalue);
 
+            //all-pairs distances over the GlobalRouter incidencies, sources are spread over worker threads.
+            //Computed once per simulation, later calls of other shards reuse the matrix
             bool
             calculate_hop_distance();
 
+            //O(1), 0 for unknown or unreachable nodes.
+            //Not used by the strategies yet, they place functions by capacity only
             int
             get_distance(std::string src_node, std::string dest_node);
 
+            //incremental repair of the shared distances after calculate_hop_distance, so every shard sees it,
+            //nodes named as in the table (eg: /Node1). False if there is nothing to repair
+            bool
+            update_link(std::string node_a, std::string node_b, int metric);
+            bool
+            remove_link(std::string node_a, std::string node_b);
+            bool
+            remove_node(std::string node);
+
             //int
             //get_hop_distance(string source_node, string destination_node);
 
+            //Shard Info
+            shardSummary getShardSummary(std::string shard);
+            void setRemoteSummary(shardSummary summary);
+            std::map<std::string, shardSummary> getRemoteSummaries();
+
             //Function Info
-            functionInfo getFuncInfo(std::string nodeID, uint32_t index, bool);
-            bool setFuncInfo(std::string nodeID, uint32_t index, functionInfo funcToUpdate, bool);
-            std::pair<bool, uint32_t> getFuncIndex(std::string nodeID, std::string funcName, bool);
-            Name getFuncName(std::string nodeID, uint32_t index, bool);
-            bool setFuncName(std::string nodeID, uint32_t index, Name nameToSet, bool);
-            uint32_t getFuncExeCounter(std::string nodeID, uint32_t index, bool);
-            bool setFuncExeCounter(std::string nodeID, uint32_t index, uint32_t counter, bool);
-            uint32_t getFuncInterestCounter(std::string nodeID, uint32_t index, bool);
-            bool setFuncInterestCounter(std::string nodeID, uint32_t index, uint32_t counter, bool);
-            bool getFuncStatus(std::string nodeID, uint32_t index, bool);
-            bool setFuncStatus(std::string nodeID, uint32_t index, bool status, bool);
-            uint32_t getFuncCpu(std::string nodeID, uint32_t index, bool);
-            bool setFuncCpu(std::string nodeID, uint32_t index, uint32_t cores, bool);
-            bool setFuncRam(std::string nodeID, uint32_t index, uint32_t ram, bool);
-            uint32_t getFuncRam(std::string nodeID, uint32_t index, bool);
-            bool setFuncRom(std::string nodeID, uint32_t index, uint32_t rom, bool);
-            uint32_t getFuncRom(std::string nodeID, uint32_t index, bool);
-            bool setFuncSize(std::string nodeID, uint32_t index, uint32_t size, bool);
-            uint32_t getFuncSize(std::string nodeID, uint32_t index, bool);
-            std::vector<std::string> getFuncInputs(std::string nodeID, uint32_t index, bool);
-            bool setFuncInputs(std::string nodeID, uint32_t index, std::vector<std::string> inputs, bool);
+            //index is the position of the function in the list of the node, see getFuncIndex
+            functionInfo getFuncInfo(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncInfo(const std::string& nodeID, uint32_t index, const functionInfo& funcToUpdate, bool);
+            //O(1), hash lookups of the node and the function
+            std::pair<bool, uint32_t> getFuncIndex(const std::string& nodeID, const std::string& funcName, bool);
+            Name getFuncName(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncName(const std::string& nodeID, uint32_t index, Name nameToSet, bool);
+            uint32_t getFuncExeCounter(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncExeCounter(const std::string& nodeID, uint32_t index, uint32_t counter, bool);
+            uint32_t getFuncInterestCounter(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncInterestCounter(const std::string& nodeID, uint32_t index, uint32_t counter, bool);
+            bool getFuncStatus(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncStatus(const std::string& nodeID, uint32_t index, bool status, bool);
+            uint32_t getFuncCpu(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncCpu(const std::string& nodeID, uint32_t index, uint32_t cores, bool);
+            bool setFuncRam(const std::string& nodeID, uint32_t index, uint32_t ram, bool);
+            uint32_t getFuncRam(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncRom(const std::string& nodeID, uint32_t index, uint32_t rom, bool);
+            uint32_t getFuncRom(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncSize(const std::string& nodeID, uint32_t index, uint32_t size, bool);
+            uint32_t getFuncSize(const std::string& nodeID, uint32_t index, bool);
+            const std::vector<std::string>& getFuncInputs(const std::string& nodeID, uint32_t index, bool);
+            bool setFuncInputs(const std::string& nodeID, uint32_t index, const std::vector<std::string>& inputs, bool);
+
+        private:
+            const NodeInfoTable& table() const;
+            //table to update, copied first if a snapshot still refers to it
+            NodeInfoTable& writableTable();
+
+            //node ID in the table, NOT_FOUND (and a warning) for unknown nodes
+            uint32_t findNode(const std::string& nodeID);
+
+            //function ID of the index-th function of the node, NOT_FOUND if node or index are unknown
+            uint32_t findFunction(const std::string& nodeID, uint32_t index, bool defaultvalue, uint32_t& node);
     };
 }}}
 #endif
@@ -0,0 +1,463 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "node-info-table.hpp"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE ("NodeInfoTable");
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+namespace {
+    //layer of the function matrix and of the list columns
+    inline uint32_t
+    layer(bool defaultvalue)
+    {
+        return defaultvalue ? 0 : 1;
+    }
+
+    const uint32_t INITIAL_STRIDE = 8;
+}
+
+    const uint32_t NodeInfoTable::NOT_FOUND = std::numeric_limits<uint32_t>::max();
+
+    NodeInfoTable::NodeInfoTable()
+        : m_stride(0)
+    {
+    }
+
+    uint32_t
+    NodeInfoTable::GetNodeCount() const
+    {
+        return m_nodeIDs.size();
+    }
+
+    uint32_t
+    NodeInfoTable::GetFunctionCount() const
+    {
+        return m_functionUris.size();
+    }
+
+    uint32_t
+    NodeInfoTable::FindNode(const std::string& nodeID) const
+    {
+        auto it = m_nodeIndex.find(nodeID);
+        return it == m_nodeIndex.end() ? NOT_FOUND : it->second;
+    }
+
+    uint32_t
+    NodeInfoTable::FindFunction(const std::string& funcName) const
+    {
+        auto it = m_functionIndex.find(funcName);
+        return it == m_functionIndex.end() ? NOT_FOUND : it->second;
+    }
+
+    uint32_t
+    NodeInfoTable::AddNode(const std::string& nodeID, const computeNode& node)
+    {
+        if(m_nodeIndex.find(nodeID) != m_nodeIndex.end())
+            return NOT_FOUND;
+        uint32_t id = m_nodeIDs.size();
+        m_nodeIndex[nodeID] = id;
+        m_nodeIDs.push_back(nodeID);
+        m_nodeNames.push_back(node.nodeName);
+        m_nodePointers.push_back(node.node_ptr);
+        m_ram.push_back(node.ram);
+        m_rom.push_back(node.rom);
+        m_cpu.push_back(node.cpu);
+        m_busy.push_back(node.nodeBusyCounter);
+        m_links[0].push_back(node.links.first);
+        m_links[1].push_back(node.links.second);
+        m_runtimes[0].push_back(node.runtimes_supported.first);
+        m_runtimes[1].push_back(node.runtimes_supported.second);
+        m_data[0].push_back(node.data_initial);
+        m_data[1].push_back(node.data_current);
+
+        functionCell empty = functionCell();
+        empty.position = NOT_FOUND;
+        for(uint32_t l = 0; l < 2; l++)
+        {
+            m_cells[l].resize(m_cells[l].size() + m_stride, empty);
+            m_inputs[l].resize(m_inputs[l].size() + m_stride);
+            m_nodeFunctions[l].push_back(std::vector<uint32_t>());
+        }
+        for(auto& func : node.functions_initial)
+        {
+            uint32_t function = AddFunction(func.funcName);
+            AttachFunction(id, function, true);
+            SetFunctionInfo(id, function, func, true);
+        }
+        for(auto& func : node.functions_current)
+        {
+            uint32_t function = AddFunction(func.funcName);
+            AttachFunction(id, function, false);
+            SetFunctionInfo(id, function, func, false);
+        }
+        return id;
+    }
+
+    uint32_t
+    NodeInfoTable::AddFunction(const Name& funcName)
+    {
+        std::string uri = funcName.toUri();
+        auto it = m_functionIndex.find(uri);
+        if(it != m_functionIndex.end())
+            return it->second;
+        uint32_t id = m_functionUris.size();
+        Reserve(id + 1);
+        m_functionIndex[uri] = id;
+        m_functionNames.push_back(funcName);
+        m_functionUris.push_back(uri);
+        return id;
+    }
+
+    void
+    NodeInfoTable::Reserve(uint32_t functions)
+    {
+        if(functions <= m_stride)
+            return;
+        uint32_t stride = std::max(INITIAL_STRIDE, m_stride);
+        while(stride < functions)
+            stride *= 2;
+        functionCell empty = functionCell();
+        empty.position = NOT_FOUND;
+        //new columns are appended to every row, so the rows are laid out again
+        for(uint32_t l = 0; l < 2; l++)
+        {
+            std::vector<functionCell> cells(static_cast<size_t>(stride) * m_nodeIDs.size(), empty);
+            std::vector<std::vector<std::string>> inputs(cells.size());
+            for(size_t node = 0; node < m_nodeIDs.size(); node++)
+            {
+                for(uint32_t f = 0; f < m_functionUris.size(); f++)
+                {
+                    cells[node * stride + f] = m_cells[l][node * m_stride + f];
+                    inputs[node * stride + f].swap(m_inputs[l][node * m_stride + f]);
+                }
+            }
+            m_cells[l].swap(cells);
+            m_inputs[l].swap(inputs);
+        }
+        NS_LOG_DEBUG("Function matrix stride grown from " << m_stride << " to " << stride);
+        m_stride = stride;
+    }
+
+    size_t
+    NodeInfoTable::GetCellIndex(uint32_t node, uint32_t function) const
+    {
+        NS_ASSERT_MSG(node < m_nodeIDs.size() && function < m_functionUris.size(),
+                      "Cell (" << node << ", " << function << ") outside of the function matrix");
+        return static_cast<size_t>(node) * m_stride + function;
+    }
+
+    //Node columns
+    const std::string&
+    NodeInfoTable::GetNodeID(uint32_t node) const
+    {
+        return m_nodeIDs.at(node);
+    }
+
+    Name&
+    NodeInfoTable::NodeName(uint32_t node)
+    {
+        return m_nodeNames.at(node);
+    }
+
+    const Name&
+    NodeInfoTable::NodeName(uint32_t node) const
+    {
+        return m_nodeNames.at(node);
+    }
+
+    Ptr<IncOrchestrationComputeNode>&
+    NodeInfoTable::NodePointer(uint32_t node)
+    {
+        return m_nodePointers.at(node);
+    }
+
+    Ptr<IncOrchestrationComputeNode>
+    NodeInfoTable::NodePointer(uint32_t node) const
+    {
+        return m_nodePointers.at(node);
+    }
+
+    std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::Ram(uint32_t node)
+    {
+        return m_ram.at(node);
+    }
+
+    const std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::Ram(uint32_t node) const
+    {
+        return m_ram.at(node);
+    }
+
+    std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::Rom(uint32_t node)
+    {
+        return m_rom.at(node);
+    }
+
+    const std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::Rom(uint32_t node) const
+    {
+        return m_rom.at(node);
+    }
+
+    std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::Cpu(uint32_t node)
+    {
+        return m_cpu.at(node);
+    }
+
+    const std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::Cpu(uint32_t node) const
+    {
+        return m_cpu.at(node);
+    }
+
+    std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::BusyCounter(uint32_t node)
+    {
+        return m_busy.at(node);
+    }
+
+    const std::pair<uint32_t, uint32_t>&
+    NodeInfoTable::BusyCounter(uint32_t node) const
+    {
+        return m_busy.at(node);
+    }
+
+    std::vector<std::string>&
+    NodeInfoTable::Links(uint32_t node, bool defaultvalue)
+    {
+        return m_links[layer(defaultvalue)].at(node);
+    }
+
+    const std::vector<std::string>&
+    NodeInfoTable::Links(uint32_t node, bool defaultvalue) const
+    {
+        return m_links[layer(defaultvalue)].at(node);
+    }
+
+    std::vector<std::string>&
+    NodeInfoTable::Runtimes(uint32_t node, bool defaultvalue)
+    {
+        return m_runtimes[layer(defaultvalue)].at(node);
+    }
+
+    const std::vector<std::string>&
+    NodeInfoTable::Runtimes(uint32_t node, bool defaultvalue) const
+    {
+        return m_runtimes[layer(defaultvalue)].at(node);
+    }
+
+    std::vector<NodeInfoTable::dataInfo>&
+    NodeInfoTable::Data(uint32_t node, bool defaultvalue)
+    {
+        return m_data[layer(defaultvalue)].at(node);
+    }
+
+    const std::vector<NodeInfoTable::dataInfo>&
+    NodeInfoTable::Data(uint32_t node, bool defaultvalue) const
+    {
+        return m_data[layer(defaultvalue)].at(node);
+    }
+
+    //Function matrix
+    const Name&
+    NodeInfoTable::GetFunctionName(uint32_t function) const
+    {
+        return m_functionNames.at(function);
+    }
+
+    const std::string&
+    NodeInfoTable::GetFunctionUri(uint32_t function) const
+    {
+        return m_functionUris.at(function);
+    }
+
+    const std::vector<uint32_t>&
+    NodeInfoTable::GetNodeFunctions(uint32_t node, bool defaultvalue) const
+    {
+        return m_nodeFunctions[layer(defaultvalue)].at(node);
+    }
+
+    const NodeInfoTable::functionCell*
+    NodeInfoTable::GetRow(uint32_t node, bool defaultvalue) const
+    {
+        NS_ASSERT(node < m_nodeIDs.size());
+        return m_cells[layer(defaultvalue)].data() + static_cast<size_t>(node) * m_stride;
+    }
+
+    NodeInfoTable::functionCell&
+    NodeInfoTable::Cell(uint32_t node, uint32_t function, bool defaultvalue)
+    {
+        return m_cells[layer(defaultvalue)][GetCellIndex(node, function)];
+    }
+
+    const NodeInfoTable::functionCell&
+    NodeInfoTable::Cell(uint32_t node, uint32_t function, bool defaultvalue) const
+    {
+        return m_cells[layer(defaultvalue)][GetCellIndex(node, function)];
+    }
+
+    std::vector<std::string>&
+    NodeInfoTable::Inputs(uint32_t node, uint32_t function, bool defaultvalue)
+    {
+        return m_inputs[layer(defaultvalue)][GetCellIndex(node, function)];
+    }
+
+    const std::vector<std::string>&
+    NodeInfoTable::Inputs(uint32_t node, uint32_t function, bool defaultvalue) const
+    {
+        return m_inputs[layer(defaultvalue)][GetCellIndex(node, function)];
+    }
+
+    uint32_t
+    NodeInfoTable::AttachFunction(uint32_t node, uint32_t function, bool defaultvalue)
+    {
+        functionCell& cell = Cell(node, function, defaultvalue);
+        if(cell.position != NOT_FOUND)
+            return cell.position;
+        std::vector<uint32_t>& functions = m_nodeFunctions[layer(defaultvalue)][node];
+        cell.position = functions.size();
+        functions.push_back(function);
+        return cell.position;
+    }
+
+    bool
+    NodeInfoTable::RenameFunction(uint32_t node, uint32_t position, const Name& funcName, bool defaultvalue)
+    {
+        uint32_t& slot = m_nodeFunctions[layer(defaultvalue)].at(node).at(position);
+        uint32_t function = AddFunction(funcName);
+        if(function == slot)
+            return true;
+        functionCell& target = Cell(node, function, defaultvalue);
+        if(target.position != NOT_FOUND)
+            return false;
+        functionCell& source = Cell(node, slot, defaultvalue);
+        target = source;
+        Inputs(node, function, defaultvalue).swap(Inputs(node, slot, defaultvalue));
+        source = functionCell();
+        source.position = NOT_FOUND;
+        slot = function;
+        return true;
+    }
+
+    void
+    NodeInfoTable::SetFunctionInfo(uint32_t node, uint32_t function, const functionInfo& info, bool defaultvalue)
+    {
+        functionCell& cell = Cell(node, function, defaultvalue);
+        cell.exec_time = info.exec_time;
+        cell.func_exe_counter = info.func_exe_counter;
+        cell.func_interest_counter = info.func_interest_counter;
+        cell.cores = info.cores;
+        cell.ram = info.ram;
+        cell.rom = info.rom;
+        cell.size_bytes = info.size_bytes;
+        cell.status = info.status;
+        Inputs(node, function, defaultvalue) = info.input_data_list;
+    }
+
+    NodeInfoTable::functionInfo
+    NodeInfoTable::GetFunctionInfo(uint32_t node, uint32_t function, bool defaultvalue) const
+    {
+        const functionCell& cell = Cell(node, function, defaultvalue);
+        functionInfo info;
+        info.funcName = m_functionNames[function];
+        info.exec_time = cell.exec_time;
+        info.func_exe_counter = cell.func_exe_counter;
+        info.func_interest_counter = cell.func_interest_counter;
+        info.cores = cell.cores;
+        info.ram = cell.ram;
+        info.rom = cell.rom;
+        info.size_bytes = cell.size_bytes;
+        info.input_data_list = Inputs(node, function, defaultvalue);
+        info.status = cell.status;
+        return info;
+    }
+
+    NodeInfoTable::computeNode
+    NodeInfoTable::GetNode(uint32_t node) const
+    {
+        computeNode row;
+        row.nodeName = m_nodeNames.at(node);
+        row.node_ptr = m_nodePointers[node];
+        row.ram = m_ram[node];
+        row.rom = m_rom[node];
+        row.cpu = m_cpu[node];
+        row.nodeBusyCounter = m_busy[node];
+        row.links = std::make_pair(m_links[0][node], m_links[1][node]);
+        row.runtimes_supported = std::make_pair(m_runtimes[0][node], m_runtimes[1][node]);
+        row.data_initial = m_data[0][node];
+        row.data_current = m_data[1][node];
+        row.functions_initial.reserve(m_nodeFunctions[0][node].size());
+        for(uint32_t function : m_nodeFunctions[0][node])
+            row.functions_initial.push_back(GetFunctionInfo(node, function, true));
+        row.functions_current.reserve(m_nodeFunctions[1][node].size());
+        for(uint32_t function : m_nodeFunctions[1][node])
+            row.functions_current.push_back(GetFunctionInfo(node, function, false));
+        return row;
+    }
+
+    NodeInfoSnapshot::NodeInfoSnapshot()
+        : m_epoch(0)
+    {
+    }
+
+    NodeInfoSnapshot::NodeInfoSnapshot(uint64_t epoch, std::shared_ptr<const NodeInfoTable> table)
+        : m_epoch(epoch)
+        , m_table(table)
+    {
+    }
+
+    uint64_t
+    NodeInfoSnapshot::GetEpoch() const
+    {
+        return m_epoch;
+    }
+
+    bool
+    NodeInfoSnapshot::IsValid() const
+    {
+        return m_table != nullptr;
+    }
+
+    const NodeInfoTable&
+    NodeInfoSnapshot::GetTable() const
+    {
+        NS_ASSERT_MSG(m_table != nullptr, "Empty node info snapshot");
+        return *m_table;
+    }
+}
+}
+}
+}
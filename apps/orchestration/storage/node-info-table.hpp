@@ -0,0 +1,280 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_NODE_INFO_TABLE_H
+#define INC_NODE_INFO_TABLE_H
+
+#include "ndn-cxx/name.hpp"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/inc-orchestration-compute-node.h"
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <string>
+
+/*
+Columnar table behind the node info storage.
+Nodes and functions get dense IDs in the order they are first seen, hash indices map node IDs (eg: /Node1)
+and function names (eg: /Func1) to them. Every node property is one column indexed by node ID.
+The per function state of all nodes is a node-major matrix of small cells, one row per node and one column
+per function ID, so that a pass over all functions of all nodes reads contiguous memory.
+Input data lists are kept in a separate matrix of the same shape, they are only read when a placement is built.
+
+Like the first/second members of the node properties, the function matrix has a default (bootstrap)
+layer and a current layer, selected with the defaultvalue flag of the accessors.
+*/
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+    class NodeInfoTable{
+        public:
+            //function properties
+            struct functionInfo{
+                Name funcName;
+                double exec_time;
+                uint32_t func_exe_counter;
+                uint32_t func_interest_counter;
+                uint32_t cores;
+                uint32_t ram;
+                uint32_t rom;
+                uint32_t size_bytes;
+                std::vector<std::string> input_data_list;
+                bool status;
+            };
+
+            struct dataInfo{
+                Name dataName;
+                uint32_t size_bytes;
+            };
+
+            //row oriented view of one node, assembled from the columns by GetNode
+            struct computeNode{
+                Name nodeName;
+                Ptr<ns3::ndn::inc::IncOrchestrationComputeNode> node_ptr;
+                std::pair<uint32_t, uint32_t> ram;
+                std::pair<uint32_t, uint32_t> rom;
+                std::pair<uint32_t, uint32_t> cpu;
+                std::pair<uint32_t, uint32_t> nodeBusyCounter;
+                std::pair<std::vector<std::string>, std::vector<std::string>> links;
+                std::pair<std::vector<std::string>, std::vector<std::string>> runtimes_supported;
+                std::vector<dataInfo> data_initial;
+                std::vector<dataInfo> data_current;
+                std::vector<functionInfo> functions_initial;
+                std::vector<functionInfo> functions_current;
+            };
+
+            //state of one function at one node
+            struct functionCell{
+                double exec_time;
+                uint32_t func_exe_counter;
+                uint32_t func_interest_counter;
+                uint32_t cores;
+                uint32_t ram;
+                uint32_t rom;
+                uint32_t size_bytes;
+                uint32_t position;  //index in the function list of the node, NOT_FOUND if the node lacks the function
+                bool status;
+            };
+
+            static const uint32_t NOT_FOUND;
+
+            NodeInfoTable();
+
+            uint32_t
+            GetNodeCount() const;
+
+            uint32_t
+            GetFunctionCount() const;
+
+            //NOT_FOUND for unknown nodes
+            uint32_t
+            FindNode(const std::string& nodeID) const;
+
+            //NOT_FOUND for unknown functions
+            uint32_t
+            FindFunction(const std::string& funcName) const;
+
+            //appends a row for the node and its functions, NOT_FOUND if nodeID is already in the table
+            uint32_t
+            AddNode(const std::string& nodeID, const computeNode& node);
+
+            //ID of the function, a column is added on first use
+            uint32_t
+            AddFunction(const Name& funcName);
+
+            //Node columns, indexed by node ID
+            const std::string&
+            GetNodeID(uint32_t node) const;
+
+            Name&
+            NodeName(uint32_t node);
+            const Name&
+            NodeName(uint32_t node) const;
+
+            Ptr<IncOrchestrationComputeNode>&
+            NodePointer(uint32_t node);
+            Ptr<IncOrchestrationComputeNode>
+            NodePointer(uint32_t node) const;
+
+            std::pair<uint32_t, uint32_t>&
+            Ram(uint32_t node);
+            const std::pair<uint32_t, uint32_t>&
+            Ram(uint32_t node) const;
+
+            std::pair<uint32_t, uint32_t>&
+            Rom(uint32_t node);
+            const std::pair<uint32_t, uint32_t>&
+            Rom(uint32_t node) const;
+
+            std::pair<uint32_t, uint32_t>&
+            Cpu(uint32_t node);
+            const std::pair<uint32_t, uint32_t>&
+            Cpu(uint32_t node) const;
+
+            std::pair<uint32_t, uint32_t>&
+            BusyCounter(uint32_t node);
+            const std::pair<uint32_t, uint32_t>&
+            BusyCounter(uint32_t node) const;
+
+            std::vector<std::string>&
+            Links(uint32_t node, bool defaultvalue);
+            const std::vector<std::string>&
+            Links(uint32_t node, bool defaultvalue) const;
+
+            std::vector<std::string>&
+            Runtimes(uint32_t node, bool defaultvalue);
+            const std::vector<std::string>&
+            Runtimes(uint32_t node, bool defaultvalue) const;
+
+            std::vector<dataInfo>&
+            Data(uint32_t node, bool defaultvalue);
+            const std::vector<dataInfo>&
+            Data(uint32_t node, bool defaultvalue) const;
+
+            //Function matrix
+            const Name&
+            GetFunctionName(uint32_t function) const;
+
+            const std::string&
+            GetFunctionUri(uint32_t function) const;
+
+            //function IDs of the node in the order it reported them
+            const std::vector<uint32_t>&
+            GetNodeFunctions(uint32_t node, bool defaultvalue) const;
+
+            //row of the node, GetFunctionCount() cells indexed by function ID
+            const functionCell*
+            GetRow(uint32_t node, bool defaultvalue) const;
+
+            functionCell&
+            Cell(uint32_t node, uint32_t function, bool defaultvalue);
+            const functionCell&
+            Cell(uint32_t node, uint32_t function, bool defaultvalue) const;
+
+            std::vector<std::string>&
+            Inputs(uint32_t node, uint32_t function, bool defaultvalue);
+            const std::vector<std::string>&
+            Inputs(uint32_t node, uint32_t function, bool defaultvalue) const;
+
+            //appends the function to the function list of the node, returns its position there
+            uint32_t
+            AttachFunction(uint32_t node, uint32_t function, bool defaultvalue);
+
+            //moves the function at position of the node to another function column, false if the node has it already
+            bool
+            RenameFunction(uint32_t node, uint32_t position, const Name& funcName, bool defaultvalue);
+
+            //copies everything but the name from info into the cell and input list of (node, function)
+            void
+            SetFunctionInfo(uint32_t node, uint32_t function, const functionInfo& info, bool defaultvalue);
+
+            functionInfo
+            GetFunctionInfo(uint32_t node, uint32_t function, bool defaultvalue) const;
+
+            computeNode
+            GetNode(uint32_t node) const;
+
+        private:
+            size_t
+            GetCellIndex(uint32_t node, uint32_t function) const;
+
+            //gives every row room for at least functions columns
+            void
+            Reserve(uint32_t functions);
+
+        private:
+            //hash indices
+            std::unordered_map<std::string, uint32_t> m_nodeIndex;
+            std::unordered_map<std::string, uint32_t> m_functionIndex;
+
+            //node columns
+            std::vector<std::string> m_nodeIDs;
+            std::vector<Name> m_nodeNames;
+            std::vector<Ptr<IncOrchestrationComputeNode>> m_nodePointers;
+            std::vector<std::pair<uint32_t, uint32_t>> m_ram;
+            std::vector<std::pair<uint32_t, uint32_t>> m_rom;
+            std::vector<std::pair<uint32_t, uint32_t>> m_cpu;
+            std::vector<std::pair<uint32_t, uint32_t>> m_busy;
+            std::vector<std::vector<std::string>> m_links[2];
+            std::vector<std::vector<std::string>> m_runtimes[2];
+            std::vector<std::vector<dataInfo>> m_data[2];
+
+            //function columns
+            std::vector<Name> m_functionNames;
+            std::vector<std::string> m_functionUris;
+
+            //function matrix, [0] default and [1] current layer, row stride m_stride >= number of functions
+            uint32_t m_stride;
+            std::vector<functionCell> m_cells[2];
+            std::vector<std::vector<std::string>> m_inputs[2];
+            std::vector<std::vector<uint32_t>> m_nodeFunctions[2];
+    };
+
+    //immutable table of one epoch of the node info storage, see OrchestratorNodeInfoStorage::takeSnapshot
+    class NodeInfoSnapshot{
+        public:
+            NodeInfoSnapshot();
+            NodeInfoSnapshot(uint64_t epoch, std::shared_ptr<const NodeInfoTable> table);
+
+            uint64_t
+            GetEpoch() const;
+
+            //false for a default constructed snapshot
+            bool
+            IsValid() const;
+
+            const NodeInfoTable&
+            GetTable() const;
+
+        private:
+            uint64_t m_epoch;
+            std::shared_ptr<const NodeInfoTable> m_table;
+    };
+}
+}
+}
+#endif
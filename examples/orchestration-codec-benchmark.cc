@@ -0,0 +1,187 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/incSIM-module.h"
+#include <boost/algorithm/string.hpp>
+#include <chrono>
+#include <sstream>
+
+namespace ns3 {
+ namespace ndn {
+   namespace inc {
+   /*
+   Message size and parse time of the node status message, which is the largest orchestration message.
+   The binary TLV encoding of OrchestrationMessageCodec is compared with the former text format
+   (name=..;RAM=..;functions=/f:1:3:...) built with a stringstream and parsed with boost::split.
+   Run with: ./waf --run "orchestration-codec-benchmark --functions=80 --iterations=10000"
+   */
+
+   std::string
+   EncodeTextStatus(Ptr<IncOrchestrationComputeNode> node)
+   {
+     std::stringstream ss;
+     ss << "name=/" << node->GetName() << ";"
+        << "processor_core=" << node->GetProcessorCore() << ";"
+        << "processor_type=" << node->GetProcessorClockSpeed() << ";"
+        << "RAM=" << node->GetRam() << ";"
+        << "ROM=" << node->GetRom() << ";"
+        << "links=" << node->GetLinks() << ";"
+        << "runtimes=" << node->GetSupportedRuntimes() << ";"
+        << "node_busy_counter=" << node->GetNodeBusyCounter() << ";"
+        << "data=" << node->GetProvidedData() << ";"
+        << "functions=";
+     for(auto& it : node->GetFunctionMap())
+     {
+       ss << it.first << ":" << it.second->GetEnableStatus() << ":" << it.second->GetCounter() << ":"
+          << it.second->GetMissExecCounter() << ":" << it.second->GetCpu() << ":" << it.second->GetRam() << ":"
+          << it.second->GetRom() << ":" << it.second->GetFuncSize() << ":" << it.second->GetInputList();
+     }
+     return ss.str();
+   }
+
+   void
+   ParseTextStatus(const std::string& content, OrchestratorNodeInfoStorage::computeNode& node)
+   {
+     std::vector<std::string> tokens;
+     boost::split(tokens, content, boost::is_any_of(";"));
+     for(uint32_t i = 0; i < tokens.size(); i++)
+     {
+       std::vector<std::string> values;
+       boost::split(values, tokens[i], boost::is_any_of("="));
+       if(values[0] == "name")
+         node.nodeName = Name(values[1]);
+       else if(values[0] == "processor_core")
+         node.cpu.second = std::stoi(values[1]);
+       else if(values[0] == "RAM")
+         node.ram.second = std::stoi(values[1]);
+       else if(values[0] == "ROM")
+         node.rom.second = std::stoi(values[1]);
+       else if(values[0] == "links")
+         boost::split(node.links.second, values[1], boost::is_any_of(","));
+       else if(values[0] == "runtimes")
+         boost::split(node.runtimes_supported.second, values[1], boost::is_any_of(","));
+       else if(values[0] == "node_busy_counter")
+         node.nodeBusyCounter.second = std::stoi(values[1]);
+       else if(values[0] == "functions")
+       {
+         std::vector<std::string> functions_all;
+         boost::split(functions_all, values[1], boost::is_any_of("/"));
+         for(auto iter = std::next(functions_all.begin()); iter != functions_all.end(); iter++)
+         {
+           OrchestratorNodeInfoStorage::functionInfo func;
+           std::vector<std::string> each;
+           boost::split(each, *iter, boost::is_any_of(":"));
+           func.funcName = Name("/" + each[0]);
+           func.status = (each[1] == "1");
+           func.func_exe_counter = std::stoi(each[2]);
+           func.func_interest_counter = std::stoi(each[3]);
+           func.cores = std::stoi(each[4]);
+           func.ram = std::stoi(each[5]);
+           func.rom = std::stoi(each[6]);
+           func.size_bytes = std::stoi(each[7]);
+           boost::split(func.input_data_list, each[8], boost::is_any_of(","));
+           node.functions_current.push_back(func);
+         }
+       }
+     }
+   }
+
+   int main(int argc, char* argv[])
+   {
+     uint32_t num_functions = 80;
+     uint32_t iterations = 10000;
+     CommandLine cmd;
+     cmd.AddValue("functions", "no of functions hosted by the compute node", num_functions);
+     cmd.AddValue("iterations", "no of encode/decode rounds", iterations);
+     cmd.Parse(argc, argv);
+
+     Ptr<IncOrchestrationComputeNode> node = CreateObject<IncOrchestrationComputeNode>();
+     node->SetName("compute_node_1");
+     node->SetProcessorCore(4);
+     node->SetRam(16);
+     node->SetRom(64);
+     node->SetLinks("l1,l2,l3");
+     node->SetSupportedRuntimes("docker,python,java");
+     for(uint32_t i = 0; i < num_functions; i++)
+     {
+       std::string name = "/func-" + std::to_string(i);
+       Ptr<INC_Computation> func = CreateObject<INC_Computation>();
+       func->setName(name);
+       func->SetCpu(1);
+       func->SetRam(2);
+       func->SetRom(16);
+       func->SetFuncSize(2000);
+       func->SetInputList("Operand_" + std::to_string(i % 10) + ",Operand_" + std::to_string((i + 1) % 10));
+       node->AddNewFunction(name, func);
+       if(i % 2 == 0)
+         node->EnableFunction(name);
+     }
+
+     std::string text = EncodeTextStatus(node);
+     ::ndn::Block tlv = OrchestrationMessageCodec::EncodeNodeStatus(orchestration_tlv::NodeStatusFetch, node);
+
+     auto start = std::chrono::steady_clock::now();
+     for(uint32_t i = 0; i < iterations; i++)
+       text = EncodeTextStatus(node);
+     double textEncode = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+     start = std::chrono::steady_clock::now();
+     for(uint32_t i = 0; i < iterations; i++)
+       tlv = OrchestrationMessageCodec::EncodeNodeStatus(orchestration_tlv::NodeStatusFetch, node);
+     double tlvEncode = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+     start = std::chrono::steady_clock::now();
+     for(uint32_t i = 0; i < iterations; i++)
+     {
+       OrchestratorNodeInfoStorage::computeNode parsed;
+       ParseTextStatus(text, parsed);
+     }
+     double textDecode = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+     start = std::chrono::steady_clock::now();
+     for(uint32_t i = 0; i < iterations; i++)
+     {
+       OrchestratorNodeInfoStorage::computeNode parsed;
+       OrchestrationMessageCodec::DecodeNodeStatus(tlv.value(), tlv.value_size(), parsed);
+     }
+     double tlvDecode = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+     std::cout << "functions=" << num_functions << " iterations=" << iterations << std::endl;
+     std::cout << "format\tsize(bytes)\tencode(us/msg)\tdecode(us/msg)" << std::endl;
+     std::cout << "text\t" << text.size() << "\t" << textEncode / iterations << "\t" << textDecode / iterations << std::endl;
+     std::cout << "tlv\t" << tlv.size() << "\t" << tlvEncode / iterations << "\t" << tlvDecode / iterations << std::endl;
+     return 0;
+   }
+  }
+ }
+}
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::ndn::inc::main(argc, argv);
+}
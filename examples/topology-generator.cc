@@ -0,0 +1,107 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/incSIM-module.h"
+#include <chrono>
+
+namespace ns3 {
+ namespace ndn {
+   namespace inc {
+   /*
+   Writes a synthetic annotated topology (compute nodes, consumers and links, no functions or workload) generated by
+   IncTopologyGenerator: --type=fat-tree (--k, --hosts per edge node), --type=ba (--nodes, --m links per new node),
+   --type=geometric (--clusters of --nodes each) or --type=rocketfuel (--map, a .cch file).
+   Run with: ./waf --run "topology-generator --type=ba --nodes=100000 --consumers=10000 --file=ba.txt"
+   */
+   int main(int argc, char* argv[])
+   {
+     std::string type = "fat-tree";
+     std::string file = "generated-topology.txt";
+     std::string map;
+     uint32_t seed = 1;
+     uint32_t k = 8;
+     uint32_t hosts = 2;
+     uint32_t nodes = 1000;
+     uint32_t m = 2;
+     uint32_t clusters = 10;
+     uint32_t consumers = 100;
+     double area = 1000;
+     double clusterRadius = 50;
+     double linkRadius = 10;
+     double spread = 0.25;
+     CommandLine cmd;
+     cmd.AddValue("type", "fat-tree, ba, geometric or rocketfuel", type);
+     cmd.AddValue("file", "where the topology is written to", file);
+     cmd.AddValue("map", "Rocketfuel map to import", map);
+     cmd.AddValue("seed", "seed of the generator", seed);
+     cmd.AddValue("k", "arity of the fat-tree", k);
+     cmd.AddValue("hosts", "consumers per fat-tree edge node", hosts);
+     cmd.AddValue("nodes", "no of compute nodes (ba), per cluster (geometric)", nodes);
+     cmd.AddValue("m", "links of every new node (ba)", m);
+     cmd.AddValue("clusters", "no of edge clusters (geometric)", clusters);
+     cmd.AddValue("consumers", "no of consumers (ba, geometric, rocketfuel)", consumers);
+     cmd.AddValue("area", "side of the square the clusters are placed in (geometric)", area);
+     cmd.AddValue("clusterRadius", "radius of a cluster (geometric)", clusterRadius);
+     cmd.AddValue("linkRadius", "distance up to which cluster members are linked (geometric)", linkRadius);
+     cmd.AddValue("spread", "relative variation of the node resources within a tier", spread);
+     cmd.Parse(argc, argv);
+
+     IncScenario scenario;
+     IncTopologyGenerator generator(seed);
+     generator.SetSpread(spread);
+     auto start = std::chrono::steady_clock::now();
+     if(type == "fat-tree")
+       generator.FatTree(scenario, k, hosts);
+     else if(type == "ba")
+       generator.BarabasiAlbert(scenario, nodes, m, consumers);
+     else if(type == "geometric")
+       generator.GeometricClusters(scenario, clusters, nodes, area, clusterRadius, linkRadius, consumers);
+     else if(type == "rocketfuel")
+     {
+       std::string error;
+       if(!generator.ImportRocketfuel(scenario, map, consumers, error))
+         NS_FATAL_ERROR(error);
+     }
+     else
+       NS_FATAL_ERROR("Unknown topology type " << type);
+     double generated = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+     if(!scenario.Save(file))
+       NS_FATAL_ERROR("Cannot write topology file " << file);
+     std::cout << "nodes=" << scenario.GetNodes().size() << " links=" << scenario.GetLinks().size()
+               << " time(ms)=" << generated << std::endl;
+     return 0;
+   }
+  }
+ }
+}
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::ndn::inc::main(argc, argv);
+}
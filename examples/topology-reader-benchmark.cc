@@ -0,0 +1,234 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/incSIM-module.h"
+#include <boost/algorithm/string.hpp>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+
+namespace ns3 {
+ namespace ndn {
+   namespace inc {
+   /*
+   Startup time of large annotated topologies. A synthetic topology (half compute nodes in a binary tree, half consumers
+   attached to them, one request and one data item per consumer) is written once. It is then parsed by the former
+   section loops (istringstream per line, map based link dedup, linear function scan per consumer request) and by
+   IncTopologyParser. With --read=1 the topology is also loaded through IncNdnAnnotatedTopologyReader::ReadTopology,
+   which includes creating the ns-3 nodes and point-to-point links.
+   Run with: ./waf --run "topology-reader-benchmark --nodes=100000 --functions=100"
+   */
+
+   std::string
+   ComputeName(uint32_t index)
+   {
+     return index == 0 ? std::string("orchestrator") : "compute_node_" + std::to_string(index);
+   }
+
+   void
+   WriteTopology(const std::string& file, uint32_t num_nodes, uint32_t num_functions)
+   {
+     uint32_t num_compute = std::max<uint32_t>(1, num_nodes / 2);
+     uint32_t num_consumer = num_nodes - num_compute;
+     std::ofstream fout(file);
+     fout << "router\n";
+     fout << "orchestrator\t100\t30\t100\t8000\t10000\t10000\t100\tl1,l2,l3\tdocker,python,java\n";
+     for(uint32_t i = 1; i < num_compute; i++)
+       fout << "compute_node_" << i << "\t" << (i % 1000) << "\t" << (i / 1000) << "\t4\t4000\t40960\t2000\t10\tl2,l3\tdocker,python,java\n";
+     for(uint32_t i = 0; i < num_consumer; i++)
+       fout << "consumer_" << i << "\t20\t" << i << "\tNaN\tNaN\tNaN\tNaN\tNaN\tNaN\n";
+
+     fout << "\nlinks\n";
+     for(uint32_t i = 1; i < num_compute; i++)
+       fout << ComputeName(i / 2) << "\t" << ComputeName(i) << "\t1000Mbps\t1\t5ms\t100\n";
+     for(uint32_t i = 0; i < num_consumer; i++)
+       fout << ComputeName(i % num_compute) << "\tconsumer_" << i << "\t100Mbps\t1\t2ms\t10\n";
+
+     fout << "\nfunctions\n";
+     for(uint32_t i = 0; i < num_functions; i++)
+       fout << "func-" << i << "\tOperand_1,Operand_2\tdocker;\t100\t16\t1\t3.0\t4000\t10000\t500\n";
+
+     fout << "\ninitial function status\n";
+     for(uint32_t i = 0; i < num_functions; i++)
+       fout << ComputeName(num_compute > 1 ? 1 + i % (num_compute - 1) : 0) << "\tfunc-" << i << "\n";
+
+     fout << "\nconsumer section\n";
+     for(uint32_t i = 0; i < num_consumer; i++)
+       fout << "consumer_" << i << "\tfunc-" << (i % num_functions) << "\tOperand_" << (i % 10) << ",Operand_" << ((i + 1) % 10) << "\t5\t2\t1\t100\n";
+
+     fout << "\ninitial data section\n";
+     for(uint32_t i = 0; i < num_consumer; i++)
+       fout << "consumer_" << i << "\tOperand_" << (i % 10) << "\t500\t2\n";
+   }
+
+   /*
+   The parsing work of the former ReadTopology without creating ns-3 objects: returns the number of parsed lines
+   */
+   uint32_t
+   ParseLegacy(const std::string& file)
+   {
+     std::ifstream topgen(file);
+     std::map<std::string, uint32_t> names; //stands in for ns3::Names
+     std::map<std::string, std::set<std::string>> processedLinks;
+     std::vector<std::pair<std::string, std::string>> functions;
+     std::unordered_map<std::string, std::vector<std::string>> status;
+     std::string section;
+     uint32_t lines = 0;
+     std::string line;
+     while(std::getline(topgen, line))
+     {
+       lines++;
+       if(line.empty() || line[0] == '#')
+         continue;
+       if(line == "router" || line == "links" || line == "functions" || line == "initial function status" ||
+          line == "consumer section" || line == "initial data section")
+       {
+         section = line;
+         continue;
+       }
+       std::istringstream lineBuffer(line);
+       if(section == "router")
+       {
+         std::string name, links, runtimes;
+         double latitude = 0, longitude = 0;
+         uint32_t core = 0, speed = 0, ram = 0, rom = 0, queue = 0;
+         lineBuffer >> name >> latitude >> longitude >> core >> speed >> ram >> rom >> queue >> links >> runtimes;
+         names.emplace(name, names.size());
+       }
+       else if(section == "links")
+       {
+         std::string from, to, capacity, metric, delay, maxPackets, lossRate;
+         lineBuffer >> from >> to >> capacity >> metric >> delay >> maxPackets >> lossRate;
+         if(processedLinks[to].size() != 0 && processedLinks[to].find(from) != processedLinks[to].end())
+           continue;
+         processedLinks[from].insert(to);
+         NS_ASSERT(names.find(from) != names.end() && names.find(to) != names.end());
+       }
+       else if(section == "functions")
+       {
+         std::string name, inputs, runtimes;
+         uint32_t ram, rom, cpu, instructions, funcSize, resultSize;
+         double execTime;
+         lineBuffer >> name >> inputs >> runtimes >> ram >> rom >> cpu >> execTime >> instructions >> funcSize >> resultSize;
+         functions.push_back(std::make_pair(name, inputs));
+       }
+       else if(section == "initial function status")
+       {
+         std::string node, func;
+         lineBuffer >> node >> func;
+         status[node].push_back(func);
+       }
+       else if(section == "consumer section")
+       {
+         std::string node, func, inputList;
+         lineBuffer >> node >> func >> inputList;
+         std::vector<std::string> inputs;
+         boost::split(inputs, inputList, boost::is_any_of(","));
+         for(auto& function : functions)
+         {
+           if(function.first == func)
+           {
+             for(auto& input : inputs)
+             {
+               if(function.second.find(input) == std::string::npos)
+                 function.second.append("," + input);
+             }
+           }
+         }
+       }
+     }
+     return lines;
+   }
+
+   class CountingHandler : public IncTopologyParser::Handler
+   {
+   public:
+     virtual void
+     OnRequest(const IncConsumerRequest& request)
+     {
+       m_requests++;
+     }
+
+     uint32_t m_requests = 0;
+   };
+
+   int main(int argc, char* argv[])
+   {
+     uint32_t num_nodes = 100000;
+     uint32_t num_functions = 100;
+     bool read = false;
+     std::string file = "topology-benchmark.txt";
+     CommandLine cmd;
+     cmd.AddValue("nodes", "no of nodes of the synthetic topology", num_nodes);
+     cmd.AddValue("functions", "no of functions of the synthetic topology", num_functions);
+     cmd.AddValue("read", "also load the topology with IncNdnAnnotatedTopologyReader", read);
+     cmd.AddValue("file", "where the synthetic topology is written to", file);
+     cmd.Parse(argc, argv);
+     num_functions = std::max<uint32_t>(1, num_functions);
+
+     WriteTopology(file, num_nodes, num_functions);
+
+     auto start = std::chrono::steady_clock::now();
+     uint32_t lines = ParseLegacy(file);
+     double legacy = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+     CountingHandler handler;
+     IncTopologyParser parser(handler);
+     start = std::chrono::steady_clock::now();
+     if(!parser.Parse(file))
+       NS_FATAL_ERROR(parser.GetError());
+     double streaming = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+     std::cout << "nodes=" << parser.GetNodeCount() << " links=" << parser.GetLinkCount() << " functions="
+               << parser.GetFunctionCount() << " requests=" << handler.m_requests << " lines=" << lines << std::endl;
+     std::cout << "parser\ttime(ms)" << std::endl;
+     std::cout << "legacy\t" << legacy << std::endl;
+     std::cout << "streaming\t" << streaming << std::endl;
+
+     if(read)
+     {
+       IncNdnAnnotatedTopologyReader topologyReader("", 1);
+       topologyReader.SetFileName(file);
+       start = std::chrono::steady_clock::now();
+       topologyReader.ReadTopology();
+       double full = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+       std::cout << "ReadTopology\t" << full << std::endl;
+     }
+     return 0;
+   }
+  }
+ }
+}
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::ndn::inc::main(argc, argv);
+}
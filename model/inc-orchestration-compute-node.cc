@@ -26,6 +26,7 @@
 
 #include "inc-orchestration-compute-node.h"
 #include "ns3/log.h"
+#include "ns3/orchestration-message-codec.hpp"
 #include <boost/algorithm/string.hpp>
 
 
@@ -50,6 +51,14 @@ namespace ns3{
                       "Duration for which the node's queue was full",
                       MakeTraceSourceAccessor(&IncOrchestrationComputeNode::m_fullQueueTimer),
                       "ns3::ndn::inc::IncOrchestrationComputeNode::FullQueueCallback")
+        .AddTraceSource("LoadChanged",
+                      "Queue fill or node busy counter of the node has changed",
+                      MakeTraceSourceAccessor(&IncOrchestrationComputeNode::m_loadChanged),
+                      "ns3::ndn::inc::IncOrchestrationComputeNode::LoadChangedCallback")
+        .AddTraceSource("MissedExecution",
+                      "A request for a function was forwarded and counted as missed execution",
+                      MakeTraceSourceAccessor(&IncOrchestrationComputeNode::m_missedExecution),
+                      "ns3::ndn::inc::IncOrchestrationComputeNode::MissedExecutionCallback")
         ;
 
       return tid;
@@ -61,6 +70,9 @@ namespace ns3{
         m_provided_data = "null";
         m_full_timer_started=false;
         m_empty_timer_started = false;
+        m_queue_size = 0;
+        m_queue_fill = 0;
+        m_nodeBusyCounter = 0;
         //InitialFunctionRegister();
         NS_LOG_FUNCTION (this);
     }
@@ -69,6 +81,11 @@ namespace ns3{
         Ptr<Node> n=CreateObject<Node> (sid);
         this->SetNode(n);
         m_provided_data = "null";
+        m_full_timer_started=false;
+        m_empty_timer_started = false;
+        m_queue_size = 0;
+        m_queue_fill = 0;
+        m_nodeBusyCounter = 0;
         //InitialFunctionRegister();
         NS_LOG_FUNCTION (this);
     }
@@ -127,6 +144,10 @@ namespace ns3{
         this->m_queue_fill = 0;
      }
 
+     uint32_t IncOrchestrationComputeNode::GetQueueFill(){
+        return this->m_queue_fill;
+     }
+
      bool IncOrchestrationComputeNode::IncrementQueueFill()
      {
        if(this->m_queue_fill < this->m_queue_size)
@@ -138,6 +159,7 @@ namespace ns3{
             m_emptyQueueTimer(Simulator::Now().GetSeconds()-m_q_empty_time);
           }
           this->m_queue_fill++;
+          m_loadChanged(m_queue_fill, m_nodeBusyCounter);
           return true;
        }
         else
@@ -161,6 +183,7 @@ namespace ns3{
            m_fullQueueTimer(Simulator::Now().GetSeconds()-m_q_full_time);
          }
          this->m_queue_fill--;
+         m_loadChanged(m_queue_fill, m_nodeBusyCounter);
          return true;
        }
        else
@@ -270,6 +293,17 @@ namespace ns3{
     IncOrchestrationComputeNode::AddNodeBusyCounter()
     {
       m_nodeBusyCounter = m_nodeBusyCounter + 1;
+      m_loadChanged(m_queue_fill, m_nodeBusyCounter);
+    }
+
+    void
+    IncOrchestrationComputeNode::AddMissExecCounter(Ptr<INC_Computation> func)
+    {
+      //the function only counts a miss while it is disabled
+      uint32_t misses = func->GetMissExecCounter();
+      func->AddMissExecCounter();
+      if(func->GetMissExecCounter() != misses)
+        m_missedExecution(func->getName().toUri());
     }
 
     shared_ptr<Face>
@@ -379,6 +413,26 @@ namespace ns3{
     }
 
 
+    bool
+    IncOrchestrationComputeNode::SetFunctionPriority(std::string func_name, uint32_t priority){
+      if(m_func_map.find(func_name)==m_func_map.end()){
+        NS_LOG_INFO("[INC Node] function "<<func_name<<" not found");
+        return false;
+      }
+      m_func_priority[func_name]=priority;
+      //an enabled function already has a next hop, update its cost
+      if(m_func_map.at(func_name)->GetEnableStatus()==1 && boost::algorithm::to_lower_copy(m_inc_strategy)=="nfn" && m_producer_app_face){
+        notifyFibFunctionEnable(func_name);
+      }
+      return true;
+    }
+
+    uint32_t
+    IncOrchestrationComputeNode::GetFunctionPriority(std::string func_name){
+      auto it=m_func_priority.find(func_name);
+      return it==m_func_priority.end()?0:it->second;
+    }
+
       void
    	  IncOrchestrationComputeNode::notifyFibFunctionEnable(std::string func_name)
       {
@@ -396,7 +450,7 @@ namespace ns3{
     	  //add face to the fib entry
    		  if(m_producer_app_face)
         {
-   			  fib.addOrUpdateNextHop(*entry, *m_producer_app_face, 0);
+   			  fib.addOrUpdateNextHop(*entry, *m_producer_app_face, GetFunctionPriority(func_name));
 			    NS_LOG_INFO("[INC Node] update FIB about function enable, finish update");
    		  }
         else
@@ -518,6 +572,60 @@ namespace ns3{
 
       }
 
+      bool
+      IncOrchestrationComputeNode::FindCommandResult(uint32_t seq, bool& success)
+      {
+        auto itr = m_command_results.find(seq);
+        if (itr == m_command_results.end())
+          return false;
+        success = itr->second;
+        return true;
+      }
+
+      void
+      IncOrchestrationComputeNode::StoreCommandResult(uint32_t seq, bool success)
+      {
+        //retransmissions only happen within a few timeouts, a short window of results is enough
+        static const size_t window = 64;
+        m_command_results[seq] = success;
+        while (m_command_results.size() > window)
+          m_command_results.erase(m_command_results.begin());
+      }
+
+      bool
+      IncOrchestrationComputeNode::ApplyCommand(const OrchestrationNodeCommand& command,
+                                                std::vector<std::string>& enabled, std::vector<std::string>& disabled)
+      {
+        bool flag = true;
+        if (command.seq != 0 && FindCommandResult(command.seq, flag))
+          {
+            NS_LOG_INFO("[INC Node] command " << command.seq << " already applied");
+            return flag;
+          }
+        for (auto& func_name : command.disable)
+          {
+            bool done = DisableFunction(func_name);
+            AddToExcludeList(func_name);
+            if (done)
+              disabled.push_back(func_name);
+            flag = flag && done;
+          }
+        for (auto& func_name : command.enable)
+          {
+            bool done = EnableFunction(func_name);
+            if (CheckExcludeList(func_name))
+              RemoveFromExcludeList(func_name);
+            if (done)
+              enabled.push_back(func_name);
+            flag = flag && done;
+          }
+        for (auto& priority : command.priorities)
+          flag = SetFunctionPriority(priority.first, priority.second) && flag;
+        if (command.seq != 0)
+          StoreCommandResult(command.seq, flag);
+        return flag;
+      }
+
 
     }
   }
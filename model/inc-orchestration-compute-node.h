@@ -29,12 +29,15 @@
 
 #include "ns3/node.h"
 #include <unordered_map>
+#include <map>
 #include "ns3/INC-Computation.hpp"
 
 
 namespace ns3{
     namespace ndn{
         namespace inc{
+    struct OrchestrationNodeCommand;
+
     /**
      *
      * \brief A class that couples a ns3::Node with its extra information,
@@ -63,6 +66,7 @@ namespace ns3{
 
            uint32_t GetQueueSize();
            void SetQueueSize(uint32_t value);
+           uint32_t GetQueueFill();
            bool IncrementQueueFill();
            bool DecrementQueueFill();
            bool IsQueueFull();
@@ -106,6 +110,13 @@ namespace ns3{
            virtual bool
            DisableFunction(std::string function_name);
 
+           //cost of the local producer face in the FIB entry of the function, lower is preferred
+           bool
+           SetFunctionPriority(std::string function_name, uint32_t priority);
+
+           uint32_t
+           GetFunctionPriority(std::string function_name);
+
            void
            AddToExcludeList(std::string function_name);
 
@@ -115,6 +126,20 @@ namespace ns3{
            bool
            CheckExcludeList(std::string function_name);
 
+           //results of the last sequenced orchestration commands, so that a retransmitted command is applied only once
+           bool
+           FindCommandResult(uint32_t seq, bool& success);
+
+           void
+           StoreCommandResult(uint32_t seq, bool success);
+
+           //applies a node command of the orchestrator, a retransmitted one is answered with the stored result.
+           //Functions that actually changed their status are added to enabled and disabled.
+           //True only if every single change was applied
+           bool
+           ApplyCommand(const OrchestrationNodeCommand& command, std::vector<std::string>& enabled,
+                        std::vector<std::string>& disabled);
+
 
            IncOrchestrationComputeNode();
            IncOrchestrationComputeNode(uint32_t systemId);
@@ -129,6 +154,10 @@ namespace ns3{
            void
            ResetNodeBusyCounter();
 
+           //counts a request the node forwarded instead of executing func, fires MissedExecution if it was counted
+           void
+           AddMissExecCounter(Ptr<INC_Computation> func);
+
            void
 		   notifyFibFunctionEnable(std::string func_name);
 
@@ -155,6 +184,8 @@ namespace ns3{
 
           typedef void (*EmptyQueueCallback)(double emptyTime);
           typedef void (*FullQueueCallback)(double fullTime);
+          typedef void (*LoadChangedCallback)(uint32_t queueFill, uint32_t nodeBusyCounter);
+          typedef void (*MissedExecutionCallback)(std::string funcName);
 
         private:
 
@@ -181,12 +212,18 @@ namespace ns3{
             double m_q_full_time;
             //function map used for function management
             std::unordered_map<std::string,Ptr<INC_Computation>> m_func_map;
+            std::unordered_map<std::string,uint32_t> m_func_priority;
+            std::map<uint32_t,bool> m_command_results;
 
             //the app face used for NFD manipulation
             shared_ptr<Face> m_producer_app_face;
 
             TracedCallback<double> m_emptyQueueTimer;
             TracedCallback<double> m_fullQueueTimer;
+            //fired whenever the queue fill or the busy counter changes, used for push based status reporting
+            TracedCallback<uint32_t, uint32_t> m_loadChanged;
+            //fired for every counted missed execution, used for push based status reporting
+            TracedCallback<std::string> m_missedExecution;
     };
         }
     }
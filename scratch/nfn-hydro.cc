@@ -46,6 +46,7 @@ namespace ns3 {
    {
      double interval = 20;
      bool orchestrationSwitch=false;
+     bool pushTelemetry = false;
      bool nfn_load_distribution_scenario = true;
      bool wrongParam = false;
      bool homogeneous_nodes = false;
@@ -71,6 +72,24 @@ namespace ns3 {
      std::string queue_traceFile = "queue_traceFile.txt";
      std::string resource_utilization_traceFile = "Node_ResUtilization.txt";
      std::string strategy = "NFN";
+     std::string orchestration_strategy = "Function Switch";
+     std::string forecaster = "";
+     bool asyncStrategy = false;
+     bool topology_cache = false;
+     bool save_topology = true;
+     std::string workload_trace = "";
+     bool multi_flow_consumer = false;
+     std::string arrival_process = "none";
+     double deadline = 0;
+     double hedge_percentile = 0;
+     std::string forwarding = "multicast";
+     std::string strategy_traceFile = "orch_strategy_traceFile.txt";
+     std::string shard_traceFile = "shard_traceFile.txt";
+     std::string command_traceFile = "command_traceFile.txt";
+     std::string workload_traceFile = "workload_traceFile.txt";
+     std::string deadline_traceFile = "deadline_traceFile.txt";
+     std::string hedge_traceFile = "hedge_traceFile.txt";
+     uint32_t shards = 1;
      // Read optional command-line parameters (e.g., enable visualizer with ./waf --run=<> --visualize
      CommandLine cmd;
      cmd.AddValue("consumer-nodes","no of edge consumer nodes", num_consumer_nodes);
@@ -85,14 +104,40 @@ namespace ns3 {
      cmd.AddValue("seed", "A seed iput for random number generator", seed);
      cmd.AddValue("interval", "interval of periodic orchestration requests", interval);
      cmd.AddValue("orchestration-switch", "turn orchestration switch on/off", orchestrationSwitch);
+     cmd.AddValue("push-telemetry", "compute nodes push their status when a load threshold is crossed", pushTelemetry);
+     cmd.AddValue("shards", "number of orchestrators, each owning a shard of the compute nodes", shards);
+     cmd.AddValue("orchestration-strategy", "placement strategy of the orchestrator: Function Switch, Greedy or LP", orchestration_strategy);
+     cmd.AddValue("forecaster", "demand forecaster the strategy plans with: EWMA, Holt-Winters or AR, empty for none", forecaster);
+     cmd.AddValue("async-strategy", "run the strategy on a worker thread, its decision is applied after DecisionLatency", asyncStrategy);
      cmd.AddValue("wrong-parameter", "use wrong number of parameters (only for demo purpose)", wrongParam);
      cmd.AddValue("topology-path","folder where the topology file can be accessed from", topology_path);
+     cmd.AddValue("topology-cache", "reuse a precompiled binary topology generated with the same parameters", topology_cache);
+     cmd.AddValue("save-topology", "also write the generated topology as text file to topology-path", save_topology);
+     cmd.AddValue("workload-trace", "replay this function invocation trace from the consumer nodes instead of the generated requests", workload_trace);
+     cmd.AddValue("multi-flow-consumer", "send all requests of a consumer node from one app instead of one app per function prefix", multi_flow_consumer);
+     cmd.AddValue("arrival-process", "arrival process of the generated requests: none, uniform, exponential, mmpp, diurnal, on-off or flash-crowd", arrival_process);
+     cmd.AddValue("deadline", "seconds after its first transmission the result of a request is useless, 0 for none", deadline);
+     cmd.AddValue("forwarding-strategy", "NFD forwarding strategy of all nodes: multicast or best-route", forwarding);
+     cmd.AddValue("hedge-percentile", "percentile of the response times after which a request is sent again to another next hop, 0 for none", hedge_percentile);
      cmd.AddValue("trace-path", "folder where the trace files are stored", trace_path);
      cmd.AddValue("sim-time", "simulation time in seconds", simulation_time);
      cmd.AddValue("inc_strategy", "the inc strategy switch", strategy);
 
      cmd.Parse(argc, argv);
      Time::SetResolution (Time::NS);
+     //topology, workload, consumers and link losses draw from named streams derived from the seed
+     IncRandomStreams::SetMasterSeed(seed);
+     //a day long diurnal cycle is flat over a run of minutes, one cycle per run unless a Period is given inline
+     Config::SetDefault("ns3::ndn::inc::IncDiurnalArrivals::Period", TimeValue(Seconds(simulation_time)));
+
+     //hedging lives in INC_ConsumerBaseApp, the multi-flow consumer has no hedge timer of its own
+     NS_ABORT_MSG_IF(hedge_percentile > 0 && multi_flow_consumer && workload_trace.empty(),
+                     "hedge-percentile is not supported with multi-flow-consumer");
+     NS_ABORT_MSG_IF(forwarding != "multicast" && forwarding != "best-route",
+                     "Unknown forwarding-strategy " << forwarding << ", use multicast or best-route");
+     //a hedge needs a next hop its request was not sent to yet, multicast already uses them all
+     NS_ABORT_MSG_IF(hedge_percentile > 0 && forwarding != "best-route",
+                     "hedge-percentile requires forwarding-strategy=best-route");
 
      //-----------------------------------------------------------------------------//
      //------------------------Logging within applications--------------------------//
@@ -113,28 +158,88 @@ namespace ns3 {
      num_compute_nodes = t1_nodes + t2_nodes + t3_nodes + 2;
      std::cout << "num_data is " << num_data << std::endl;
      std::cout << "num_compute_nodes is " << num_compute_nodes << std::endl;
-     DataGen generator(seed, (topology_path.append("inc_topology.txt")));
-     if(nfn_load_distribution_scenario == true)
+
+     //orchestrated nodes 2..num_compute_nodes-1 are split into contiguous shards (the generator lists them tier by tier).
+     //The first node of a shard orchestrates it and node 0 coordinates the shards, with one shard node 0 orchestrates all.
+     NS_ABORT_MSG_IF(shards < 1 || shards > num_compute_nodes - 2, "shards must be between 1 and the number of orchestrated nodes");
+     std::vector<uint32_t> shard_orchestrator;
+     std::vector<uint32_t> shard_of(num_compute_nodes, 0);
+     if(shards == 1)
      {
-       generator.generate_data(num_consumer_nodes, t1_nodes, t2_nodes, t3_nodes,
-         cloud_scale, num_of_func, num_data, std::pair<int, int>(0,input_range),
-         std::pair<int, int>(7, freq_range), simulation_time, true,
-         nfn_load_distribution_scenario = true, homogeneous_nodes);
+       shard_orchestrator.push_back(0);
      }
      else
      {
-       generator.generate_data(num_consumer_nodes, t1_nodes, t2_nodes, t3_nodes,
-         cloud_scale, num_of_func, num_data, std::pair<int,int>(0,input_range),
-         std::pair<int, int>(7,freq_range), simulation_time, true,
-         nfn_load_distribution_scenario = false, homogeneous_nodes);
+       for(uint32_t s = 0; s < shards; s++)
+       {
+         shard_orchestrator.push_back(2 + s * (num_compute_nodes - 2) / shards);
+       }
+       for(uint32_t i = 2, s = 0; i < num_compute_nodes; i++)
+       {
+         if(s + 1 < shards && i >= shard_orchestrator[s + 1])
+           s++;
+         shard_of[i] = s;
+       }
+     }
+     std::string topology_file = topology_path + "inc_topology.txt";
+     std::string cache_file;
+     uint64_t topology_key = 0;
+     bool cached = false;
+     //the generated scenario is handed to the reader and the node info parser in memory, files are only written on request
+     IncScenario scenario;
+     if(topology_cache)
+     {
+       //every generator parameter goes into the key, runs with the same topology and workload share one cache
+       std::stringstream parameters;
+       parameters << "hier version=" << IncTopologyCache::VERSION << " seed=" << seed << " consumers=" << num_consumer_nodes
+                  << " t1=" << t1_nodes << " t2=" << t2_nodes << " t3=" << t3_nodes << " cloud=" << cloud_scale
+                  << " functions=" << num_of_func << " data=" << num_data << " inputs=" << input_range
+                  << " freq=" << freq_range << " time=" << simulation_time << " load=" << nfn_load_distribution_scenario
+                  << " homogeneous=" << homogeneous_nodes;
+       topology_key = IncTopologyCache::HashKey(parameters.str());
+       std::stringstream name;
+       name << topology_path << "inc_topology-" << std::hex << topology_key << ".bin";
+       cache_file = name.str();
+       IncTopologyCache cache;
+       if(IncTopologyCache::IsCache(cache_file) && cache.Open(cache_file) && cache.GetKey() == topology_key)
+       {
+         NS_LOG_INFO("reusing topology cache " << cache_file);
+         std::string error;
+         NS_ABORT_MSG_IF(!scenario.Load(cache_file, error), error);
+         cached = true;
+       }
+     }
+
+     if(!cached)
+     {
+       DataGen generator(seed, save_topology ? topology_file : "");
+       if(nfn_load_distribution_scenario == true)
+       {
+         generator.generate_data(num_consumer_nodes, t1_nodes, t2_nodes, t3_nodes,
+           cloud_scale, num_of_func, num_data, std::pair<int, int>(0,input_range),
+           std::pair<int, int>(7, freq_range), simulation_time, true,
+           nfn_load_distribution_scenario = true, homogeneous_nodes);
+       }
+       else
+       {
+         generator.generate_data(num_consumer_nodes, t1_nodes, t2_nodes, t3_nodes,
+           cloud_scale, num_of_func, num_data, std::pair<int,int>(0,input_range),
+           std::pair<int, int>(7,freq_range), simulation_time, true,
+           nfn_load_distribution_scenario = false, homogeneous_nodes);
+       }
+       scenario = generator.GetScenario();
+       if(topology_cache)
+       {
+         std::string error;
+         NS_ABORT_MSG_IF(!IncTopologyCache::Compile(scenario, cache_file, topology_key, error), error);
+       }
      }
 
      IncNdnAnnotatedTopologyReader topologyReader("", 1);
-     topologyReader.SetFileName(topology_path);
 
      std::pair<NodeContainer,NodeContainer> NC_nodes;
      //get NodeContainer from topology reader
-     NC_nodes = topologyReader.ReadTopology();
+     NC_nodes = topologyReader.ReadTopology(scenario);
      //get list of compute nodes and consumer nodes from topology reader
      std::vector<Ptr<IncOrchestrationComputeNode>> computeNodes = topologyReader.GetComputeNodes();
      std::vector<Ptr<Node>> consumerNodes = topologyReader.GetConsumerNodes();
@@ -181,8 +286,11 @@ namespace ns3 {
      ndnHelper.InstallAll();
      topologyReader.ApplyOspfMetric();
 
-     ndn::StrategyChoiceHelper::Install(NC_nodes.first,"","/localhost/nfd/strategy/Multicast");
-     ndn::StrategyChoiceHelper::Install(NC_nodes.second,"", "/localhost/nfd/strategy/Multicast");
+     std::string forwarding_strategy = "/localhost/nfd/strategy/Multicast";
+     if(forwarding == "best-route")
+       forwarding_strategy = "/localhost/nfd/strategy/best-route";
+     ndn::StrategyChoiceHelper::Install(NC_nodes.first,"",forwarding_strategy);
+     ndn::StrategyChoiceHelper::Install(NC_nodes.second,"", forwarding_strategy);
 
      ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
      ndnGlobalRoutingHelper.Install(NC_nodes.first);
@@ -192,7 +300,7 @@ namespace ns3 {
      //-----------------------------------------------------------------------------//
 
 
-     parserNodeInfo node_info_parser(topology_path);
+     parserNodeInfo node_info_parser(scenario);
      std::vector<compute_node_struct> compute_node_info;
      compute_node_info = node_info_parser.update_compute_info(computeNodes);
      std::cout<<"size of compute_node_info is " << compute_node_info.size() << std::endl;
@@ -236,6 +344,7 @@ namespace ns3 {
          OrchestratorProducer.SetPrefix(compute_node_info.at(i).node_prefix);
          OrchestratorProducer.SetAttribute("PayloadSize", StringValue("1024"));
          OrchestratorProducer.SetAttribute("ComputeNodePointer",PointerValue(computeNodes.at(i)));
+         OrchestratorProducer.SetAttribute("PushTelemetry", BooleanValue(pushTelemetry));
          OrchestratorProducer.Install(NC_nodes.first.Get(i));
        }
 
@@ -245,32 +354,74 @@ namespace ns3 {
          ndn::AppHelper OrchestratorHelper_BootStrap("ns3::ndn::inc::NdnOrchestrationCommunicationApp");
          OrchestratorHelper_BootStrap.SetPrefix(compute_node_info.at(i).node_prefix+"/BootstrapInfo");
          OrchestratorHelper_BootStrap.SetAttribute("ExecutionTime", TimeValue(Seconds(1.0)));
-         OrchestratorHelper_BootStrap.Install(NC_nodes.first.Get(0));
+         OrchestratorHelper_BootStrap.Install(NC_nodes.first.Get(shard_orchestrator[shard_of[i]]));
        }
      }
 
      //-----------------------------------------------------------------------------//
      //-------------------------Function Execution Requests-------------------------//
      //-----------------------------------------------------------------------------//
-     int t_i=0;
-     for(auto itr = consumer_node_info.begin();
-       itr != consumer_node_info.end(); ++itr)
+     //a replayed trace takes the place of the generated requests, its entities are spread over the consumer nodes
+     Ptr<IncTraceReplayer> replayer;
+     if(!workload_trace.empty())
+     {
+       replayer = CreateObject<IncTraceReplayer>();
+       replayer->SetAttribute("File", StringValue(workload_trace));
+       ndn::AppHelper replayHelper("ns3::ndn::inc::TraceReplayConsumerApp");
+       replayHelper.SetAttribute("ComputeNode", BooleanValue(false));
+       replayHelper.SetAttribute("Deadline", TimeValue(Seconds(deadline)));
+       replayHelper.SetAttribute("HedgePercentile", DoubleValue(hedge_percentile));
+       ApplicationContainer replayApps = replayHelper.Install(NC_nodes.second);
+       replayApps.Stop(Seconds(simulation_time));
+       for(uint32_t i = 0; i < replayApps.GetN(); i++)
+         replayer->AddConsumer(DynamicCast<TraceReplayConsumerApp>(replayApps.Get(i)));
+       replayer->Start();
+     }
+     else if(multi_flow_consumer)
      {
-       int j = 0;
-       for(auto it= itr-> function_prefix.begin();
-         it != itr->function_prefix.end(); ++it)
+       int t_i=0;
+       for(auto itr = consumer_node_info.begin();
+         itr != consumer_node_info.end(); ++itr)
        {
-         ndn::AppHelper consumerHelper ("ns3::ndn::inc::ConsumerApp");
-         consumerHelper.SetPrefix(*it);
-         consumerHelper.SetAttribute("Interval", StringValue(itr->request_frequency.at(j)));
-         consumerHelper.SetAttribute("LifeTime", StringValue(itr->lifetime.at(j)));
-         consumerHelper.SetAttribute("ComputeNode", BooleanValue(false));
-         ApplicationContainer ConsumerApp = consumerHelper.Install(NC_nodes.second.Get(t_i));
-         ConsumerApp.Start(Seconds(stoi(itr->start_time.at(j))));
-         ConsumerApp.Stop(Seconds(stoi(itr->stop_time.at(j))));
-         j++;
+         Ptr<ndn::inc::MultiFlowConsumerApp> consumerApp = CreateObject<ndn::inc::MultiFlowConsumerApp>();
+         consumerApp->SetAttribute("Randomize", StringValue(arrival_process));
+         consumerApp->SetAttribute("Deadline", TimeValue(Seconds(deadline)));
+         for(size_t j = 0; j < itr->function_prefix.size(); j++)
+         {
+           consumerApp->AddFlow(itr->function_prefix.at(j), std::stod(itr->request_frequency.at(j)),
+                                Time(itr->lifetime.at(j)), Seconds(stoi(itr->start_time.at(j))),
+                                Seconds(stoi(itr->stop_time.at(j))));
+         }
+         NC_nodes.second.Get(t_i)->AddApplication(consumerApp);
+         consumerApp->SetStopTime(Seconds(simulation_time));
+         t_i++;
+       }
+     }
+     else
+     {
+       int t_i=0;
+       for(auto itr = consumer_node_info.begin();
+         itr != consumer_node_info.end(); ++itr)
+       {
+         int j = 0;
+         for(auto it= itr-> function_prefix.begin();
+           it != itr->function_prefix.end(); ++it)
+         {
+           ndn::AppHelper consumerHelper ("ns3::ndn::inc::ConsumerApp");
+           consumerHelper.SetPrefix(*it);
+           consumerHelper.SetAttribute("Interval", StringValue(itr->request_frequency.at(j)));
+           consumerHelper.SetAttribute("LifeTime", StringValue(itr->lifetime.at(j)));
+           consumerHelper.SetAttribute("ComputeNode", BooleanValue(false));
+           consumerHelper.SetAttribute("Randomize", StringValue(arrival_process));
+           consumerHelper.SetAttribute("Deadline", TimeValue(Seconds(deadline)));
+           consumerHelper.SetAttribute("HedgePercentile", DoubleValue(hedge_percentile));
+           ApplicationContainer ConsumerApp = consumerHelper.Install(NC_nodes.second.Get(t_i));
+           ConsumerApp.Start(Seconds(stoi(itr->start_time.at(j))));
+           ConsumerApp.Stop(Seconds(stoi(itr->stop_time.at(j))));
+           j++;
+         }
+         t_i++;
        }
-       t_i++;
      }
 
      for(uint32_t i = 0;i < num_compute_nodes; i++)
@@ -332,7 +483,8 @@ namespace ns3 {
          OrchestratorHelper_NodeStatusFetch.SetAttribute("Periodic", BooleanValue(true));
          OrchestratorHelper_NodeStatusFetch.SetAttribute("Interval", TimeValue(Seconds(interval)));
          OrchestratorHelper_NodeStatusFetch.SetAttribute("ExecutionTime", TimeValue(Seconds(10.0)));
-         OrchestratorHelper_NodeStatusFetch.Install(NC_nodes.first.Get(0));
+         OrchestratorHelper_NodeStatusFetch.SetAttribute("AcceptPush", BooleanValue(pushTelemetry));
+         OrchestratorHelper_NodeStatusFetch.Install(NC_nodes.first.Get(shard_orchestrator[shard_of[i]]));
        }
 
      //-----------------------------------------------------------------------------//
@@ -341,12 +493,41 @@ namespace ns3 {
 
 
        ndn::AppHelper OrchestratorHelper_FunctionCounter("ns3::ndn::inc::OrchestrationManagementApp");
-       OrchestratorHelper_FunctionCounter.SetAttribute("OrchestrationStrategy", StringValue("Function Switch"));
+       OrchestratorHelper_FunctionCounter.SetAttribute("OrchestrationStrategy", StringValue(orchestration_strategy));
+       OrchestratorHelper_FunctionCounter.SetAttribute("Forecaster", StringValue(forecaster));
+       OrchestratorHelper_FunctionCounter.SetAttribute("AsyncStrategy", BooleanValue(asyncStrategy));
        OrchestratorHelper_FunctionCounter.SetAttribute("Periodic", BooleanValue(true));
        OrchestratorHelper_FunctionCounter.SetAttribute("Interval", TimeValue(Seconds(interval)));
        OrchestratorHelper_FunctionCounter.SetAttribute("ExecutionTime", TimeValue(Seconds(12.0)));
        OrchestratorHelper_FunctionCounter.SetAttribute("CommunicationModel", StringValue("In-Band"));
-       OrchestratorHelper_FunctionCounter.Install(NC_nodes.first.Get(0));
+       OrchestratorHelper_FunctionCounter.SetAttribute("ReactToPush", BooleanValue(pushTelemetry));
+       for(uint32_t s = 0; s < shards; s++)
+       {
+         OrchestratorHelper_FunctionCounter.Install(NC_nodes.first.Get(shard_orchestrator[s]));
+       }
+
+     //-----------------------------------------------------------------------------//
+     //-----------------------------Shard Coordination------------------------------//
+     //-----------------------------------------------------------------------------//
+
+       if(shards > 1)
+       {
+         std::string shard_names;
+         for(uint32_t s = 0; s < shards; s++)
+         {
+           std::string shard_name = "Shard" + std::to_string(s);
+           shard_names.append((s == 0 ? "" : ",") + shard_name);
+           ndn::AppHelper ShardAgentHelper("ns3::ndn::inc::NdnShardAgentApp");
+           ShardAgentHelper.SetAttribute("ShardName", StringValue(shard_name));
+           ShardAgentHelper.Install(NC_nodes.first.Get(shard_orchestrator[s]));
+           ndnGlobalRoutingHelper.AddOrigin("/Orchestrator/Shard/" + shard_name, NC_nodes.first.Get(shard_orchestrator[s]));
+         }
+         ndn::AppHelper ShardCoordinatorHelper("ns3::ndn::inc::NdnShardCoordinatorApp");
+         ShardCoordinatorHelper.SetAttribute("Shards", StringValue(shard_names));
+         ShardCoordinatorHelper.SetAttribute("Interval", TimeValue(Seconds(interval)));
+         ShardCoordinatorHelper.SetAttribute("ExecutionTime", TimeValue(Seconds(12.0)));
+         ShardCoordinatorHelper.Install(NC_nodes.first.Get(0));
+       }
      }
 
      //-----------------------------------------------------------------------------//
@@ -359,6 +540,16 @@ namespace ns3 {
          NS_LOG_INFO("Adding prefix to origin : " << compute_node_info.at(i).node_prefix);
          ndnGlobalRoutingHelper.AddOrigin(compute_node_info.at(i).node_prefix, (NC_nodes.first.Get(i)));
        }
+       //status pushes of a node would follow /Orchestrator to node 0, they go to the orchestrator of its shard instead
+       if(pushTelemetry && shards > 1)
+       {
+         for(uint32_t i = 2; i < num_compute_nodes; i++)
+         {
+           Name notification("/Orchestrator/Notify");
+           notification.append(Name(compute_node_info.at(i).node_prefix).get(1));
+           ndnGlobalRoutingHelper.AddOrigin(notification.toUri(), NC_nodes.first.Get(shard_orchestrator[shard_of[i]]));
+         }
+       }
      }
 
 
@@ -387,7 +578,11 @@ namespace ns3 {
      //-----------------------------------------------------------------------------//
      //-------------------------Calculate and install FIBs--------------------------//
      //-----------------------------------------------------------------------------/
-     ndn::GlobalRoutingHelper::CalculateRoutes ();
+     //best-route only tries another next hop, e.g. for a hedge with a new nonce, when the FIB holds all possible routes
+     if(forwarding == "best-route")
+       ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes ();
+     else
+       ndn::GlobalRoutingHelper::CalculateRoutes ();
 
      //-----------------------------------------------------------------------------//
      //----------------------------------Simulation---------------------------------//
@@ -413,12 +608,40 @@ namespace ns3 {
      app_delay_trace_path.append(trace_path + app_delay_traceFile);
      NS_LOG_INFO(app_delay_trace_path);
 
+     std::string strategy_trace_path;
+     strategy_trace_path.append(trace_path + strategy_traceFile);
+     NS_LOG_INFO(strategy_trace_path);
+
+     std::string shard_trace_path;
+     shard_trace_path.append(trace_path + shard_traceFile);
+     NS_LOG_INFO(shard_trace_path);
+
+     std::string command_trace_path;
+     command_trace_path.append(trace_path + command_traceFile);
+     NS_LOG_INFO(command_trace_path);
+
+     std::string workload_trace_path;
+     workload_trace_path.append(trace_path + workload_traceFile);
+     NS_LOG_INFO(workload_trace_path);
+
+     std::string deadline_trace_path;
+     deadline_trace_path.append(trace_path + deadline_traceFile);
+     NS_LOG_INFO(deadline_trace_path);
+
+     std::string hedge_trace_path;
+     hedge_trace_path.append(trace_path + hedge_traceFile);
+     NS_LOG_INFO(hedge_trace_path);
+
      std::string node_resource_utilization_trace_path;
      node_resource_utilization_trace_path.append(trace_path + resource_utilization_traceFile);
      NS_LOG_INFO(node_resource_utilization_trace_path);
 
      inc::IncConsumerTracer::Install(NC_nodes.second, consumer_trace_path, Seconds(1));
      inc::IncAppDelayTracer::Install(NC_nodes.second, app_delay_trace_path);
+     if(workload_trace.empty())
+       inc::IncWorkloadTracer::Install(NC_nodes.second, workload_trace_path, Seconds(1));
+     if(hedge_percentile > 0)
+       inc::IncHedgeTracer::Install(NC_nodes.second, hedge_trace_path, Seconds(1));
 
      NodeContainer t_compute_nodes;
      for(uint32_t i = 1; i < num_compute_nodes; i++)
@@ -427,11 +650,21 @@ namespace ns3 {
      }
      inc::IncComputeTracer::Install(t_compute_nodes, compute_trace_path, Seconds(1));
      inc::IncComputeNodeTracer::Install(t_compute_nodes, node_resource_utilization_trace_path, Seconds(1));
+     inc::IncDeadlineTracer::Install(t_compute_nodes, deadline_trace_path, Seconds(1));
 
      if(orchestrationSwitch)
      {
-       inc::IncOrchestratorCommunicationTracer::Install(NC_nodes.first.Get(0), orch_trace_path, Seconds(1));
+       NodeContainer orchestrator_nodes;
+       for(uint32_t s = 0; s < shards; s++)
+       {
+         orchestrator_nodes.Add(NC_nodes.first.Get(shard_orchestrator[s]));
+       }
+       inc::IncOrchestratorCommunicationTracer::Install(orchestrator_nodes, orch_trace_path, Seconds(1));
        inc::IncOrchestratorTracerNode::Install(t_compute_nodes, orch_node_trace_path, Seconds(1));
+       inc::IncOrchestrationStrategyTracer::Install(orchestrator_nodes, strategy_trace_path);
+       inc::IncCommandDeliveryTracer::Install(orchestrator_nodes, command_trace_path);
+       if(shards > 1)
+         inc::IncShardCoordinatorTracer::Install(NC_nodes.first.Get(0), shard_trace_path);
      }
 
      Simulator::Stop (Seconds (simulation_time));
@@ -30,6 +30,7 @@
 #include "ns3/packet.h"
 #include "ns3/names.h"
 #include "ns3/log.h"
+#include "ns3/inc-topology-cache.hpp"
 #include <boost/algorithm/string.hpp>
 
 NS_LOG_COMPONENT_DEFINE ("inc.parserNodeInfo");
@@ -41,104 +42,68 @@ namespace inc {
 parserNodeInfo::parserNodeInfo (std::string fileToRead)
 {
   m_fileToRead = fileToRead;
+  m_scenario = nullptr;
+};
+parserNodeInfo::parserNodeInfo (const IncScenario &scenario)
+{
+  m_scenario = &scenario;
 };
 parserNodeInfo::~parserNodeInfo (){};
 
 std::vector<consumer_node_struct>
 parserNodeInfo::update_consumer_info (std::vector<Ptr<Node>> consumerNodes)
 {
-
-  fstream fin;
-  fin.open (m_fileToRead, ios::in);
-  std::vector<std::vector<std::string>> file_info;
-  std::string line, word;
-  while (getline (fin, line))
+  if (m_scenario)
+    m_scenario->Replay (*this);
+  else if (IncTopologyCache::IsCache (m_fileToRead))
     {
-      if (line == "consumer section")
-        break;
-      else
-        continue;
+      IncTopologyCache cache;
+      if (!cache.Open (m_fileToRead) || !cache.Replay (*this))
+        NS_FATAL_ERROR (cache.GetError ());
     }
-  while (!fin.eof ())
-    {
-      string line;
-      getline (fin, line);
-      if (line == "")
-        continue;
-      if (line[0] == '#')
-        continue; // comments
-      if (line == "initial data section")
-        break;
-      std::vector<std::string> row_info;
-      boost::split (row_info, line, boost::is_any_of ("\t"));
-      std::vector<struct consumer_node_struct>::iterator it;
-      for (it = m_consumer_nodes.begin (); it != m_consumer_nodes.end (); ++it)
-        {
-          if (it->Name == row_info.at (0))
-            {
-              std::string function_name = row_info.at(1);
-              std::string input_arguments = row_info.at(2);
-              it->function_prefix.push_back (
-                  generate_func_first_prefix (function_name, input_arguments));
-              it->request_frequency.push_back (row_info.at (3));
-              it->lifetime.push_back (row_info.at (4));
-              it->start_time.push_back (row_info.at (5));
-              it->stop_time.push_back (row_info.at (6));
-              break;
-            }
-        }
-      if (it == m_consumer_nodes.end ())
-        {
-          consumer_node_struct new_node;
-          new_node.Name = row_info.at (0);
-          std::string function_name = row_info.at (1);
-          std::string input_arguments = row_info.at (2);
-          new_node.function_prefix.push_back (
-              generate_func_first_prefix (function_name, input_arguments));
-          new_node.request_frequency.push_back (row_info.at (3));
-          new_node.lifetime.push_back (row_info.at (4));
-          new_node.start_time.push_back (row_info.at (5));
-          new_node.stop_time.push_back (row_info.at (6));
-          m_consumer_nodes.push_back (new_node);
-        }
-    };
-  while (!fin.eof ())
+  else
     {
-      string line;
-      getline (fin, line);
-      if (line == "")
-        continue;
-      if (line[0] == '#')
-        continue; // comments
-      std::vector<std::string> row_info;
-      boost::split (row_info, line, boost::is_any_of ("\t"));
-      std::vector<struct consumer_node_struct>::iterator it;
-      for (it = m_consumer_nodes.begin (); it != m_consumer_nodes.end (); ++it)
-        {
-          if (it->Name == row_info.at (0))
-            {
-              std::string data_prefix = generate_data_prefix (row_info.at (1));
-              it->data_prefix_provided.push_back (data_prefix);
-              it->data_size.push_back (row_info.at (2));
-              it->freshness.push_back (row_info.at (3));
-              break;
-            }
-        }
-      if (it == m_consumer_nodes.end ())
-        {
-          consumer_node_struct new_node;
-          new_node.Name = row_info.at (0);
-          std::string data_prefix = generate_data_prefix (row_info.at (1));
-          new_node.data_prefix_provided.push_back (data_prefix);
-          new_node.data_size.push_back (row_info.at (2));
-          new_node.freshness.push_back (row_info.at (3));
-          m_consumer_nodes.push_back (new_node);
-        }
-    };
-  fin.close ();
+      IncTopologyParser parser (*this);
+      if (!parser.Parse (m_fileToRead))
+        NS_FATAL_ERROR (parser.GetError ());
+    }
   return m_consumer_nodes;
 }
 
+void
+parserNodeInfo::OnRequest (const IncConsumerRequest &request)
+{
+  consumer_node_struct &node = get_consumer (request.consumer);
+  node.function_prefix.push_back (generate_func_first_prefix (request.function, request.inputs));
+  node.request_frequency.push_back (request.frequency);
+  node.lifetime.push_back (request.lifetime);
+  node.start_time.push_back (request.startTime);
+  node.stop_time.push_back (request.stopTime);
+}
+
+void
+parserNodeInfo::OnData (const IncProvidedData &data)
+{
+  consumer_node_struct &node = get_consumer (data.consumer);
+  node.data_prefix_provided.push_back (generate_data_prefix (data.data));
+  node.data_size.push_back (data.size);
+  node.freshness.push_back (data.freshness);
+}
+
+consumer_node_struct &
+parserNodeInfo::get_consumer (const std::string &name)
+{
+  auto it = m_consumer_index.find (name);
+  if (it == m_consumer_index.end ())
+    {
+      consumer_node_struct new_node;
+      new_node.Name = name;
+      m_consumer_nodes.push_back (new_node);
+      it = m_consumer_index.emplace (name, m_consumer_nodes.size () - 1).first;
+    }
+  return m_consumer_nodes[it->second];
+}
+
 std::vector<compute_node_struct>
 parserNodeInfo::update_compute_info (std::vector<Ptr<IncOrchestrationComputeNode>> computeNodes)
 {
@@ -30,9 +30,12 @@
 #include "ns3/incSIM-module.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/ptr.h"
+#include "ns3/inc-topology-parser.hpp"
+#include "ns3/inc-scenario.hpp"
 #include <ns3/node-container.h>
 #include <vector>
 #include <fstream>
+#include <unordered_map>
 
 
 namespace ns3 {
@@ -57,10 +60,18 @@ namespace ns3 {
                 std::string result_size;
             };
 
-          class parserNodeInfo
+          /**
+           * \brief Reads the consumer workload (consumer and initial data section) of a topology file, a topology cache or an
+           * in-memory scenario
+           */
+          class parserNodeInfo : private IncTopologyParser::Handler
           {
           public:
           parserNodeInfo(std::string fileToRead);
+          /**
+           * \brief Read the workload of a scenario, which must outlive the parser
+           */
+          parserNodeInfo(const IncScenario& scenario);
           ~parserNodeInfo();
 
           std::vector<consumer_node_struct>
@@ -69,7 +80,10 @@ namespace ns3 {
           std::vector<compute_node_struct>
           update_compute_info(std::vector<Ptr<ns3::ndn::inc::IncOrchestrationComputeNode>> computeNodes);
 
-          std::string
+          /**
+           * \brief Compute request prefix of a function called with a comma separated input list ("null" for none)
+           */
+          static std::string
           generate_func_first_prefix(std::string, std::string);
 
           std::string
@@ -78,10 +92,22 @@ namespace ns3 {
           std::string
           generate_data_prefix(std::string);
 
+          private:
+          virtual void
+          OnRequest(const IncConsumerRequest& request);
+
+          virtual void
+          OnData(const IncProvidedData& data);
+
+          consumer_node_struct&
+          get_consumer(const std::string& name);
+
           private:
           std::vector<struct consumer_node_struct> m_consumer_nodes;
+          std::unordered_map<std::string, uint32_t> m_consumer_index;
           std::vector<struct compute_node_struct> m_compute_nodes;
           std::string m_fileToRead;
+          const IncScenario* m_scenario;
           };
         }
     }
@@ -33,6 +33,7 @@
 #include "ns3/log.h"
 #include <boost/algorithm/string.hpp>
 #include <random>
+#include <cstdlib>
 
 NS_LOG_COMPONENT_DEFINE("inc.consumerNodeDataGen");
 
@@ -40,15 +41,95 @@ namespace ns3 {
 namespace ndn {
 namespace inc{
 
+namespace {
+
+uint32_t
+draw(Ptr<UniformRandomVariable> stream)
+{
+    return stream->GetInteger(0, RAND_MAX);
+}
+
+uint32_t
+to_unsigned(const std::string& value)
+{
+    return std::strtoul(value.c_str(), nullptr, 10);
+}
+
+IncTopologyNode
+to_compute_node(const std::string& name, const std::string& latitude, const std::string& longitude, const std::string& cores,
+    const std::string& clock_speed, const std::string& ram, const std::string& rom, const std::string& queue,
+    const std::string& links, const std::string& runtimes)
+{
+    IncTopologyNode node = IncTopologyNode();
+    node.type = IncTopologyNode::Compute;
+    node.name = name;
+    node.latitude = std::strtod(latitude.c_str(), nullptr);
+    node.longitude = std::strtod(longitude.c_str(), nullptr);
+    node.cores = to_unsigned(cores);
+    node.clockSpeed = to_unsigned(clock_speed);
+    node.ram = to_unsigned(ram);
+    node.rom = to_unsigned(rom);
+    node.queue = to_unsigned(queue);
+    node.links = links;
+    node.runtimes = runtimes;
+    return node;
+}
+
+IncTopologyNode
+to_consumer_node(const std::string& name, const std::string& latitude, const std::string& longitude)
+{
+    IncTopologyNode node = IncTopologyNode();
+    node.type = IncTopologyNode::Consumer;
+    node.name = name;
+    node.latitude = std::strtod(latitude.c_str(), nullptr);
+    node.longitude = std::strtod(longitude.c_str(), nullptr);
+    return node;
+}
+
+IncTopologyFunction
+to_function(const funcProperties& properties, const std::string& runtime)
+{
+    IncTopologyFunction function = IncTopologyFunction();
+    function.name = properties.name;
+    function.inputs = properties.input_signature;
+    function.runtimes.push_back(runtime);
+    function.ram = to_unsigned(properties.ram_mb);
+    function.rom = to_unsigned(properties.rom_gb);
+    function.cpu = to_unsigned(properties.cores);
+    function.execTime = std::strtod(properties.exec_time.c_str(), nullptr);
+    function.numInstructions = to_unsigned(properties.num_instructions);
+    function.funcSize = to_unsigned(properties.func_size_KB);
+    function.resultSize = to_unsigned(properties.result_size_KB);
+    return function;
+}
+
+}
+
 DataGen::DataGen(uint32_t seed,std::string fileToWrite)
 {
     //std::cout<<"Inside Constructor"<<std::endl;
     m_fileToWrite = fileToWrite;
     m_seed = seed;
+    seed_streams();
 }
 
 DataGen::~DataGen(){};
 
+void
+DataGen::seed_streams()
+{
+    //every generate_data call starts the streams over, like srand did
+    IncRandomStreams streams(m_seed);
+    m_workloadRNG = streams.Create<UniformRandomVariable>("workload");
+    m_seqRNG = streams.Create<UniformRandomVariable>("popularity");
+}
+
+const IncScenario&
+DataGen::GetScenario() const
+{
+    return m_scenario;
+}
+
 void
 DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t t1_nodes, uint32_t t2_nodes, uint32_t t3_nodes, uint32_t cloud_scale, uint32_t num_func, uint32_t num_data, std::pair<int,int> input_range, std::pair<int,int> frequency_range, uint32_t sim_time, bool zipf, bool nfn_load_distribution_scenario, bool homogeneous_nodes)
 {
@@ -65,366 +146,351 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t t1_nodes, uint32_t
     std::vector<std::string> data_packet_size_KB = {"1","10","100","500","1000","10000","100000","1000000","10000000"};
     std::vector<std::string> freshness_s = {"0","0.1","0.5","1.0","5.0","10.0","50.0","100.0"};
     std::vector<std::string> queue_size = {"5", "10", "50", "100"};
-    srand(m_seed);
-    fstream fout;
-    fout.open(m_fileToWrite, ios::out);
-    if(fout)
+    seed_streams();
+    m_scenario.Clear();
+    //--------------router section----------------------//
+    m_scenario.AddNode(to_compute_node("orchestrator", "100", "30", cores.at(5), "4000", "40960", "2000", "10", (links.at(0)+','+links.at(1)+','+links.at(2)), (runtimes.at(0)+','+runtimes.at(1)+','+runtimes.at(2))));
+    for(uint32_t i=1;i<num_compute_nodes; i++)
     {
-        //--------------router section----------------------//
-        fout<<"router"<<"\n"; //section router
-        fout<<"orchestrator"<<"\t"<<"100"<<"\t"<<"30"<<"\t"<<cores.at(5)<<"\t"<<"4000"<<"\t"<<"40960"<<"\t"<<"2000"<<"\t"<<"10"<<"\t"<<(links.at(0)+','+links.at(1)+','+links.at(2))<<"\t"<<(runtimes.at(0)+','+runtimes.at(1)+','+runtimes.at(2))<<"\n";
-        for(uint32_t i=1;i<num_compute_nodes; i++)
+        std::string compute = "compute_node_";
+        nodeProperties compute_node;
+        compute_node.name = compute.append(to_string(i-1));
+        if(homogeneous_nodes==true)
         {
-            std::string compute = "compute_node_";
-            nodeProperties compute_node;
-            compute_node.name = compute.append(to_string(i-1));
-            if(homogeneous_nodes==true)
-            {
-                compute_node.clock_speed_mips = "8000";
-                compute_node.cores= "100";
-                compute_node.ram_mb = "10000";
-                compute_node.rom_gb = "10000";
-                compute_node.queue = "100";
-            }
-            else
+            compute_node.clock_speed_mips = "8000";
+            compute_node.cores= "100";
+            compute_node.ram_mb = "10000";
+            compute_node.rom_gb = "10000";
+            compute_node.queue = "100";
+        }
+        else
+        {
+            if(i==1)
             {
-                if(i==1)
-                {
-                    if (cloud_scale == 1)
-                    {
-                        //cloud server
-                        compute_node.clock_speed_mips = "40000";
-                        compute_node.cores= "1000";
-                        compute_node.ram_mb = "81920";
-                        compute_node.rom_gb = "10000";
-                        compute_node.queue = "1000";
-                        compute_node.lati = "500";
-                        compute_node.longi = "1000";
-                    }
-                    else if (cloud_scale == 2)
-                    {
-                        //cloud server
-                        compute_node.clock_speed_mips = "40000";
-                        compute_node.cores= "2000";
-                        compute_node.ram_mb = "163840";
-                        compute_node.rom_gb = "10000";
-                        compute_node.queue = "2000";
-                        compute_node.lati = "500";
-                        compute_node.longi = "1000";
-                    }
-                    else if (cloud_scale == 3)
-                    {
-                        //cloud server
-                        compute_node.clock_speed_mips = "40000";
-                        compute_node.cores= "4000";
-                        compute_node.ram_mb = "327680";
-                        compute_node.rom_gb = "20000";
-                        compute_node.queue = "4000";
-                        compute_node.lati = "500";
-                        compute_node.longi = "1000";
-                    }
-                }
-                else if (i==2)
+                if (cloud_scale == 1)
                 {
-                    if (cloud_scale == 1)
-                    {
-                        //ISP gateway
-                        compute_node.clock_speed_mips = "20000";
-                        compute_node.cores = "500";
-                        compute_node.ram_mb = "40960";
-                        compute_node.rom_gb = "5000";
-                        compute_node.queue = "500";
-                        compute_node.lati = "500";
-                        compute_node.longi = "800";
-                    }
-                    else if (cloud_scale == 2)
-                    {
-                        compute_node.clock_speed_mips = "20000";
-                        compute_node.cores = "1000";
-                        compute_node.ram_mb = "81920";
-                        compute_node.rom_gb = "5000";
-                        compute_node.queue = "1000";
-                        compute_node.lati = "500";
-                        compute_node.longi = "800";
-                    }
-                    else if (cloud_scale == 3)
-                    {
-                        compute_node.clock_speed_mips = "40000";
-                        compute_node.cores = "2000";
-                        compute_node.ram_mb = "163840";
-                        compute_node.rom_gb = "5000";
-                        compute_node.queue = "2000";
-                        compute_node.lati = "500";
-                        compute_node.longi = "800";
-                    }
+                    //cloud server
+                    compute_node.clock_speed_mips = "40000";
+                    compute_node.cores= "1000";
+                    compute_node.ram_mb = "81920";
+                    compute_node.rom_gb = "10000";
+                    compute_node.queue = "1000";
+                    compute_node.lati = "500";
+                    compute_node.longi = "1000";
                 }
-                else if( (i > 2) && (i <= (t2_nodes+2)) )
+                else if (cloud_scale == 2)
                 {
-                    compute_node.clock_speed_mips = "8000";
-                    compute_node.cores = "40";
-                    compute_node.ram_mb="8192";
-                    compute_node.rom_gb = "800";
-                    compute_node.queue = "40";
-                    compute_node.lati = to_string((1000/t2_nodes)*(i-2));
-                    compute_node.longi = "600";
+                    //cloud server
+                    compute_node.clock_speed_mips = "40000";
+                    compute_node.cores= "2000";
+                    compute_node.ram_mb = "163840";
+                    compute_node.rom_gb = "10000";
+                    compute_node.queue = "2000";
+                    compute_node.lati = "500";
+                    compute_node.longi = "1000";
                 }
-                else if( i > (t2_nodes+t1_nodes+1)) //remaining in tier 3
+                else if (cloud_scale == 3)
                 {
-                    compute_node.clock_speed_mips = "4000";
-                    compute_node.cores = "20",
-                    compute_node.ram_mb = "6144",
-                    compute_node.rom_gb = "400",
-                    compute_node.queue = "20";
-                    compute_node.lati = to_string((1000/t3_nodes)* (i-(t2_nodes+2)));
-                    compute_node.longi = "400";
+                    //cloud server
+                    compute_node.clock_speed_mips = "40000";
+                    compute_node.cores= "4000";
+                    compute_node.ram_mb = "327680";
+                    compute_node.rom_gb = "20000";
+                    compute_node.queue = "4000";
+                    compute_node.lati = "500";
+                    compute_node.longi = "1000";
                 }
             }
-            if(i==1)
-            {
-                compute_node.lati = "500";
-                compute_node.longi = "1000";
-            }
             else if (i==2)
             {
-                compute_node.lati = "500";
-                compute_node.longi = "800";
+                if (cloud_scale == 1)
+                {
+                    //ISP gateway
+                    compute_node.clock_speed_mips = "20000";
+                    compute_node.cores = "500";
+                    compute_node.ram_mb = "40960";
+                    compute_node.rom_gb = "5000";
+                    compute_node.queue = "500";
+                    compute_node.lati = "500";
+                    compute_node.longi = "800";
+                }
+                else if (cloud_scale == 2)
+                {
+                    compute_node.clock_speed_mips = "20000";
+                    compute_node.cores = "1000";
+                    compute_node.ram_mb = "81920";
+                    compute_node.rom_gb = "5000";
+                    compute_node.queue = "1000";
+                    compute_node.lati = "500";
+                    compute_node.longi = "800";
+                }
+                else if (cloud_scale == 3)
+                {
+                    compute_node.clock_speed_mips = "40000";
+                    compute_node.cores = "2000";
+                    compute_node.ram_mb = "163840";
+                    compute_node.rom_gb = "5000";
+                    compute_node.queue = "2000";
+                    compute_node.lati = "500";
+                    compute_node.longi = "800";
+                }
             }
             else if( (i > 2) && (i <= (t2_nodes+2)) )
             {
+                compute_node.clock_speed_mips = "8000";
+                compute_node.cores = "40";
+                compute_node.ram_mb="8192";
+                compute_node.rom_gb = "800";
+                compute_node.queue = "40";
                 compute_node.lati = to_string((1000/t2_nodes)*(i-2));
                 compute_node.longi = "600";
             }
             else if( i > (t2_nodes+t1_nodes+1)) //remaining in tier 3
             {
+                compute_node.clock_speed_mips = "4000";
+                compute_node.cores = "20",
+                compute_node.ram_mb = "6144",
+                compute_node.rom_gb = "400",
+                compute_node.queue = "20";
                 compute_node.lati = to_string((1000/t3_nodes)* (i-(t2_nodes+2)));
                 compute_node.longi = "400";
             }
-            m_node_list.push_back(compute_node);
-
-            fout<<compute_node.name<<"\t"<<compute_node.longi<<"\t"<<compute_node.lati<<"\t"<<compute_node.cores<<"\t"<<compute_node.clock_speed_mips<<"\t"<<compute_node.ram_mb<<"\t"
-            <<compute_node.rom_gb<<"\t"<<compute_node.queue<<"\t"<<(links.at(1)+','+links.at(2))<<"\t"<<(runtimes.at(0)+','+runtimes.at(1)+','+runtimes.at(2))<<"\n";
         }
-
-        for(int32_t i=0;i<num_consumer_nodes; i++)
+        if(i==1)
         {
-            std::string consumer = "consumer_";
-            fout<<(consumer.append(to_string(i)))<<"\t"<<"20"<<"\t"<<i<<"\t"<<"NaN"<<"\t"<<"NaN"<<"\t"<<"NaN"<<"\t"<<"NaN"<<"\t"<<"NaN"<<"\t"<<"NaN"<<"\n";
+            compute_node.lati = "500";
+            compute_node.longi = "1000";
+        }
+        else if (i==2)
+        {
+            compute_node.lati = "500";
+            compute_node.longi = "800";
+        }
+        else if( (i > 2) && (i <= (t2_nodes+2)) )
+        {
+            compute_node.lati = to_string((1000/t2_nodes)*(i-2));
+            compute_node.longi = "600";
+        }
+        else if( i > (t2_nodes+t1_nodes+1)) //remaining in tier 3
+        {
+            compute_node.lati = to_string((1000/t3_nodes)* (i-(t2_nodes+2)));
+            compute_node.longi = "400";
         }
+        m_node_list.push_back(compute_node);
 
+        //the text format always listed longi in the latitude column, the scenario keeps that placement
+        m_scenario.AddNode(to_compute_node(compute_node.name, compute_node.longi, compute_node.lati, compute_node.cores, compute_node.clock_speed_mips, compute_node.ram_mb,
+        compute_node.rom_gb, compute_node.queue, (links.at(1)+','+links.at(2)), (runtimes.at(0)+','+runtimes.at(1)+','+runtimes.at(2))));
+    }
+
+    for(int32_t i=0;i<num_consumer_nodes; i++)
+    {
+        std::string consumer = "consumer_";
+        m_scenario.AddNode(to_consumer_node(consumer.append(to_string(i)), "20", to_string(i)));
+    }
 
 
-        NS_LOG_INFO("After Router Section"<<std::endl);
-        //-------------Links section-----------------------//
-        fout<<"\n";
-        fout<<"links"<<"\n"; //section links
 
-        for(uint32_t i = 1; i<m_node_list.size();i++)
+    NS_LOG_INFO("After Router Section"<<std::endl);
+    //-------------Links section-----------------------//
+
+    for(uint32_t i = 1; i<m_node_list.size();i++)
+    {
+        m_scenario.AddLink("orchestrator", m_node_list.at(i).name, "10000Mbps", "50", "5ms", "1000"); //orchestrator with other compute nodes except cloud
+    }
+    //link between compute nodes
+    int l,k;
+    for(uint32_t i=0; i<=t2_nodes+1 ;i++)
+    {
+        if(i==0)
         {
-            fout<<"orchestrator"<<"\t"<<(m_node_list.at(i).name)<<"\t"<<"10000Mbps"<<"\t"<<"50"<<"\t"<<"5ms"<<"\t"<<"1000"<<"\n"; //orchestrator with other compute nodes except cloud
+            std::string compute_node_1 = "compute_node_";
+            std::string compute_node_2 = "compute_node_";
+            m_scenario.AddLink(compute_node_1.append(to_string(i)), compute_node_2.append(to_string(i+1)), "10000Mbps", "1", "200ms", "1000");
         }
-        //link between compute nodes
-        int l,k;
-        for(uint32_t i=0; i<=t2_nodes+1 ;i++)
+        if(i==1)
         {
-            if(i==0)
-            {
-                std::string compute_node_1 = "compute_node_";
-                std::string compute_node_2 = "compute_node_";
-                fout<<compute_node_1.append(to_string(i))<<"\t"<<compute_node_2.append(to_string(i+1))<<"\t"<<"10000Mbps"<<"\t"<<"1"<<"\t"<<"200ms"<<"\t"<<"1000"<<"\n";
-            }
-            if(i==1)
-            {
-                l = 2;
-                while(l<=t2_nodes+1)
-                {
-                    std::string compute_node_1 = "compute_node_";
-                    std::string compute_node_2 = "compute_node_";
-                    fout<<compute_node_1.append(to_string(i))<<"\t"<<compute_node_2.append(to_string(l))<<"\t"<<"10000Mbps"<<"\t"<<"1"<<"\t"<<"25ms"<<"\t"<<"1000"<<"\n";
-                    l++;
-                }
-            }
-            else if (i>1)
+            l = 2;
+            while(l<=t2_nodes+1)
             {
-                if(i==2)
-                {
-                    k=t2_nodes+2;
-                }
                 std::string compute_node_1 = "compute_node_";
                 std::string compute_node_2 = "compute_node_";
-                fout<<compute_node_1.append(to_string(i))<<"\t"<<compute_node_2.append(to_string(k))<<"\t"<<"10000Mbps"<<"\t"<<"1"<<"\t"<<"5ms"<<"\t"<<"1000"<<"\n";
-                k++;
-                compute_node_1 = "compute_node_";
-                compute_node_2 = "compute_node_";
-                fout<<compute_node_1.append(to_string(i))<<"\t"<<compute_node_2.append(to_string(k))<<"\t"<<"10000Mbps"<<"\t"<<"1"<<"\t"<<"5ms"<<"\t"<<"1000"<<"\n";
-                k++;
+                m_scenario.AddLink(compute_node_1.append(to_string(i)), compute_node_2.append(to_string(l)), "10000Mbps", "1", "25ms", "1000");
+                l++;
             }
         }
-        uint32_t q = num_consumer_nodes / t3_nodes;
-        for(uint32_t i = 0 ; i<t3_nodes;i++)
+        else if (i>1)
         {
-            for(uint32_t j=0;j<q;j++)
+            if(i==2)
             {
-                std::string consumer = "consumer_";
-                uint32_t consumer_suffix = ((j) + ((i)*(q)));
-                fout<<(m_node_list.at(t2_nodes+2+i).name)<<"\t"<<(consumer.append(to_string(consumer_suffix)))<<"\t"<<"250Mbps"<<"\t"<<"1"<<"\t"<<"2ms"<<"\t"<<"10"<<"\n";
+                k=t2_nodes+2;
             }
+            std::string compute_node_1 = "compute_node_";
+            std::string compute_node_2 = "compute_node_";
+            m_scenario.AddLink(compute_node_1.append(to_string(i)), compute_node_2.append(to_string(k)), "10000Mbps", "1", "5ms", "1000");
+            k++;
+            compute_node_1 = "compute_node_";
+            compute_node_2 = "compute_node_";
+            m_scenario.AddLink(compute_node_1.append(to_string(i)), compute_node_2.append(to_string(k)), "10000Mbps", "1", "5ms", "1000");
+            k++;
         }
-        for( uint32_t i = 0; i<t3_nodes;i++)
+    }
+    uint32_t q = num_consumer_nodes / t3_nodes;
+    for(uint32_t i = 0 ; i<t3_nodes;i++)
+    {
+        for(uint32_t j=0;j<q;j++)
         {
             std::string consumer = "consumer_";
-            uint32_t consumer_suffix = (i)+(q * (t3_nodes));
-            if(consumer_suffix < num_consumer_nodes)
-                fout<<(m_node_list.at(t2_nodes+2+i).name)<<"\t"<<(consumer.append(to_string(consumer_suffix)))<<"\t"<<"250Mbps"<<"\t"<<"1"<<"\t"<<"2ms"<<"\t"<<"10"<<"\n";
-            else
-                break;
+            uint32_t consumer_suffix = ((j) + ((i)*(q)));
+            m_scenario.AddLink(m_node_list.at(t2_nodes+2+i).name, consumer.append(to_string(consumer_suffix)), "250Mbps", "1", "2ms", "10");
         }
+    }
+    for( uint32_t i = 0; i<t3_nodes;i++)
+    {
+        std::string consumer = "consumer_";
+        uint32_t consumer_suffix = (i)+(q * (t3_nodes));
+        if(consumer_suffix < num_consumer_nodes)
+            m_scenario.AddLink(m_node_list.at(t2_nodes+2+i).name, consumer.append(to_string(consumer_suffix)), "250Mbps", "1", "2ms", "10");
+        else
+            break;
+    }
 
-        NS_LOG_INFO("After Links Section"<<std::endl);
-        //-------------functions section--------------------//
-        fout<<"\n";
-        fout<<"functions"<<"\n"; //section functions
-        generate_func_list(num_func, input_range);
-        generate_provided_data(num_data);
-        generate_start_time(num_consumer_nodes, sim_time);
-        generate_stop_time(num_consumer_nodes, sim_time);
+    NS_LOG_INFO("After Links Section"<<std::endl);
+    //-------------functions section--------------------//
+    generate_func_list(num_func, input_range);
+    generate_provided_data(num_data);
+    generate_start_time(num_consumer_nodes, sim_time);
+    generate_stop_time(num_consumer_nodes, sim_time);
 
-        for(uint32_t i=0;i<num_func;i++)
+    for(uint32_t i=0;i<num_func;i++)
+    {
+        if(static_value == false)
         {
-            if(static_value == false)
-            {
-                m_func_list.at(i).exec_time = exec_time_s.at(rand()%5);
-                m_func_list.at(i).num_instructions = clock_speed_mips.at(rand()%6);
-                m_func_list.at(i).ram_mb=ram_mb.at(rand()%3);
-                m_func_list.at(i).rom_gb=rom_gb.at(rand()%3);
-                m_func_list.at(i).cores=cores.at(rand()%3);
-                m_func_list.at(i).func_size_KB = data_packet_size_KB.at(rand()%8);
-                m_func_list.at(i).result_size_KB = data_packet_size_KB.at(rand()%5);
-            }
-            else
-            {
-                m_func_list.at(i).exec_time = "3.0";
-                m_func_list.at(i).num_instructions = "4000";
-                m_func_list.at(i).func_size_KB = "10000"; //currently set to a constant value
-                m_func_list.at(i).result_size_KB ="500"; //currently set to a constant value
-                m_func_list.at(i).cores="1";
-                m_func_list.at(i).ram_mb="100";
-                m_func_list.at(i).rom_gb="16";
-            }
-            fout<<(m_func_list.at(i).name)<<"\t"<<(m_func_list.at(i).input_signature)<<"\t"<<runtimes.at(0)<<"\t"<<m_func_list.at(i).ram_mb<<"\t"<<m_func_list.at(i).rom_gb<<"\t"<<m_func_list.at(i).cores<<"\t"<<m_func_list.at(i).exec_time
-            <<"\t"<<m_func_list.at(i).num_instructions<<"\t"
-            <<m_func_list.at(i).func_size_KB<<"\t"<<m_func_list.at(i).result_size_KB<<"\n";
+            m_func_list.at(i).exec_time = exec_time_s.at(draw(m_workloadRNG)%5);
+            m_func_list.at(i).num_instructions = clock_speed_mips.at(draw(m_workloadRNG)%6);
+            m_func_list.at(i).ram_mb=ram_mb.at(draw(m_workloadRNG)%3);
+            m_func_list.at(i).rom_gb=rom_gb.at(draw(m_workloadRNG)%3);
+            m_func_list.at(i).cores=cores.at(draw(m_workloadRNG)%3);
+            m_func_list.at(i).func_size_KB = data_packet_size_KB.at(draw(m_workloadRNG)%8);
+            m_func_list.at(i).result_size_KB = data_packet_size_KB.at(draw(m_workloadRNG)%5);
         }
-
-
-        NS_LOG_INFO("After functions Section"<<std::endl);
-        //-----------initial function placement section------//
-        fout<<"\n";
-        fout<<"initial function status"<<"\n"; // section intial placement to cloud server
-        //std::cout<<"initial function status"<<std::endl;
-        for(uint32_t i=0;i<num_func;i++)
+        else
         {
-            fout<<"compute_node_0"<<"\t"<<(m_func_list.at(i).name)<<"\n";
+            m_func_list.at(i).exec_time = "3.0";
+            m_func_list.at(i).num_instructions = "4000";
+            m_func_list.at(i).func_size_KB = "10000"; //currently set to a constant value
+            m_func_list.at(i).result_size_KB ="500"; //currently set to a constant value
+            m_func_list.at(i).cores="1";
+            m_func_list.at(i).ram_mb="100";
+            m_func_list.at(i).rom_gb="16";
         }
-        NS_LOG_INFO("initial function placement done!"<<std::endl);
-
-        //----------consumer section---------------------//
-        fout<<"\n";
-        fout<<"consumer section"<<"\n"; // define consumer request behavior
-        NS_LOG_INFO("consumer section"<<std::endl);
-
-        std::vector<double> l_prob_vector = createZipfMandelbrotDist(num_func, 0.7, 0.7);
-        generate_int_lifetime(num_func, frequency_range);
-        int load_index;
-        //std::cout<<"The load index is "<<load_index<<std::endl;
-        for(int k = 0; k < 3; k++)
+        m_scenario.AddFunction(to_function(m_func_list.at(i), runtimes.at(0)));
+    }
+
+
+    NS_LOG_INFO("After functions Section"<<std::endl);
+    //-----------initial function placement section------//
+    //std::cout<<"initial function status"<<std::endl;
+    for(uint32_t i=0;i<num_func;i++)
+    {
+        m_scenario.AddPlacement("compute_node_0", m_func_list.at(i).name);
+    }
+    NS_LOG_INFO("initial function placement done!"<<std::endl);
+
+    //----------consumer section---------------------//
+    NS_LOG_INFO("consumer section"<<std::endl);
+
+    IncDiscreteSampler popularity = IncDiscreteSampler::ZipfMandelbrot(num_func, 0.7, 0.7);
+    generate_int_lifetime(num_func, frequency_range);
+    int load_index;
+    //std::cout<<"The load index is "<<load_index<<std::endl;
+    for(int k = 0; k < 3; k++)
+    {
+        load_index = draw(m_workloadRNG)%((num_consumer_nodes/20)+1);
+        for(uint32_t i=0;i<num_consumer_nodes/2;i++)
         {
-            load_index = rand()%((num_consumer_nodes/20)+1);
-            for(uint32_t i=0;i<num_consumer_nodes/2;i++)
-            {
-                std::string consumer = "consumer_";
-                int j;
+            std::string consumer = "consumer_";
+            int j;
 
-                if(zipf==true)
+            if(zipf==true)
+            {
+                if(nfn_load_distribution_scenario == true)
                 {
-                    if(nfn_load_distribution_scenario == true)
-                    {
-                        j = ((i % (num_consumer_nodes/t3_nodes)) + (load_index*(num_consumer_nodes/t3_nodes)));
-                        if(j>=num_consumer_nodes)
-                            continue;
-                    }
-                    else
-                    {
-                        j = i;
-                    }
-                    uint32_t index = getNextZipfMandelbrotRandomNumber(l_prob_vector, num_func);
-                    index = index-1;
-                    string inputs = generate_input_list((m_func_list.at(index)).num_inputs, num_data);
-                    fout<<(consumer.append(to_string(j)))<<"\t"<<(m_func_list.at(index)).name<<"\t"<<inputs<<"\t"<<m_freq.at(index)<<"\t"<<(m_func_list.at(index)).lifetime<<"\t"
-                    <<m_startTime.at(j)<<"\t"<<m_stopTime.at(j)<<"\n";
+                    j = ((i % (num_consumer_nodes/t3_nodes)) + (load_index*(num_consumer_nodes/t3_nodes)));
+                    if(j>=num_consumer_nodes)
+                        continue;
                 }
                 else
                 {
-                    if(nfn_load_distribution_scenario == true)
-                    {
-                        j = (i % (num_consumer_nodes/t3_nodes)+ (load_index*k*(num_consumer_nodes/t3_nodes)));
-                        if(j>=num_consumer_nodes)
-                            continue;
-                    }
-                    else
-                    {
-                        j= i;
-                    }
-                    string inputs = generate_input_list((m_func_list.at(i)).num_inputs, num_data);
-                    fout<<(consumer.append(to_string(j)))<<"\t"<<(m_func_list.at(j)).name<<"\t"<<inputs<<"\t"<<m_freq.at(j)<<"\t"<<(m_func_list.at(j)).lifetime<<"\t"
-                    <<m_startTime.at(j)<<"\t"<<m_stopTime.at(j)<<"\n";
+                    j = i;
                 }
+                uint32_t index = popularity.Sample(m_seqRNG);
+                string inputs = generate_input_list((m_func_list.at(index)).num_inputs, num_data);
+                m_scenario.AddRequest(consumer.append(to_string(j)), m_func_list.at(index).name, inputs, m_freq.at(index), m_func_list.at(index).lifetime,
+                m_startTime.at(j), m_stopTime.at(j));
             }
-        }
-
-         //usual consumer request at other consumer nodes (connected to other compute nodes) during nfn_load_distribution_scenario.
-          if(nfn_load_distribution_scenario == true)
-        {
-            for(uint32_t i=0 ; i<num_consumer_nodes; i++)
+            else
             {
-                std::string consumer = "consumer_";
-                if(zipf==true)
+                if(nfn_load_distribution_scenario == true)
                 {
-                    uint32_t index = getNextZipfMandelbrotRandomNumber(l_prob_vector, num_func);
-                    index = index-1;
-                    string inputs = generate_input_list((m_func_list.at(index)).num_inputs, num_data);
-                    fout<<(consumer.append(to_string(i)))<<"\t"<<(m_func_list.at(index)).name<<"\t"<<inputs<<"\t"<<m_freq.at(index)<<"\t"<<(m_func_list.at(index)).lifetime<<"\t"
-                    <<m_startTime.at(i)<<"\t"<<m_stopTime.at(i)<<"\n";
-
+                    j = (i % (num_consumer_nodes/t3_nodes)+ (load_index*k*(num_consumer_nodes/t3_nodes)));
+                    if(j>=num_consumer_nodes)
+                        continue;
                 }
                 else
                 {
-                    string inputs = generate_input_list((m_func_list.at(i)).num_inputs, num_data);
-                    fout<<(consumer.append(to_string(i)))<<"\t"<<(m_func_list.at(i)).name<<"\t"<<inputs<<"\t"<<m_freq.at(i)<<"\t"<<(m_func_list.at(i)).lifetime<<"\t"
-                    <<m_startTime.at(i)<<"\t"<<m_stopTime.at(i)<<"\n";
+                    j= i;
                 }
+                string inputs = generate_input_list((m_func_list.at(i)).num_inputs, num_data);
+                m_scenario.AddRequest(consumer.append(to_string(j)), m_func_list.at(j).name, inputs, m_freq.at(j), m_func_list.at(j).lifetime,
+                m_startTime.at(j), m_stopTime.at(j));
             }
         }
-        NS_LOG_INFO("consumer section done"<<std::endl);
+    }
 
-        //------------initial data section---------------------//
-        fout<<"\n";
-        fout<<"initial data section"<<"\n";
-        int cons_index = 0;
-        for(uint32_t i=0;i<m_provided_data.size(); i++)
+     //usual consumer request at other consumer nodes (connected to other compute nodes) during nfn_load_distribution_scenario.
+      if(nfn_load_distribution_scenario == true)
+    {
+        for(uint32_t i=0 ; i<num_consumer_nodes; i++)
         {
             std::string consumer = "consumer_";
-            string data_size_KB = "500";
-            string freshness_s = "2";
-            fout<<consumer.append(to_string(cons_index))<<"\t"<<m_provided_data.at(i).name<<"\t"<<data_size_KB<<"\t"<<freshness_s<<"\n";
-            cons_index++;
-            if(cons_index==num_consumer_nodes)
+            if(zipf==true)
             {
-                cons_index = 0;
+                uint32_t index = popularity.Sample(m_seqRNG);
+                string inputs = generate_input_list((m_func_list.at(index)).num_inputs, num_data);
+                m_scenario.AddRequest(consumer.append(to_string(i)), m_func_list.at(index).name, inputs, m_freq.at(index), m_func_list.at(index).lifetime,
+                m_startTime.at(i), m_stopTime.at(i));
+
             }
+            else
+            {
+                string inputs = generate_input_list((m_func_list.at(i)).num_inputs, num_data);
+                m_scenario.AddRequest(consumer.append(to_string(i)), m_func_list.at(i).name, inputs, m_freq.at(i), m_func_list.at(i).lifetime,
+                m_startTime.at(i), m_stopTime.at(i));
+            }
+        }
+    }
+    NS_LOG_INFO("consumer section done"<<std::endl);
+
+    //------------initial data section---------------------//
+    int cons_index = 0;
+    for(uint32_t i=0;i<m_provided_data.size(); i++)
+    {
+        std::string consumer = "consumer_";
+        string data_size_KB = "500";
+        string freshness_s = "2";
+        m_scenario.AddData(consumer.append(to_string(cons_index)), m_provided_data.at(i).name, data_size_KB, freshness_s);
+        cons_index++;
+        if(cons_index==num_consumer_nodes)
+        {
+            cons_index = 0;
         }
-        NS_LOG_INFO("initial data section done"<<std::endl);
     }
-    fout.close();
+    NS_LOG_INFO("initial data section done"<<std::endl);
+    if(!m_fileToWrite.empty() && !m_scenario.Save(m_fileToWrite))
+    {
+        NS_FATAL_ERROR("Cannot write the topology file " << m_fileToWrite);
+    }
 }
 
 void
@@ -438,7 +504,7 @@ DataGen::generate_func_list(uint32_t num_func, std::pair<int, int>input_range)
         funcProperties function;
         function.name = func.append(to_string(i));
         do{
-        function.num_inputs = rand()%(func_max-func_min+1)+func_min;
+        function.num_inputs = draw(m_workloadRNG)%(func_max-func_min+1)+func_min;
         }while(function.num_inputs==0);
         if(function.num_inputs == 0)
         {
@@ -476,7 +542,7 @@ DataGen::generate_input_list(int num_inputs, uint32_t num_data)
         {
             do{
                 operand = "Operand_";
-                int random_value = rand()%(data_max-data_min+1)+data_min;
+                int random_value = draw(m_workloadRNG)%(data_max-data_min+1)+data_min;
                 std::string value = to_string(random_value);
                 operand.append(value);
             }while(input_per_func.find(operand) != input_per_func.npos);
@@ -494,11 +560,11 @@ DataGen::generate_int_lifetime(uint32_t num_func, std::pair<int, int>frequency_r
     {
         std::vector<std::string> freq_list = {"5","7.5","10","12.5","15"};
         m_func_list.at(i).lifetime = "20";
-        std::string freq = freq_list.at(rand()%5);
+        std::string freq = freq_list.at(draw(m_workloadRNG)%5);
         m_freq.push_back(freq);
         //int min = frequency_range.first;
         //int max = frequency_range.second;
-        //m_freq.push_back(to_string(rand()%(max-min+1)+min));
+        //m_freq.push_back(to_string(draw(m_workloadRNG)%(max-min+1)+min));
     }
 }
 
@@ -513,7 +579,7 @@ DataGen::generate_provided_data(uint32_t num_data)
         dataProperties new_data;
         do{
             new_data.name = "Operand_";
-            (new_data.name).append(to_string(rand()%(max-min+1)+min));
+            (new_data.name).append(to_string(draw(m_workloadRNG)%(max-min+1)+min));
             auto it = find_if(begin(m_provided_data), end(m_provided_data), [=] (dataProperties const& dp)
             {
              return (dp.name == new_data.name);
@@ -535,7 +601,7 @@ DataGen::generate_start_time(uint32_t num_consumer_nodes, uint32_t sim_time)
     int max = sim_time/3;
     for(uint32_t i=0; i<num_consumer_nodes; i++)
     {
-        m_startTime.push_back(to_string(rand()%(max-min+1)+min));
+        m_startTime.push_back(to_string(draw(m_workloadRNG)%(max-min+1)+min));
     }
 }
 
@@ -546,55 +612,10 @@ DataGen::generate_stop_time(uint32_t num_consumer_nodes, uint32_t sim_time)
     int max = sim_time-2;
     for(uint32_t i=0; i<num_consumer_nodes; i++)
     {
-        m_stopTime.push_back(to_string(rand()%(max-min+1)+min));
+        m_stopTime.push_back(to_string(draw(m_workloadRNG)%(max-min+1)+min));
     }
 }
 
-std::vector<double>
-DataGen::createZipfMandelbrotDist(uint32_t f_N, double f_q, double f_s) {
-	std::vector<double> l_prob_vector = std::vector<double>(f_N + 1);
-
-	// calculate some values based on the zipf mandelbrot distribution and store it in an array
-	for (uint32_t i = 1; i <= f_N; i++) {
-		l_prob_vector[i] = l_prob_vector[i - 1] + 1.0 / std::pow(i + f_q, f_s);
-	}
-
-	// calculate the cumulative probability by printing it to the console
-	for (uint32_t i = 1; i <= f_N; i++) {
-		l_prob_vector[i] = l_prob_vector[i] / l_prob_vector[f_N];
-		//std::cout<<"Cumulative probability [" << i << "]=" << l_prob_vector[i]<<std::endl;
-	}
-	return l_prob_vector;
-}
-
-uint32_t
-DataGen::getNextZipfMandelbrotRandomNumber(std::vector<double> dist_vector, uint32_t basis) {
-    m_seqRNG = CreateObject<UniformRandomVariable>();
-	uint32_t content_index = 1; 	// set to 1 of the set [1, m_N]
-	double p_sum = 0;				// prob value is
-
-	double p_random = m_seqRNG->GetValue();
-	while (p_random == 0) {
-		p_random = m_seqRNG->GetValue();
-	}
-
-	// if (p_random == 0)
-	NS_LOG_LOGIC("p_random=" << p_random);
-	for (uint32_t i = 1; i <= basis; i++) {
-		p_sum = dist_vector[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-		// p_cum[2] = p[1] + p[2]
-		if (p_random <= p_sum) {
-			content_index = i;
-			break;
-		} // if
-	}   // for
-
-	// content_index = 1;
-	NS_LOG_INFO("RandomNumber=" << content_index);
-
-	return content_index;
-}
-
 } //namespace inc
 } //namespace ndn
 } //namespace ns3
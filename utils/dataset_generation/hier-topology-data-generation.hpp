@@ -30,6 +30,9 @@
 #include "ns3/incSIM-module.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/ptr.h"
+#include "ns3/inc-scenario.hpp"
+#include "ns3/inc-discrete-sampler.hpp"
+#include "ns3/inc-random-streams.hpp"
 #include <ns3/node-container.h>
 #include <vector>
 #include <fstream>
@@ -68,12 +71,23 @@ struct dataProperties{
     std::string freshness_s;
 };
 
+          /**
+           * \brief Generates the hierarchical scenario (topology, functions and consumer workload) as IncScenario
+           *
+           * The scenario is additionally written as annotated topology file to fileToWrite, unless it is empty.
+           */
           class DataGen
           {
           public:
-          DataGen(uint32_t seed, std::string fileToWrite);
+          DataGen(uint32_t seed, std::string fileToWrite = "");
           ~DataGen();
 
+          /**
+           * \brief Scenario of the last generate_data call
+           */
+          const IncScenario&
+          GetScenario() const;
+
           void
           generate_data(uint32_t num_consumer_nodes, uint32_t t1_nodes, uint32_t t2_nodes, uint32_t t3_nodes, uint32_t cloud_scale ,uint32_t num_func, uint32_t num_data ,std::pair<int,int> input_range, std::pair<int, int>frequency_range, uint32_t sim_time, bool zipf, bool nfn_load_distribution_scenario, bool homogeneous_nodes);
           void
@@ -95,13 +109,14 @@ struct dataProperties{
           generate_int_lifetime(uint32_t num_func, std::pair<int, int>frequency_range);
 
           private:
-
-          std::vector<double>
-          createZipfMandelbrotDist(uint32_t f_N, double f_q, double f_s);
-          uint32_t
-          getNextZipfMandelbrotRandomNumber(std::vector<double> dist_vector, uint32_t basis);
+          /**
+           * \brief (Re)create the named streams of the generator, derived from its seed
+           */
+          void
+          seed_streams();
 
           std::string m_fileToWrite;
+          IncScenario m_scenario;
           std::vector<struct funcProperties> m_func_list;
           std::vector<struct nodeProperties> m_node_list;
           std::vector<std::string> m_freq;
@@ -110,7 +125,8 @@ struct dataProperties{
           std::vector<std::string> m_startTime;
           std::vector<std::string> m_stopTime;
           uint32_t m_seed;
-          Ptr<UniformRandomVariable> m_seqRNG;
+          Ptr<UniformRandomVariable> m_workloadRNG; ///< functions, inputs, provided data and request times
+          Ptr<UniformRandomVariable> m_seqRNG; ///< single stream of the popularity draws
           };
         }
     }
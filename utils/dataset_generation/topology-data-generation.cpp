@@ -40,15 +40,36 @@ namespace ns3 {
 namespace ndn {
 namespace inc{
 
+namespace {
+
+uint32_t
+draw(Ptr<UniformRandomVariable> stream)
+{
+    return stream->GetInteger(0, RAND_MAX);
+}
+
+}
+
 DataGen::DataGen(uint32_t seed,std::string fileToWrite)
 {
     std::cout<<"Inside Constructor"<<std::endl;
     m_fileToWrite = fileToWrite;
     m_seed = seed;
+    seed_streams();
 }
 
 DataGen::~DataGen(){};
 
+void
+DataGen::seed_streams()
+{
+    //every generate_data call starts the streams over, like srand did
+    IncRandomStreams streams(m_seed);
+    m_topologyRNG = streams.Create<UniformRandomVariable>("topology");
+    m_workloadRNG = streams.Create<UniformRandomVariable>("workload");
+    m_seqRNG = streams.Create<UniformRandomVariable>("popularity");
+}
+
 void
 DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes, uint32_t num_func, std::pair<int,int> input_range, std::pair<int,int> frequency_range, uint32_t sim_time, bool zipf, bool nfn_load_distribution_scenario)
 {
@@ -64,7 +85,7 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
     std::vector<std::string> exec_time = {"1.0","2.0","4.0","6.0","8.0"};
     std::vector<std::string> data_packet_size = {"1000","10000","100000","1000000","10000000","100000000","1000000000","10000000000"};
     std::vector<std::string> freshness = {"0","0.1","0.5","1.0","5.0","10.0","50.0","100.0"};
-    srand(m_seed);
+    seed_streams();
     fstream fout;
     fout.open(m_fileToWrite, ios::out);
     if(fout)
@@ -79,9 +100,9 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
             compute_node.name = compute.append(to_string(i));
             if(static_value == false)
             {
-                compute_node.cores = cores.at(rand()%cores.size());
-                compute_node.ram = ram.at(rand()%ram.size());
-                compute_node.rom = rom.at(rand()%rom.size());
+                compute_node.cores = cores.at(draw(m_topologyRNG)%cores.size());
+                compute_node.ram = ram.at(draw(m_topologyRNG)%ram.size());
+                compute_node.rom = rom.at(draw(m_topologyRNG)%rom.size());
             }
             else
             {
@@ -91,7 +112,7 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
             }
             m_node_list.push_back(compute_node);
 
-            fout<<compute_node.name<<"\t"<<"1"<<"\t"<<to_string((i-1)*5)<<"\t"<<compute_node.cores<<"\t"<<clock_speed.at(rand()%clock_speed.size())<<"\t"<<compute_node.ram<<"\t"
+            fout<<compute_node.name<<"\t"<<"1"<<"\t"<<to_string((i-1)*5)<<"\t"<<compute_node.cores<<"\t"<<clock_speed.at(draw(m_topologyRNG)%clock_speed.size())<<"\t"<<compute_node.ram<<"\t"
             <<compute_node.rom<<"\t"<<(links.at(1)+','+links.at(2))<<"\t"<<(runtimes.at(0)+','+runtimes.at(1)+','+runtimes.at(2))<<"\n";
         }
 
@@ -148,12 +169,12 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
         {
             if(static_value == false)
             {
-                m_func_list.at(i).ram=ram.at(rand()%3);
-                m_func_list.at(i).rom=rom.at(rand()%3);
-                m_func_list.at(i).cores=cores.at(rand()%3);
-                m_func_list.at(i).exec_time = exec_time.at(rand()%6);
-                m_func_list.at(i).func_size = data_packet_size.at(rand()%8);
-                m_func_list.at(i).result_size = data_packet_size.at(rand()%5);
+                m_func_list.at(i).ram=ram.at(draw(m_workloadRNG)%3);
+                m_func_list.at(i).rom=rom.at(draw(m_workloadRNG)%3);
+                m_func_list.at(i).cores=cores.at(draw(m_workloadRNG)%3);
+                m_func_list.at(i).exec_time = exec_time.at(draw(m_workloadRNG)%6);
+                m_func_list.at(i).func_size = data_packet_size.at(draw(m_workloadRNG)%8);
+                m_func_list.at(i).result_size = data_packet_size.at(draw(m_workloadRNG)%5);
             }
             else
             {
@@ -178,12 +199,12 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
         for(uint32_t i=0;i<num_func;i++)
         {
             std::vector<int> rand_list;
-            int func_repl_rand = rand()%(func_max-func_min+1)+func_min;
+            int func_repl_rand = draw(m_workloadRNG)%(func_max-func_min+1)+func_min;
             random_value = m_node_list.size();
             for(int j = 0; j<func_repl_rand; j++)
             {
                 do{
-                    //random_value = rand()%m_node_list.size();
+                    //random_value = draw(m_topologyRNG)%m_node_list.size();
                     random_value--;
                     //random_value = m_node_list.size()-1;
                 } while(
@@ -204,7 +225,7 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
         fout<<"\n";
         fout<<"consumer section"<<"\n"; // define consumer request behavior
 
-        std::vector<double> l_prob_vector = createZipfMandelbrotDist(num_func, 0.7, 0.7);
+        IncDiscreteSampler popularity = IncDiscreteSampler::ZipfMandelbrot(num_func, 0.7, 0.7);
         generate_int_lifetime(num_func, frequency_range);
         //for(int k = 0; k < (m_node_list.size()/2); k++)
         //{
@@ -223,8 +244,7 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
                     {
                         j = i;
                     }
-                    uint32_t index = getNextZipfMandelbrotRandomNumber(l_prob_vector, num_func);
-                    index = index-1;
+                    uint32_t index = popularity.Sample(m_seqRNG);
                     string inputs = generate_input_list((m_func_list.at(index)).num_inputs, num_func);
                     fout<<(consumer.append(to_string(j)))<<"\t"<<(m_func_list.at(index)).name<<"\t"<<inputs<<"\t"<<m_freq.at(index)<<"\t"<<(m_func_list.at(index)).lifetime<<"\t"
                     <<m_startTime.at(j)<<"\t"<<m_stopTime.at(j)<<"\n";
@@ -253,8 +273,7 @@ DataGen::generate_data(uint32_t num_consumer_nodes, uint32_t num_compute_nodes,
                 std::string consumer = "consumer_";
                 if(zipf==true)
                 {
-                    uint32_t index = getNextZipfMandelbrotRandomNumber(l_prob_vector, num_func);
-                    index = index-1;
+                    uint32_t index = popularity.Sample(m_seqRNG);
                     string inputs = generate_input_list((m_func_list.at(index)).num_inputs, num_func);
                     fout<<(consumer.append(to_string(i)))<<"\t"<<(m_func_list.at(index)).name<<"\t"<<inputs<<"\t"<<m_freq.at(index)<<"\t"<<(m_func_list.at(index)).lifetime<<"\t"
                     <<m_startTime.at(i)<<"\t"<<m_stopTime.at(i)<<"\n";
@@ -296,7 +315,7 @@ DataGen::generate_func_list(uint32_t num_func, std::pair<int, int>input_range)
         funcProperties function;
         function.name = func.append(to_string(i));
         do{
-        function.num_inputs = rand()%(func_max-func_min+1)+func_min;
+        function.num_inputs = draw(m_workloadRNG)%(func_max-func_min+1)+func_min;
         }while(function.num_inputs==0);
         if(function.num_inputs == 0)
         {
@@ -334,7 +353,7 @@ DataGen::generate_input_list(int num_inputs, uint32_t num_consumer_nodes)
         {
             do{
                 operand = "Operand_";
-                int random_value = rand()%(data_max-data_min+1)+data_min;
+                int random_value = draw(m_workloadRNG)%(data_max-data_min+1)+data_min;
                 std::string value = to_string(random_value);
                 operand.append(value);
             }while(input_per_func.find(operand) != input_per_func.npos);
@@ -355,7 +374,7 @@ DataGen::generate_int_lifetime(uint32_t num_func, std::pair<int, int>frequency_r
         //int min = std::stoi(m_func_list.at(i).exec_time)+2;
         int min = 5;
         int max = frequency_range.second;
-        m_freq.push_back(to_string(rand()%(max-min+1)+min));
+        m_freq.push_back(to_string(draw(m_workloadRNG)%(max-min+1)+min));
     }
 }
 
@@ -370,7 +389,7 @@ DataGen::generate_provided_data(uint32_t num_consumer_nodes)
         dataProperties new_data;
         do{
             new_data.name = "Operand_";
-            (new_data.name).append(to_string(rand()%(max-min+1)+min)+',');
+            (new_data.name).append(to_string(draw(m_workloadRNG)%(max-min+1)+min)+',');
             auto it = find_if(begin(m_provided_data), end(m_provided_data), [=] (dataProperties const& dp)
             {
              return (dp.name == new_data.name);
@@ -392,7 +411,7 @@ DataGen::generate_start_time(uint32_t num_consumer_nodes, uint32_t sim_time)
     int max = sim_time/3;
     for(uint32_t i=0; i<num_consumer_nodes; i++)
     {
-        m_startTime.push_back(to_string(rand()%(max-min+1)+min));
+        m_startTime.push_back(to_string(draw(m_workloadRNG)%(max-min+1)+min));
     }
 }
 
@@ -403,55 +422,10 @@ DataGen::generate_stop_time(uint32_t num_consumer_nodes, uint32_t sim_time)
     int max = sim_time-2;
     for(uint32_t i=0; i<num_consumer_nodes; i++)
     {
-        m_stopTime.push_back(to_string(rand()%(max-min+1)+min));
+        m_stopTime.push_back(to_string(draw(m_workloadRNG)%(max-min+1)+min));
     }
 }
 
-std::vector<double>
-DataGen::createZipfMandelbrotDist(uint32_t f_N, double f_q, double f_s) {
-	std::vector<double> l_prob_vector = std::vector<double>(f_N + 1);
-
-	// calculate some values based on the zipf mandelbrot distribution and store it in an array
-	for (uint32_t i = 1; i <= f_N; i++) {
-		l_prob_vector[i] = l_prob_vector[i - 1] + 1.0 / std::pow(i + f_q, f_s);
-	}
-
-	// calculate the cumulative probability by printing it to the console
-	for (uint32_t i = 1; i <= f_N; i++) {
-		l_prob_vector[i] = l_prob_vector[i] / l_prob_vector[f_N];
-		//std::cout<<"Cumulative probability [" << i << "]=" << l_prob_vector[i]<<std::endl;
-	}
-	return l_prob_vector;
-}
-
-uint32_t
-DataGen::getNextZipfMandelbrotRandomNumber(std::vector<double> dist_vector, uint32_t basis) {
-    m_seqRNG = CreateObject<UniformRandomVariable>();
-	uint32_t content_index = 1; 	// set to 1 of the set [1, m_N]
-	double p_sum = 0;				// prob value is
-
-	double p_random = m_seqRNG->GetValue();
-	while (p_random == 0) {
-		p_random = m_seqRNG->GetValue();
-	}
-
-	// if (p_random == 0)
-	NS_LOG_LOGIC("p_random=" << p_random);
-	for (uint32_t i = 1; i <= basis; i++) {
-		p_sum = dist_vector[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-		// p_cum[2] = p[1] + p[2]
-		if (p_random <= p_sum) {
-			content_index = i;
-			break;
-		} // if
-	}   // for
-
-	// content_index = 1;
-	NS_LOG_INFO("RandomNumber=" << content_index);
-
-	return content_index;
-}
-
 } //namespace inc
 } //namespace ndn
 } //namespace ns3
@@ -30,6 +30,8 @@
 #include "ns3/incSIM-module.h"
 #include "ns3/ndnSIM-module.h"
 #include "ns3/ptr.h"
+#include "ns3/inc-discrete-sampler.hpp"
+#include "ns3/inc-random-streams.hpp"
 #include <ns3/node-container.h>
 #include <vector>
 #include <fstream>
@@ -91,11 +93,11 @@ namespace ns3 {
           generate_int_lifetime(uint32_t num_func, std::pair<int, int>frequency_range);
 
           private:
-
-          std::vector<double>
-          createZipfMandelbrotDist(uint32_t f_N, double f_q, double f_s);
-          uint32_t
-          getNextZipfMandelbrotRandomNumber(std::vector<double> dist_vector, uint32_t basis);
+          /**
+           * \brief (Re)create the named streams of the generator, derived from its seed
+           */
+          void
+          seed_streams();
 
           std::string m_fileToWrite;
           std::vector<struct funcProperties> m_func_list;
@@ -105,7 +107,9 @@ namespace ns3 {
           std::vector<std::string> m_startTime;
           std::vector<std::string> m_stopTime;
           uint32_t m_seed;
-          Ptr<UniformRandomVariable> m_seqRNG;
+          Ptr<UniformRandomVariable> m_topologyRNG; ///< node resources
+          Ptr<UniformRandomVariable> m_workloadRNG; ///< functions, inputs, provided data and request times
+          Ptr<UniformRandomVariable> m_seqRNG; ///< single stream of the popularity draws
         };
     }
   }
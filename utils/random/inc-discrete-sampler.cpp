@@ -0,0 +1,177 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-discrete-sampler.hpp"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <cmath>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncDiscreteSampler");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+IncDiscreteSampler::IncDiscreteSampler () : m_method (ALIAS)
+{
+}
+
+IncDiscreteSampler::IncDiscreteSampler (const std::vector<double> &weights, Method method)
+{
+  SetWeights (weights, method);
+}
+
+IncDiscreteSampler
+IncDiscreteSampler::ZipfMandelbrot (uint32_t n, double q, double s, Method method)
+{
+  std::vector<double> weights (n);
+  for (uint32_t i = 0; i < n; i++)
+    weights[i] = 1.0 / std::pow (i + 1 + q, s);
+  return IncDiscreteSampler (weights, method);
+}
+
+void
+IncDiscreteSampler::SetWeights (const std::vector<double> &weights, Method method)
+{
+  NS_ABORT_MSG_IF (weights.empty (), "discrete distribution without outcomes");
+  double total = 0;
+  for (double weight : weights)
+    {
+      NS_ABORT_MSG_IF (!(weight >= 0) || std::isinf (weight), "invalid weight " << weight);
+      total += weight;
+    }
+  NS_ABORT_MSG_IF (!(total > 0), "discrete distribution with zero total weight");
+
+  uint32_t n = weights.size ();
+  m_method = method;
+  m_probability.resize (n);
+  for (uint32_t i = 0; i < n; i++)
+    m_probability[i] = weights[i] / total;
+  m_alias.clear ();
+  m_threshold.resize (n);
+
+  if (method == INVERSE_CDF)
+    {
+      double sum = 0;
+      for (uint32_t i = 0; i < n; i++)
+        {
+          sum += m_probability[i];
+          m_threshold[i] = sum;
+        }
+      //rounding must not leave a gap below 1, the last possible outcome takes it
+      uint32_t last = n - 1;
+      while (m_probability[last] == 0)
+        last--;
+      std::fill (m_threshold.begin () + last, m_threshold.end (), 1.0);
+      return;
+    }
+
+  //Vose: pair every column below the average with one above, which donates the missing probability
+  m_alias.resize (n);
+  std::vector<double> scaled (n);
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      scaled[i] = m_probability[i] * n;
+      if (scaled[i] < 1)
+        small.push_back (i);
+      else
+        large.push_back (i);
+    }
+  while (!small.empty () && !large.empty ())
+    {
+      uint32_t less = small.back ();
+      small.pop_back ();
+      uint32_t more = large.back ();
+      m_threshold[less] = scaled[less];
+      m_alias[less] = more;
+      scaled[more] = (scaled[more] + scaled[less]) - 1;
+      if (scaled[more] < 1)
+        {
+          large.pop_back ();
+          small.push_back (more);
+        }
+    }
+  //what is left is full up to rounding
+  for (uint32_t i : large)
+    {
+      m_threshold[i] = 1;
+      m_alias[i] = i;
+    }
+  for (uint32_t i : small)
+    {
+      m_threshold[i] = 1;
+      m_alias[i] = i;
+    }
+  NS_LOG_DEBUG ("alias table of " << n << " outcomes");
+}
+
+uint32_t
+IncDiscreteSampler::Sample (double u) const
+{
+  NS_ASSERT_MSG (!m_probability.empty (), "sampling an empty distribution");
+  uint32_t n = m_probability.size ();
+  if (m_method == INVERSE_CDF)
+    {
+      auto it = std::upper_bound (m_threshold.begin (), m_threshold.end (), u);
+      return std::min<uint32_t> (it - m_threshold.begin (), n - 1);
+    }
+  double column = u * n;
+  uint32_t i = std::min<uint32_t> (column, n - 1);
+  return column - i < m_threshold[i] ? i : m_alias[i];
+}
+
+uint32_t
+IncDiscreteSampler::Sample (Ptr<UniformRandomVariable> stream) const
+{
+  return Sample (stream->GetValue (0, 1));
+}
+
+uint32_t
+IncDiscreteSampler::GetN () const
+{
+  return m_probability.size ();
+}
+
+IncDiscreteSampler::Method
+IncDiscreteSampler::GetMethod () const
+{
+  return m_method;
+}
+
+double
+IncDiscreteSampler::GetProbability (uint32_t i) const
+{
+  return m_probability.at (i);
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,108 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_DISCRETE_SAMPLER_H
+#define INC_DISCRETE_SAMPLER_H
+
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Draws indices 0..n-1 of a fixed discrete distribution, e.g. the Zipf-Mandelbrot popularity of a function
+ * catalogue
+ *
+ * The table is built once per distribution. Each draw takes a single uniform value from the caller's stream, so all
+ * users of a stream stay reproducible. The Walker/Vose alias table (ALIAS) draws in O(1). The cumulative table
+ * (INVERSE_CDF) draws by binary search in O(log n), but it keeps the order of the indices: a larger uniform value
+ * never gives a smaller index, as with the linear scan this class replaces.
+ */
+class IncDiscreteSampler
+{
+public:
+  enum Method
+  {
+    ALIAS,
+    INVERSE_CDF
+  };
+
+  IncDiscreteSampler();
+
+  /**
+   * \brief Sampler for the given non-negative weights, they do not need to be normalised
+   */
+  explicit IncDiscreteSampler(const std::vector<double>& weights, Method method = ALIAS);
+
+  /**
+   * \brief Zipf-Mandelbrot distribution over n ranks, rank i+1 has weight 1 / (i + 1 + q)^s
+   */
+  static IncDiscreteSampler
+  ZipfMandelbrot(uint32_t n, double q, double s, Method method = ALIAS);
+
+  void
+  SetWeights(const std::vector<double>& weights, Method method = ALIAS);
+
+  /**
+   * \brief Index for the uniform value u in [0, 1)
+   */
+  uint32_t
+  Sample(double u) const;
+
+  /**
+   * \brief Index for one value drawn from the stream
+   */
+  uint32_t
+  Sample(Ptr<UniformRandomVariable> stream) const;
+
+  uint32_t
+  GetN() const;
+
+  Method
+  GetMethod() const;
+
+  /**
+   * \brief Normalised probability of index i
+   */
+  double
+  GetProbability(uint32_t i) const;
+
+private:
+  Method m_method;
+  std::vector<double> m_probability; ///< normalised weights
+  std::vector<double> m_threshold;   ///< ALIAS: acceptance threshold per column, INVERSE_CDF: cumulative probability
+  std::vector<uint32_t> m_alias;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-random-streams.hpp"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/rng-seed-manager.h"
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncRandomStreams");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+IncRandomStreams &
+Simulation ()
+{
+  static IncRandomStreams streams;
+  return streams;
+}
+
+//splitmix64 finaliser, spreads every input bit over the whole result
+uint64_t
+Mix (uint64_t value)
+{
+  value += 0x9e3779b97f4a7c15ULL;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+
+} // namespace
+
+IncRandomStreams::IncRandomStreams (uint32_t masterSeed) : m_masterSeed (masterSeed)
+{
+}
+
+const IncRandomStreams &
+IncRandomStreams::Get ()
+{
+  return Simulation ();
+}
+
+void
+IncRandomStreams::SetMasterSeed (uint32_t seed)
+{
+  NS_ABORT_MSG_IF (seed == 0, "the master seed must be positive");
+  Simulation () = IncRandomStreams (seed);
+  RngSeedManager::SetSeed (seed);
+  NS_LOG_INFO ("master seed " << seed << ", run " << RngSeedManager::GetRun ());
+}
+
+uint32_t
+IncRandomStreams::GetMasterSeed () const
+{
+  return m_masterSeed;
+}
+
+int64_t
+IncRandomStreams::GetStream (const std::string &name, uint64_t index) const
+{
+  uint64_t hash = Mix (m_masterSeed);
+  for (char c : name)
+    hash = Mix (hash ^ static_cast<uint8_t> (c));
+  hash = Mix (hash ^ index);
+  return static_cast<int64_t> (hash >> 1);
+}
+
+void
+IncRandomStreams::Assign (Ptr<RandomVariableStream> variable, const std::string &name,
+                          uint64_t index) const
+{
+  int64_t stream = GetStream (name, index);
+  NS_LOG_DEBUG ("stream " << name << "[" << index << "] = " << stream);
+  variable->SetStream (stream);
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
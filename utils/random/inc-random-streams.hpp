@@ -0,0 +1,104 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_RANDOM_STREAMS_H
+#define INC_RANDOM_STREAMS_H
+
+#include "ns3/ptr.h"
+#include "ns3/object.h"
+#include "ns3/random-variable-stream.h"
+
+#include <cstdint>
+#include <string>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Allocates ns-3 random streams by name, derived from a master seed
+ *
+ * Every subsystem draws from its own named stream, e.g. "topology", "workload", "popularity", "consumers",
+ * "nonces" or "failures". An index separates the instances of one subsystem, e.g. one stream per consumer app. The
+ * stream number is a hash of master seed, name and index. What one subsystem draws therefore never shifts the
+ * numbers of another, and two runs with the same master seed see the same numbers in every subsystem. Runs that
+ * compare orchestration strategies thus use common random numbers. Replicas are selected with the ns-3 run number
+ * (RngRun), which picks another substream of every stream.
+ *
+ * Stream numbers stay below 2^63, the range ns-3 reserves for explicitly assigned streams.
+ */
+class IncRandomStreams
+{
+public:
+  explicit IncRandomStreams(uint32_t masterSeed = 1);
+
+  /**
+   * \brief Streams of the simulation, derived from the master seed set with SetMasterSeed
+   */
+  static const IncRandomStreams&
+  Get();
+
+  /**
+   * \brief Set the master seed of Get and the ns-3 global seed, must be called before any stream is assigned
+   */
+  static void
+  SetMasterSeed(uint32_t seed);
+
+  uint32_t
+  GetMasterSeed() const;
+
+  /**
+   * \brief Stream number of the index'th stream of the named subsystem
+   */
+  int64_t
+  GetStream(const std::string& name, uint64_t index = 0) const;
+
+  /**
+   * \brief Let an existing random variable draw from the named stream
+   */
+  void
+  Assign(Ptr<RandomVariableStream> variable, const std::string& name, uint64_t index = 0) const;
+
+  /**
+   * \brief Create a random variable drawing from the named stream
+   */
+  template<class T>
+  Ptr<T>
+  Create(const std::string& name, uint64_t index = 0) const
+  {
+    Ptr<T> variable = CreateObject<T>();
+    Assign(variable, name, index);
+    return variable;
+  }
+
+private:
+  uint32_t m_masterSeed;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
@@ -0,0 +1,328 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-timer-wheel.hpp"
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncTimerWheel");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+NS_OBJECT_ENSURE_REGISTERED (IncTimerWheel);
+
+const IncTimerWheel::Handle IncTimerWheel::INVALID = std::numeric_limits<uint64_t>::max ();
+const uint32_t IncTimerWheel::NONE = std::numeric_limits<uint32_t>::max ();
+
+TypeId
+IncTimerWheel::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncTimerWheel")
+          .SetParent<Object> ()
+          .AddConstructor<IncTimerWheel> ()
+          .AddAttribute ("Tick", "Resolution of the timers", TimeValue (MilliSeconds (10)),
+                         MakeTimeAccessor (&IncTimerWheel::m_tick), MakeTimeChecker (NanoSeconds (1)))
+          .AddAttribute ("Levels",
+                         "Number of levels of 64 slots, timers further ahead than 64^Levels ticks wait in an "
+                         "overflow list",
+                         UintegerValue (4), MakeUintegerAccessor (&IncTimerWheel::m_levels),
+                         MakeUintegerChecker<uint32_t> (1, 10));
+  return tid;
+}
+
+IncTimerWheel::IncTimerWheel ()
+    : m_free (NONE),
+      m_size (0),
+      m_now (0),
+      m_armed (std::numeric_limits<int64_t>::max ()),
+      m_advancing (false)
+{
+}
+
+IncTimerWheel::~IncTimerWheel ()
+{
+}
+
+Ptr<IncTimerWheel>
+IncTimerWheel::GetWheel (Ptr<Node> node)
+{
+  Ptr<IncTimerWheel> wheel = node->GetObject<IncTimerWheel> ();
+  if (wheel == 0)
+    {
+      wheel = CreateObject<IncTimerWheel> ();
+      node->AggregateObject (wheel);
+    }
+  return wheel;
+}
+
+void
+IncTimerWheel::DoDispose ()
+{
+  Simulator::Cancel (m_advanceEvent);
+  m_owners.clear ();
+  m_entries.clear ();
+  m_slots.clear ();
+  Object::DoDispose ();
+}
+
+uint32_t
+IncTimerWheel::Register (Callback<void, uint64_t> expired)
+{
+  m_owners.push_back (expired);
+  return m_owners.size () - 1;
+}
+
+void
+IncTimerWheel::Unregister (uint32_t owner)
+{
+  NS_ASSERT (owner < m_owners.size ());
+  for (uint32_t i = 0; i < m_entries.size (); i++)
+    if (m_entries[i].slot != NONE && m_entries[i].owner == owner)
+      Unlink (i);
+  m_owners[owner].Nullify ();
+  if (m_size == 0)
+    {
+      Simulator::Cancel (m_advanceEvent);
+      m_armed = std::numeric_limits<int64_t>::max ();
+    }
+}
+
+IncTimerWheel::Handle
+IncTimerWheel::Schedule (Time delay, uint32_t owner, uint64_t key)
+{
+  NS_ASSERT (owner < m_owners.size () && !m_owners[owner].IsNull ());
+  if (m_slots.empty ())
+    {
+      m_slots.assign (m_levels * SLOTS + 1, NONE);
+      m_occupied.assign (m_levels, 0);
+    }
+
+  // the wheel skips ahead to the present when no slot is due in between
+  int64_t current = GetCurrentTick ();
+  if (current > m_now && (m_size == 0 || GetNextTick () > current))
+    m_now = current;
+
+  int64_t tick = m_tick.GetTimeStep ();
+  int64_t expiry = ((Simulator::Now () + delay).GetTimeStep () + tick - 1) / tick;
+
+  uint32_t index = m_free;
+  if (index == NONE)
+    {
+      index = m_entries.size ();
+      m_entries.push_back (Entry ());
+      m_entries[index].generation = 0;
+    }
+  else
+    m_free = m_entries[index].next;
+  Entry &entry = m_entries[index];
+  entry.key = key;
+  entry.expiry = std::max (expiry, m_now + 1);
+  entry.owner = owner;
+  Insert (index);
+  m_size++;
+  Arm ();
+  return (static_cast<uint64_t> (entry.generation) << 32) | index;
+}
+
+void
+IncTimerWheel::Cancel (Handle handle)
+{
+  uint32_t index = handle & NONE;
+  if (handle == INVALID || index >= m_entries.size () || m_entries[index].slot == NONE ||
+      m_entries[index].generation != (handle >> 32))
+    return;
+  Unlink (index);
+  if (m_size == 0)
+    {
+      Simulator::Cancel (m_advanceEvent);
+      m_armed = std::numeric_limits<int64_t>::max ();
+    }
+}
+
+uint32_t
+IncTimerWheel::GetSize () const
+{
+  return m_size;
+}
+
+void
+IncTimerWheel::Insert (uint32_t index)
+{
+  Entry &entry = m_entries[index];
+  NS_ASSERT (entry.expiry >= m_now); // entries due now only come from a cascade, before the slot of now is handled
+
+  // the lowest level on which expiry and the current tick only differ in the slot
+  uint32_t slot = m_levels * SLOTS;
+  for (uint32_t level = 0; level < m_levels; level++)
+    {
+      uint32_t shift = SLOT_BITS * (level + 1);
+      if ((entry.expiry >> shift) == (m_now >> shift))
+        {
+          uint32_t digit = (entry.expiry >> (shift - SLOT_BITS)) & (SLOTS - 1);
+          slot = level * SLOTS + digit;
+          m_occupied[level] |= uint64_t (1) << digit;
+          break;
+        }
+    }
+
+  entry.slot = slot;
+  entry.prev = NONE;
+  entry.next = m_slots[slot];
+  if (entry.next != NONE)
+    m_entries[entry.next].prev = index;
+  m_slots[slot] = index;
+}
+
+void
+IncTimerWheel::Unlink (uint32_t index)
+{
+  Entry &entry = m_entries[index];
+  if (entry.prev != NONE)
+    m_entries[entry.prev].next = entry.next;
+  else
+    {
+      m_slots[entry.slot] = entry.next;
+      if (entry.next == NONE && entry.slot < m_levels * SLOTS)
+        m_occupied[entry.slot / SLOTS] &= ~(uint64_t (1) << (entry.slot % SLOTS));
+    }
+  if (entry.next != NONE)
+    m_entries[entry.next].prev = entry.prev;
+  entry.slot = NONE;
+  entry.generation++;
+  entry.next = m_free;
+  m_free = index;
+  m_size--;
+}
+
+void
+IncTimerWheel::Cascade (uint32_t slot)
+{
+  uint32_t index = m_slots[slot];
+  m_slots[slot] = NONE;
+  if (slot < m_levels * SLOTS)
+    m_occupied[slot / SLOTS] &= ~(uint64_t (1) << (slot % SLOTS));
+  while (index != NONE)
+    {
+      uint32_t next = m_entries[index].next;
+      Insert (index);
+      index = next;
+    }
+}
+
+int64_t
+IncTimerWheel::GetNextTick () const
+{
+  // slots of a level all lie behind those of the levels below, the first level with a slot ahead decides
+  for (uint32_t level = 0; level < m_levels; level++)
+    {
+      uint32_t shift = SLOT_BITS * level;
+      uint32_t digit = (m_now >> shift) & (SLOTS - 1);
+      uint64_t ahead = digit == SLOTS - 1 ? 0 : m_occupied[level] & (~uint64_t (0) << (digit + 1));
+      if (ahead != 0)
+        {
+          int64_t base = (m_now >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+          return base + (static_cast<int64_t> (__builtin_ctzll (ahead)) << shift);
+        }
+    }
+  if (m_slots[m_levels * SLOTS] != NONE)
+    {
+      uint32_t shift = SLOT_BITS * m_levels;
+      return ((m_now >> shift) + 1) << shift;
+    }
+  return std::numeric_limits<int64_t>::max ();
+}
+
+void
+IncTimerWheel::Arm ()
+{
+  if (m_advancing || m_size == 0)
+    return;
+  int64_t next = GetNextTick ();
+  if (next >= m_armed)
+    return;
+  Simulator::Cancel (m_advanceEvent);
+  m_armed = next;
+  Time delay = TimeStep (next * m_tick.GetTimeStep ()) - Simulator::Now ();
+  m_advanceEvent = Simulator::Schedule (Max (delay, Seconds (0)), &IncTimerWheel::Advance, this);
+}
+
+int64_t
+IncTimerWheel::GetCurrentTick () const
+{
+  return Simulator::Now ().GetTimeStep () / m_tick.GetTimeStep ();
+}
+
+void
+IncTimerWheel::Advance ()
+{
+  m_armed = std::numeric_limits<int64_t>::max ();
+  m_advancing = true;
+
+  int64_t current = GetCurrentTick ();
+  std::vector<std::pair<uint32_t, uint64_t>> expired;
+  while (m_size > 0)
+    {
+      int64_t next = GetNextTick ();
+      if (next > current)
+        break;
+      m_now = next;
+
+      // slots whose range starts now move down, the highest level first
+      if ((m_now & ((int64_t (1) << (SLOT_BITS * m_levels)) - 1)) == 0)
+        Cascade (m_levels * SLOTS);
+      for (uint32_t level = m_levels - 1; level > 0; level--)
+        if ((m_now & ((int64_t (1) << (SLOT_BITS * level)) - 1)) == 0)
+          Cascade (level * SLOTS + ((m_now >> (SLOT_BITS * level)) & (SLOTS - 1)));
+
+      // expired timers leave the wheel before their owners are called, which may schedule or cancel timers
+      expired.clear ();
+      uint32_t index = m_slots[m_now & (SLOTS - 1)];
+      while (index != NONE)
+        {
+          uint32_t next = m_entries[index].next;
+          NS_ASSERT (m_entries[index].expiry == m_now);
+          expired.push_back (std::make_pair (m_entries[index].owner, m_entries[index].key));
+          Unlink (index);
+          index = next;
+        }
+      for (auto &timer : expired)
+        m_owners[timer.first](timer.second);
+    }
+
+  m_advancing = false;
+  Arm ();
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
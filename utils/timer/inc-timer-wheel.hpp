@@ -0,0 +1,170 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_TIMER_WHEEL_H
+#define INC_TIMER_WHEEL_H
+
+#include "ns3/object.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Hierarchical timing wheel for large numbers of timeouts, e.g. of outstanding interests
+ *
+ * Timers are identified by an owner, registered once with its expiry callback, and a key of the owner. Time is
+ * divided into ticks of Tick length, a timer expires on the first tick at or after its expiry time. Level l of the
+ * wheel has 64 slots of 64^l ticks each, timers move down a level when the wheel reaches their slot; timers beyond
+ * the last level wait in an overflow list. Scheduling and cancelling a timer is O(1).
+ *
+ * The wheel holds at most one simulator event, armed for the next tick a slot is due. It is only rearmed when a
+ * timer is scheduled before it; cancelled timers leave it in place and the wheel rearms when it finds nothing to do.
+ * Apps of a node share the wheel aggregated to the node, see GetWheel.
+ */
+class IncTimerWheel : public Object
+{
+public:
+  typedef uint64_t Handle;
+
+  static const Handle INVALID;
+
+  static TypeId
+  GetTypeId();
+
+  IncTimerWheel();
+  virtual ~IncTimerWheel();
+
+  /**
+   * \brief Timer wheel of the node, created and aggregated on first use
+   */
+  static Ptr<IncTimerWheel>
+  GetWheel(Ptr<Node> node);
+
+  /**
+   * \return owner id to schedule timers for, expired timers are handed to expired with their key
+   */
+  uint32_t
+  Register(Callback<void, uint64_t> expired);
+
+  /**
+   * \brief Cancel all timers of the owner and forget it
+   */
+  void
+  Unregister(uint32_t owner);
+
+  Handle
+  Schedule(Time delay, uint32_t owner, uint64_t key);
+
+  /**
+   * \brief Cancel a pending timer, handles of expired or cancelled timers are ignored
+   */
+  void
+  Cancel(Handle handle);
+
+  /**
+   * \brief Number of pending timers
+   */
+  uint32_t
+  GetSize() const;
+
+protected:
+  virtual void
+  DoDispose();
+
+private:
+  void
+  Advance();
+
+  /**
+   * \brief Tick at which the next slot is due, expired or moved down a level
+   */
+  int64_t
+  GetNextTick() const;
+
+  /**
+   * \brief Put an entry into the slot of its expiry relative to the current tick of the wheel
+   */
+  void
+  Insert(uint32_t index);
+
+  void
+  Unlink(uint32_t index);
+
+  /**
+   * \brief Move the entries of a slot to the lower levels
+   */
+  void
+  Cascade(uint32_t slot);
+
+  void
+  Arm();
+
+  int64_t
+  GetCurrentTick() const;
+
+private:
+  static const uint32_t NONE;
+  static const uint32_t SLOT_BITS = 6;
+  static const uint32_t SLOTS = 1 << SLOT_BITS;
+
+  struct Entry
+  {
+    uint64_t key;
+    int64_t expiry; ///< tick
+    uint32_t owner;
+    uint32_t generation; ///< makes handles of reused entries stale
+    uint32_t slot;
+    uint32_t prev;
+    uint32_t next;
+  };
+
+  Time m_tick;
+  uint32_t m_levels;
+
+  std::vector<uint32_t> m_slots;    ///< first entry of every slot, level by level, the overflow list last
+  std::vector<uint64_t> m_occupied; ///< non-empty slots of every level
+  std::vector<Entry> m_entries;     ///< pool of entries, unused ones are chained through next
+  uint32_t m_free;
+  uint32_t m_size;
+  int64_t m_now;   ///< tick the wheel advanced to, all slots up to it are handled
+  int64_t m_armed; ///< tick m_advanceEvent fires at
+  bool m_advancing;
+  EventId m_advanceEvent;
+  std::vector<Callback<void, uint64_t>> m_owners;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
@@ -58,7 +58,10 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graphviz.hpp>
 #include "ns3/incSIM-module.h"
+#include <algorithm>
 #include <set>
+#include <cmath>
+#include <cstdlib>
 
 #ifdef NS3_MPI
 #include <ns3/mpi-interface.h>
@@ -70,21 +73,110 @@ namespace ndn {
 namespace inc {
 NS_LOG_COMPONENT_DEFINE ("IncNdnAnnotatedTopologyReader");
 
+namespace {
+
+/**
+ * Expected request rate on every link: each consumer request is routed over the fewest hops to the nearest node its
+ * function is initially placed on, requests of functions without placement are not counted
+ */
+std::vector<double>
+EstimateTraffic (const IncScenario &scenario)
+{
+  const std::vector<IncTopologyLink> &links = scenario.GetLinks ();
+  uint32_t n = scenario.GetNodes ().size ();
+  std::vector<uint32_t> offsets (n + 1, 0);
+  for (auto &link : links)
+    {
+      offsets[link.fromNode + 1]++;
+      offsets[link.toNode + 1]++;
+    }
+  for (uint32_t i = 0; i < n; i++)
+    offsets[i + 1] += offsets[i];
+  std::vector<uint32_t> incident (offsets[n]);
+  std::vector<uint32_t> fill (offsets.begin (), offsets.end () - 1);
+  for (uint32_t l = 0; l < links.size (); l++)
+    {
+      incident[fill[links[l].fromNode]++] = l;
+      incident[fill[links[l].toNode]++] = l;
+    }
+
+  std::vector<std::vector<uint32_t>> placements (scenario.GetFunctions ().size ());
+  for (auto &placement : scenario.GetPlacements ())
+    placements[placement.functionIndex].push_back (placement.nodeIndex);
+  std::vector<std::vector<const IncConsumerRequest *>> requests (scenario.GetFunctions ().size ());
+  for (auto &request : scenario.GetRequests ())
+    requests[request.functionIndex].push_back (&request);
+
+  std::vector<double> traffic (links.size (), 0);
+  std::vector<double> demand (n);
+  std::vector<uint32_t> parentLink (n);
+  std::vector<bool> visited (n);
+  std::vector<uint32_t> order;
+  for (uint32_t f = 0; f < placements.size (); f++)
+    {
+      if (placements[f].empty () || requests[f].empty ())
+        continue;
+      std::fill (demand.begin (), demand.end (), 0);
+      std::fill (visited.begin (), visited.end (), false);
+      for (auto request : requests[f])
+        {
+          double rate = std::strtod (request->frequency.c_str (), 0);
+          demand[request->consumerIndex] += rate > 0 ? rate : 1;
+        }
+
+      //breadth first from all placements, then every node hands its demand to its parent
+      order.clear ();
+      for (uint32_t node : placements[f])
+        if (!visited[node])
+          {
+            visited[node] = true;
+            parentLink[node] = links.size ();
+            order.push_back (node);
+          }
+      for (size_t i = 0; i < order.size (); i++)
+        for (uint32_t e = offsets[order[i]]; e < offsets[order[i] + 1]; e++)
+          {
+            const IncTopologyLink &link = links[incident[e]];
+            uint32_t next = link.fromNode == order[i] ? link.toNode : link.fromNode;
+            if (visited[next])
+              continue;
+            visited[next] = true;
+            parentLink[next] = incident[e];
+            order.push_back (next);
+          }
+      for (size_t i = order.size (); i > 0; i--)
+        {
+          uint32_t node = order[i - 1];
+          if (parentLink[node] == links.size () || demand[node] == 0)
+            continue;
+          const IncTopologyLink &link = links[parentLink[node]];
+          traffic[parentLink[node]] += demand[node];
+          demand[link.fromNode == node ? link.toNode : link.fromNode] += demand[node];
+        }
+    }
+  return traffic;
+}
+
+} // namespace
+
 IncNdnAnnotatedTopologyReader::IncNdnAnnotatedTopologyReader (const std::string &path,
                                                               double scale /*=1.0*/)
     : m_path (path),
       m_randX (CreateObject<UniformRandomVariable> ()),
       m_randY (CreateObject<UniformRandomVariable> ()),
       m_scale (scale),
-      m_requiredPartitions (1)
+      m_requiredPartitions (1),
+      m_partitions (0),
+      m_minLookahead (Seconds (0)),
+      m_lookahead (Time::Max ())
 {
   NS_LOG_FUNCTION (this);
 
   m_randX->SetAttribute ("Min", DoubleValue (0));
-  m_randX->SetAttribute ("Max", DoubleValue (100.0));
+  m_randX->SetAttribute ("Max", DoubleValue (200.0));
 
   m_randY->SetAttribute ("Min", DoubleValue (0));
-  m_randY->SetAttribute ("Max", DoubleValue (100.0));
+  m_randY->SetAttribute ("Max", DoubleValue (200.0));
 
   SetMobilityModel ("ns3::ConstantPositionMobilityModel");
 }
@@ -101,6 +193,24 @@ IncNdnAnnotatedTopologyReader::SetBoundingBox (double ulx, double uly, double lr
   m_randY->SetAttribute ("Max", DoubleValue (lry));
 }
 
+void
+IncNdnAnnotatedTopologyReader::SetPartitions (uint32_t partitions)
+{
+  m_partitions = partitions;
+}
+
+void
+IncNdnAnnotatedTopologyReader::SetMinLookahead (Time lookahead)
+{
+  m_minLookahead = lookahead;
+}
+
+Time
+IncNdnAnnotatedTopologyReader::GetLookahead () const
+{
+  return m_lookahead;
+}
+
 void
 IncNdnAnnotatedTopologyReader::SetMobilityModel (const std::string &model)
 {
@@ -242,334 +352,225 @@ IncNdnAnnotatedTopologyReader::GetInitialFunctionStatusMap ()
 std::pair<NodeContainer, NodeContainer>
 IncNdnAnnotatedTopologyReader::ReadTopology (void)
 {
-
-  ifstream topgen;
-  topgen.open (GetFileName ().c_str ());
-  string curSection;
-
-  if (!topgen.is_open () || !topgen.good ())
-    {
-      NS_FATAL_ERROR ("Cannot open file " << GetFileName () << " for reading");
-      return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
-    }
-
-  while (!topgen.eof ())
+  AssignStreams ();
+  if (GetPartitionCount () > 1)
     {
-      string line;
-      getline (topgen, line);
-
-      if (line == "router")
+      //the partition needs the whole graph before the first node is created
+      IncScenario scenario;
+      std::string error;
+      if (!scenario.Load (GetFileName (), error))
         {
-          curSection = "router";
-          break;
+          NS_FATAL_ERROR (error);
+          return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
         }
+      return ReadTopology (scenario);
     }
-
-  if (topgen.eof ())
+  if (IncTopologyCache::IsCache (GetFileName ()))
     {
-      NS_FATAL_ERROR ("Topology file " << GetFileName () << " does not have \"router\" section");
-      return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
-    }
-
-  while (!topgen.eof ())
-    {
-      string line;
-      getline (topgen, line);
-      if (line[0] == '#')
-        continue; // comments
-      if (line == "links")
+      IncTopologyCache cache;
+      if (!cache.Open (GetFileName ()) || !cache.Replay (*this))
         {
-          curSection = "link";
-          break; // stop reading nodes
-        }
-
-      istringstream lineBuffer (line);
-      std::string name;
-      double latitude = 0, longitude = 0;
-      uint32_t systemId = 0;
-      uint32_t processor_core = 0, RAM = 0, ROM = 0;
-      uint32_t processor_speed = 0;
-      uint32_t queue = 0;
-      string runtimes = "", links = "";
-
-      lineBuffer >> name >> latitude >> longitude >> processor_core >> processor_speed >> RAM >>
-          ROM >> queue >> links >> runtimes;
-
-      if (name.empty ())
-        continue;
-
-      if (boost::contains (name, "orchestrator") || boost::contains (name, "compute"))
-        {
-          Ptr<IncOrchestrationComputeNode> node;
-          if (abs (latitude) > 0.001 && abs (latitude) > 0.001)
-            node = CreateIncComputeNode (name, m_scale * longitude, -m_scale * latitude, systemId);
-          else
-            {
-              Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable> ();
-              node = CreateIncComputeNode (name, var->GetValue (0, 200), var->GetValue (0, 200),
-                                           systemId);
-            }
-
-          node->SetName (name);
-          node->SetProcessorCore (processor_core);
-          node->SetProcessorClockSpeed (processor_speed);
-          node->SetRam (RAM);
-          node->SetRom (ROM);
-          node->SetLinks (links);
-          node->SetSupportedRuntimes (runtimes);
-          node->SetQueueSize(queue);
-        }
-      else if (boost::contains (name, "consumer"))
-        {
-          Ptr<Node> node;
-          //std::cout<<"Node name is "<<name<<std::endl;
-          if (abs (latitude) > 0.001 && abs (latitude) > 0.001)
-            node = CreateNode (name, m_scale * longitude, -m_scale * latitude, systemId);
-          else
-            {
-              Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable> ();
-              node = CreateNode (name, var->GetValue (0, 200), var->GetValue (0, 200), systemId);
-            }
+          NS_FATAL_ERROR (cache.GetError ());
+          return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
         }
     }
-
-  map<string, set<string>> processedLinks; // to eliminate duplications
-
-  if (topgen.eof ())
+  else
     {
-      NS_LOG_ERROR ("Topology file " << GetFileName () << " does not have \"link\" section");
-      return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
-    }
-
-  // SeekToSection ("link");
-  while (!topgen.eof ())
-    {
-      string line;
-      getline (topgen, line);
-      if (line == "")
-        continue;
-      if (line[0] == '#')
-        continue; // comments
-      if (line == "functions" || line == "initial function status" || line == "consumer section")
-        {
-          curSection = line;
-          break; // stop reading nodes
-        }
-
-      // NS_LOG_DEBUG ("Input: [" << line << "]");
-      istringstream lineBuffer (line);
-      string from, to, capacity, metric, delay, maxPackets, lossRate;
-
-      lineBuffer >> from >> to >> capacity >> metric >> delay >> maxPackets >> lossRate;
-
-      if (processedLinks[to].size () != 0 &&
-          processedLinks[to].find (from) != processedLinks[to].end ())
+      IncTopologyParser parser (*this);
+      if (!parser.Parse (GetFileName ()))
         {
-          continue; // duplicated link
+          NS_FATAL_ERROR (parser.GetError ());
+          return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
         }
-      processedLinks[from].insert (to);
-
-      Ptr<Node> fromNode = Names::Find<Node> (m_path, from);
-      NS_ASSERT_MSG (fromNode != 0, from << " node not found");
-      Ptr<Node> toNode = Names::Find<Node> (m_path, to);
-      NS_ASSERT_MSG (toNode != 0, to << " node not found");
-
-      Link link (fromNode, from, toNode, to);
-
-      link.SetAttribute ("DataRate", capacity);
-      link.SetAttribute ("OSPF", metric);
-
-      if (!delay.empty ())
-        link.SetAttribute ("Delay", delay);
-      if (!maxPackets.empty ())
-        link.SetAttribute ("MaxPackets", maxPackets);
+    }
+  return FinishTopology ();
+}
 
-      // Saran Added lossRate
-      if (!lossRate.empty ())
-        link.SetAttribute ("LossRate", lossRate);
+std::pair<NodeContainer, NodeContainer>
+IncNdnAnnotatedTopologyReader::ReadTopology (const IncScenario &scenario)
+{
+  AssignStreams ();
+  PartitionScenario (scenario);
+  scenario.Replay (*this);
+  return FinishTopology ();
+}
 
-      AddLink (link);
-      NS_LOG_DEBUG ("New link " << from << " <==> " << to << " / " << capacity << " with " << metric
-                                << " metric (" << delay << ", " << maxPackets << ", " << lossRate
-                                << ")");
-    }
+uint32_t
+IncNdnAnnotatedTopologyReader::GetPartitionCount () const
+{
+#ifdef NS3_MPI
+  if (m_partitions == 0 && MpiInterface::IsEnabled ())
+    return MpiInterface::GetSize ();
+#endif
+  return std::max<uint32_t> (m_partitions, 1);
+}
 
-  if (topgen.eof ())
+void
+IncNdnAnnotatedTopologyReader::PartitionScenario (const IncScenario &scenario)
+{
+  m_systemIds.clear ();
+  m_lookahead = Time::Max ();
+  uint32_t partitions = GetPartitionCount ();
+  if (partitions <= 1)
+    return;
+
+  //vertices are weighted by the traffic they handle, edges by the traffic they carry
+  const std::vector<IncTopologyLink> &links = scenario.GetLinks ();
+  std::vector<double> traffic = EstimateTraffic (scenario);
+  std::vector<double> load (scenario.GetNodes ().size (), 1);
+  for (uint32_t l = 0; l < links.size (); l++)
     {
-      NS_LOG_ERROR ("Topology file " << GetFileName ()
-                                     << " does not have \"initial function status\" section");
-      return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
+      load[links[l].fromNode] += traffic[l] / 2;
+      load[links[l].toNode] += traffic[l] / 2;
     }
-
-  // SeekToSection ("functions");
-  while (!topgen.eof ())
+  IncGraphPartitioner partitioner;
+  for (double weight : load)
+    partitioner.AddVertex (weight);
+  std::vector<Time> delays (links.size ());
+  for (uint32_t l = 0; l < links.size (); l++)
     {
-      if (curSection == "initial function status")
-        {
-          break;
-        }
-      string line;
-      getline (topgen, line);
-      if (line == "")
-        continue;
-      if (line[0] == '#')
-        continue; // comments
-      if (line == "initial function status")
-        {
-          curSection == "initial function status";
-          break; // stop reading functions
-        }
-
-      // NS_LOG_DEBUG ("Input: [" << line << "]");
-
-      istringstream lineBuffer (line);
-      string name, inputListString, rumtimesRequiredString;
-      uint32_t ram, rom, cpu, funcSize, resultSize, num_inputs, NumInstructions;
-      double execTime;
-
-      lineBuffer >> name >> inputListString >> rumtimesRequiredString >> ram >> rom >> cpu >> execTime >>
-          NumInstructions >> funcSize >> resultSize;
-
-      std::vector<std::string> rumtimesRequired;
-      std::string delim = ";";
-      auto start = 0U;
-      auto end = rumtimesRequiredString.find (delim);
-
-      while (end != std::string::npos)
-        {
-          rumtimesRequired.push_back (rumtimesRequiredString.substr (start, end - start));
-          start = end + delim.length ();
-          end = rumtimesRequiredString.find (delim, start);
-        }
+      partitioner.AddEdge (links[l].fromNode, links[l].toNode, 1 + traffic[l]);
+      delays[l] = links[l].delay.empty () ? Seconds (0) : Time (links[l].delay);
+      if (delays[l].IsZero () || delays[l] < m_minLookahead)
+        partitioner.Join (links[l].fromNode, links[l].toNode);
+    }
+  m_systemIds = partitioner.Partition (partitions);
+  m_requiredPartitions = partitions;
 
-      if(!(inputListString.compare("null")==0))
+  uint32_t cut = 0;
+  for (uint32_t l = 0; l < links.size (); l++)
+    if (m_systemIds[links[l].fromNode] != m_systemIds[links[l].toNode])
       {
-        std::vector<std::string> signature;
-        boost::split(signature, inputListString, boost::is_any_of(","));
-        num_inputs = signature.size();
+        cut++;
+        m_lookahead = std::min (m_lookahead, delays[l]);
       }
-      else
+  NS_ASSERT_MSG (!m_lookahead.IsZero (), "a zero delay link was cut");
+  NS_LOG_INFO ("Topology split into " << partitions << " partitions, " << cut << " of " << links.size ()
+                                      << " links cut carrying " << partitioner.GetCutWeight () - cut
+                                      << " requests/s, lookahead " << m_lookahead);
+}
+
+void
+IncNdnAnnotatedTopologyReader::AssignStreams ()
+{
+  //nodes without position are placed the same way, whatever was drawn before the topology is read
+  IncRandomStreams::Get ().Assign (m_randX, "positions", 0);
+  IncRandomStreams::Get ().Assign (m_randY, "positions", 1);
+}
+
+std::pair<NodeContainer, NodeContainer>
+IncNdnAnnotatedTopologyReader::FinishTopology ()
+{
+  //   add the functions to compute nodes, once the consumer section completed their input lists
+  for (uint32_t i = 1; i < m_inc_compute_nodes.size (); i++)
+    for (auto itr = m_function_list.begin (); itr != m_function_list.end (); ++itr)
       {
-        num_inputs = 0;
+        m_inc_compute_nodes.at (i)->AddNewFunction (((*itr)->getName ()).toUri (), *itr);
       }
+  m_read_nodes.clear ();
+  m_systemIds.clear ();
 
+  //do log
+  NS_LOG_INFO ("Annotated topology created with "
+               << (m_compute_nodecontainer.GetN () + m_consumer_nodecontainer.GetN ())
+               << " nodes and " << LinksSize () << " links and " << m_initial_func_status.size ()
+               << " function initial status setting");
+  ApplySettings ();
+  return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
+}
 
-      Ptr<INC_Computation> t_func = CreateObject<INC_Computation> ();
-      t_func->setName (name);
-      t_func->SetCpu (cpu);
-      t_func->SetRam (ram);
-      t_func->SetRom (rom);
-      t_func->SetExecTime (execTime);
-      t_func->SetNumInstructions (NumInstructions);
-      t_func->SetFuncSize (funcSize);
-      t_func->SetResultSize (resultSize);
-      t_func->SetRuntimeEnvironment (rumtimesRequired);
-      t_func->SetParamNumber(num_inputs);
-      m_function_list.push_back (t_func);
-      NS_LOG_DEBUG ("New function "
-                    << name << " cpu=" << cpu << " ram=" << ram << " rom=" << rom
-                    << " execution_time=" << execTime << "input_params=" << inputListString
-                    << "function size=" << funcSize << "result size=" << resultSize
-                    << " runtime_environment=" << rumtimesRequiredString << std::endl);
-    }
+void
+IncNdnAnnotatedTopologyReader::OnNode (uint32_t index, const IncTopologyNode &node)
+{
+  //nodes without a position are placed randomly within the bounding box
+  bool positioned = std::abs (node.latitude) > 0.001;
+  double posX = positioned ? m_scale * node.longitude : m_randX->GetValue ();
+  double posY = positioned ? -m_scale * node.latitude : m_randY->GetValue ();
+  uint32_t systemId = index < m_systemIds.size () ? m_systemIds[index] : 0;
 
-  if (topgen.eof ())
+  if (node.type == IncTopologyNode::Compute)
     {
-      NS_LOG_ERROR ("Topology file " << GetFileName ()
-                                     << " does not have \"initial function status\" section");
-      return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
+      Ptr<IncOrchestrationComputeNode> computeNode =
+          CreateIncComputeNode (node.name, posX, posY, systemId);
+      computeNode->SetName (node.name);
+      computeNode->SetProcessorCore (node.cores);
+      computeNode->SetProcessorClockSpeed (node.clockSpeed);
+      computeNode->SetRam (node.ram);
+      computeNode->SetRom (node.rom);
+      computeNode->SetLinks (node.links);
+      computeNode->SetSupportedRuntimes (node.runtimes);
+      computeNode->SetQueueSize (node.queue);
+      m_read_nodes.push_back (computeNode->GetNode ());
     }
-
-  // SeekToSection ("initial function status");
-  while (!topgen.eof ())
+  else
     {
-      string line;
-      getline (topgen, line);
-      if (line == "")
-        continue;
-      if (line[0] == '#')
-        continue; // comments
-      if (line == "consumer section")
-        {
-          curSection = "consumer section";
-          break;
-        }
+      m_read_nodes.push_back (CreateNode (node.name, posX, posY, systemId));
+    }
+}
 
-      istringstream lineBuffer (line);
-      string node_name, func_name;
+void
+IncNdnAnnotatedTopologyReader::OnLink (const IncTopologyLink &link)
+{
+  Link newLink (m_read_nodes[link.fromNode], link.from, m_read_nodes[link.toNode], link.to);
 
-      lineBuffer >> node_name >> func_name;
+  newLink.SetAttribute ("DataRate", link.capacity);
+  newLink.SetAttribute ("OSPF", link.metric);
 
-      if (m_initial_func_status.find (node_name) == m_initial_func_status.end ())
-        {
-          vector<string> t_vector;
-          t_vector.push_back (func_name);
-          m_initial_func_status.emplace (node_name, t_vector);
-        }
-      else
-        {
-          m_initial_func_status[node_name].push_back (func_name);
-        }
-      }
-
-  while (!topgen.eof ())
-    {
-      string line;
-      getline (topgen, line);
-      if (line == "")
-        continue;
-      if (line[0] == '#')
-        continue; // comments
-      if (line == "initial data section")
-        {
-          curSection = "initial data section";
-          break;
-        }
+  if (!link.delay.empty ())
+    newLink.SetAttribute ("Delay", link.delay);
+  if (!link.maxPackets.empty ())
+    newLink.SetAttribute ("MaxPackets", link.maxPackets);
 
-      istringstream lineBuffer (line);
-      string node_name, func_name, InputParamList;
-      lineBuffer >> node_name >> func_name >> InputParamList;
+  // Saran Added lossRate
+  if (!link.lossRate.empty ())
+    newLink.SetAttribute ("LossRate", link.lossRate);
 
-      NS_LOG_DEBUG("InputParamList is "<<InputParamList);
-      std::vector<std::string> inputs;
-      if (!(InputParamList.compare ("null") == 0))
-        {
-          boost::split (inputs, InputParamList, boost::is_any_of (","));
-        }
-        else
-        {
-          inputs.clear();
-        }
+  AddLink (newLink);
+  NS_LOG_DEBUG ("New link " << link.from << " <==> " << link.to << " / " << link.capacity << " with "
+                            << link.metric << " metric (" << link.delay << ", " << link.maxPackets
+                            << ", " << link.lossRate << ")");
+}
 
-      for (auto itr = m_function_list.begin (); itr != m_function_list.end (); itr++)
-        {
-          if ((*itr)->getName ().compare(func_name)==0)
-            {
-              if (!(InputParamList.compare ("null") == 0))
-                {
-                  NS_LOG_DEBUG("inputs.size() is "<<inputs.size());
-                  for (int i = 0; i < inputs.size (); i++)
-                    (*itr)->AddToInputList(inputs.at (i));
-                }
-            }
-        }
-    }
-        //   add this new function to compute nodes
-    for (uint32_t i = 1; i < m_inc_compute_nodes.size (); i++)
-        for (auto itr = m_function_list.begin (); itr != m_function_list.end (); ++itr)
-          {
-            m_inc_compute_nodes.at (i)->AddNewFunction (((*itr)->getName ()).toUri (), *itr);
-          }
+void
+IncNdnAnnotatedTopologyReader::OnFunction (uint32_t index, const IncTopologyFunction &function)
+{
+  Ptr<INC_Computation> t_func = CreateObject<INC_Computation> ();
+  t_func->setName (function.name);
+  t_func->SetCpu (function.cpu);
+  t_func->SetRam (function.ram);
+  t_func->SetRom (function.rom);
+  t_func->SetExecTime (function.execTime);
+  t_func->SetNumInstructions (function.numInstructions);
+  t_func->SetFuncSize (function.funcSize);
+  t_func->SetResultSize (function.resultSize);
+  t_func->SetRuntimeEnvironment (function.runtimes);
+  t_func->SetParamNumber (function.numInputs);
+  m_function_list.push_back (t_func);
+  NS_LOG_DEBUG ("New function "
+                << function.name << " cpu=" << function.cpu << " ram=" << function.ram
+                << " rom=" << function.rom << " execution_time=" << function.execTime
+                << " input_params=" << function.inputs << " function size=" << function.funcSize
+                << " result size=" << function.resultSize);
+}
 
+void
+IncNdnAnnotatedTopologyReader::OnPlacement (const IncFunctionPlacement &placement)
+{
+  m_initial_func_status[placement.node].push_back (placement.function);
+}
 
-  //do log
-  NS_LOG_INFO ("Annotated topology created with "
-               << (m_compute_nodecontainer.GetN () + m_consumer_nodecontainer.GetN ())
-               << " nodes and " << LinksSize () << " links and " << m_initial_func_status.size ()
-               << " function initial status setting");
-  topgen.close ();
-  ApplySettings ();
-  return std::make_pair (m_compute_nodecontainer, m_consumer_nodecontainer);
+void
+IncNdnAnnotatedTopologyReader::OnRequest (const IncConsumerRequest &request)
+{
+  NS_LOG_DEBUG ("InputParamList is " << request.inputs);
+  if (request.inputs == "null")
+    return;
+
+  std::vector<std::string> inputs;
+  boost::split (inputs, request.inputs, boost::is_any_of (","));
+  Ptr<INC_Computation> function = m_function_list[request.functionIndex];
+  for (uint32_t i = 0; i < inputs.size (); i++)
+    function->AddToInputList (inputs.at (i));
 }
 
 void
@@ -589,6 +590,7 @@ IncNdnAnnotatedTopologyReader::AssignIpv4Addresses (Ipv4Address base)
 NodeContainer
 IncNdnAnnotatedTopologyReader::Read (void)
 {
+  AssignStreams ();
   ifstream topgen;
   topgen.open (GetFileName ().c_str ());
   string curSection;
@@ -649,9 +651,7 @@ IncNdnAnnotatedTopologyReader::Read (void)
         node = CreateIncComputeNode (name, m_scale * longitude, -m_scale * latitude, systemId);
       else
         {
-          Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable> ();
-          node =
-              CreateIncComputeNode (name, var->GetValue (0, 200), var->GetValue (0, 200), systemId);
+          node = CreateIncComputeNode (name, m_randX->GetValue (), m_randY->GetValue (), systemId);
         }
 
       node->SetName (name);
@@ -748,7 +748,7 @@ IncNdnAnnotatedTopologyReader::Read (void)
         continue; // comments
       if (line == "initial function status")
         {
-          curSection == "initial function status";
+          curSection = "initial function status";
           break; // stop reading functions
         }
 
@@ -923,10 +923,12 @@ IncNdnAnnotatedTopologyReader::ApplySettings ()
 
   PointToPointHelper p2p;
 
+  uint32_t linkIndex = 0;
   BOOST_FOREACH (Link &link, m_linksList)
     {
       // cout << "Link: " << Findlink.GetFromNode () << ", " << link.GetToNode () << endl;
       string tmp;
+      uint32_t index = linkIndex++;
 
       ////////////////////////////////////////////////
       if (link.GetAttributeFailSafe ("MaxPackets", tmp))
@@ -1022,10 +1024,17 @@ IncNdnAnnotatedTopologyReader::ApplySettings ()
               factory.Set (attribute, StringValue (value));
             }
 
-          nd.Get (0)->SetAttribute ("ReceiveErrorModel",
-                                    PointerValue (factory.Create<ErrorModel> ()));
-          nd.Get (1)->SetAttribute ("ReceiveErrorModel",
-                                    PointerValue (factory.Create<ErrorModel> ()));
+          for (uint32_t side = 0; side < 2; side++)
+            {
+              Ptr<ErrorModel> errorModel = factory.Create<ErrorModel> ();
+              //losses of each link direction come from their own "failures" stream
+              int64_t stream = IncRandomStreams::Get ().GetStream ("failures", 2 * index + side);
+              if (Ptr<RateErrorModel> rate = DynamicCast<RateErrorModel> (errorModel))
+                rate->AssignStreams (stream);
+              else if (Ptr<BurstErrorModel> burst = DynamicCast<BurstErrorModel> (errorModel))
+                burst->AssignStreams (stream);
+              nd.Get (side)->SetAttribute ("ReceiveErrorModel", PointerValue (errorModel));
+            }
         }
     }
 }
@@ -37,6 +37,12 @@
 #include "ns3/node-container.h"
 #include "ns3/incSIM-module.h"
 #include "ns3/ndnSIM-module.h"
+#include "ns3/inc-topology-parser.hpp"
+#include "ns3/inc-topology-cache.hpp"
+#include "ns3/inc-scenario.hpp"
+#include "ns3/inc-random-streams.hpp"
+#include "ns3/inc-graph-partitioner.hpp"
+#include "ns3/nstime.h"
 #include <unordered_map>
 
 
@@ -47,8 +53,15 @@ namespace inc{
 /**
  * \brief This class is a utility class for reading topology file and initiate nodes, links and initial node function status
  *
+ * ReadTopology streams the file through IncTopologyParser and creates nodes and links while it is parsed. A precompiled
+ * IncTopologyCache is accepted as file as well and replayed without parsing. A scenario generated in memory is read
+ * without any file.
+ *
+ * For a distributed simulation, the topology is split into one partition per MPI rank before any node is created.
+ * The partition balances the expected load and minimises the traffic crossing partitions, links shorter than the
+ * minimum lookahead are never cut.
  */
-class IncNdnAnnotatedTopologyReader : public TopologyReader {
+class IncNdnAnnotatedTopologyReader : public TopologyReader, private IncTopologyParser::Handler {
 public:
   /**
    * \brief Constructor
@@ -72,9 +85,42 @@ public:
 
   virtual NodeContainer Read();
 
+  /**
+   * \brief Read the annotated incSIM topology (nodes, links, functions, initial function status and consumer inputs)
+   *
+   * Aborts with a "file:line: reason" message on the first malformed line.
+   *
+   * \return the containers of the compute nodes and of the consumer nodes
+   */
   std::pair<NodeContainer, NodeContainer>
   ReadTopology();
 
+  /**
+   * \brief Create the topology of an in-memory scenario, e.g. the one of DataGen
+   *
+   * \return the containers of the compute nodes and of the consumer nodes
+   */
+  std::pair<NodeContainer, NodeContainer>
+  ReadTopology(const IncScenario& scenario);
+
+  /**
+   * \brief Number of partitions (MPI ranks) the topology is split into, 0 (default) takes the size of the MPI world
+   */
+  void
+  SetPartitions(uint32_t partitions);
+
+  /**
+   * \brief Links of a shorter delay stay within one partition, zero delay links always do
+   */
+  void
+  SetMinLookahead(Time lookahead);
+
+  /**
+   * \brief Smallest delay of the links between partitions, Time::Max() if the topology was not split
+   */
+  Time
+  GetLookahead() const;
+
   /**
    * \brief Get nodes read by the reader
    */
@@ -198,6 +244,34 @@ protected:
   void
   ApplySettings();
 
+private:
+  void
+  AssignStreams();
+
+  std::pair<NodeContainer, NodeContainer>
+  FinishTopology();
+
+  uint32_t
+  GetPartitionCount() const;
+
+  void
+  PartitionScenario(const IncScenario& scenario);
+
+  virtual void
+  OnNode(uint32_t index, const IncTopologyNode& node);
+
+  virtual void
+  OnLink(const IncTopologyLink& link);
+
+  virtual void
+  OnFunction(uint32_t index, const IncTopologyFunction& function);
+
+  virtual void
+  OnPlacement(const IncFunctionPlacement& placement);
+
+  virtual void
+  OnRequest(const IncConsumerRequest& request);
+
 protected:
   std::string m_path;
   NodeContainer m_nodes;
@@ -221,6 +295,12 @@ private:
   std::vector<Ptr<Node>> m_inc_consumer_nodes;
   std::unordered_map<std::string,std::vector<std::string>> m_initial_func_status;
   std::vector<Ptr<INC_Computation>>  m_function_list;
+  std::vector<Ptr<Node>> m_read_nodes; ///< nodes of ReadTopology by parser index
+
+  uint32_t m_partitions;
+  Time m_minLookahead;
+  Time m_lookahead;
+  std::vector<uint32_t> m_systemIds; ///< partition of every node of ReadTopology by parser index
 
 };
       }//namespace inc
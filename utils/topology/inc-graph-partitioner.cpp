@@ -0,0 +1,444 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-graph-partitioner.hpp"
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <numeric>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncGraphPartitioner");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+const uint32_t NONE = std::numeric_limits<uint32_t>::max ();
+
+//coarsening stops at this many vertices per part
+const uint32_t COARSEST_PER_PART = 20;
+
+//initial partitions tried on the coarsest graph
+const uint32_t INITIAL_TRIES = 4;
+
+const uint32_t REFINE_PASSES = 10;
+
+uint32_t
+FindRoot (std::vector<uint32_t> &parent, uint32_t vertex)
+{
+  while (parent[vertex] != vertex)
+    {
+      parent[vertex] = parent[parent[vertex]];
+      vertex = parent[vertex];
+    }
+  return vertex;
+}
+
+} // namespace
+
+uint32_t
+IncGraphPartitioner::Graph::GetN () const
+{
+  return vertexWeights.size ();
+}
+
+IncGraphPartitioner::IncGraphPartitioner () : m_imbalance (0.05), m_seed (1), m_cutWeight (0)
+{
+}
+
+uint32_t
+IncGraphPartitioner::AddVertex (double weight)
+{
+  m_vertexWeights.push_back (weight);
+  return m_vertexWeights.size () - 1;
+}
+
+void
+IncGraphPartitioner::AddEdge (uint32_t from, uint32_t to, double weight)
+{
+  NS_ASSERT (from < m_vertexWeights.size () && to < m_vertexWeights.size ());
+  m_edges.push_back (std::make_pair (from, to));
+  m_edgeWeights.push_back (weight);
+}
+
+void
+IncGraphPartitioner::Join (uint32_t first, uint32_t second)
+{
+  NS_ASSERT (first < m_vertexWeights.size () && second < m_vertexWeights.size ());
+  m_joins.push_back (std::make_pair (first, second));
+}
+
+void
+IncGraphPartitioner::SetImbalance (double imbalance)
+{
+  NS_ABORT_MSG_IF (imbalance < 0, "imbalance must not be negative");
+  m_imbalance = imbalance;
+}
+
+void
+IncGraphPartitioner::SetSeed (uint32_t seed)
+{
+  m_seed = seed;
+}
+
+uint32_t
+IncGraphPartitioner::GetVertexCount () const
+{
+  return m_vertexWeights.size ();
+}
+
+double
+IncGraphPartitioner::GetCutWeight () const
+{
+  return m_cutWeight;
+}
+
+std::vector<uint32_t>
+IncGraphPartitioner::Partition (uint32_t parts)
+{
+  NS_ABORT_MSG_IF (parts == 0, "cannot partition into 0 parts");
+  uint32_t n = m_vertexWeights.size ();
+  m_cutWeight = 0;
+  m_random.seed (m_seed);
+
+  //joined vertices form one vertex of the finest level
+  std::vector<uint32_t> parent (n);
+  std::iota (parent.begin (), parent.end (), 0);
+  for (auto &join : m_joins)
+    parent[FindRoot (parent, join.first)] = FindRoot (parent, join.second);
+  std::vector<uint32_t> group (n, NONE);
+  uint32_t groups = 0;
+  for (uint32_t v = 0; v < n; v++)
+    {
+      uint32_t root = FindRoot (parent, v);
+      if (group[root] == NONE)
+        group[root] = groups++;
+      group[v] = group[root];
+    }
+  NS_ABORT_MSG_IF (groups < parts, "cannot split " << groups << " vertex groups into " << parts << " parts");
+  if (parts == 1)
+    return std::vector<uint32_t> (n, 0);
+
+  Graph input;
+  input.vertexWeights = m_vertexWeights;
+  input.offsets.assign (n + 1, 0);
+  for (auto &edge : m_edges)
+    if (edge.first != edge.second)
+      {
+        input.offsets[edge.first + 1]++;
+        input.offsets[edge.second + 1]++;
+      }
+  std::partial_sum (input.offsets.begin (), input.offsets.end (), input.offsets.begin ());
+  input.adjacency.resize (input.offsets[n]);
+  input.edgeWeights.resize (input.offsets[n]);
+  std::vector<uint32_t> fill (input.offsets.begin (), input.offsets.end () - 1);
+  for (size_t i = 0; i < m_edges.size (); i++)
+    {
+      uint32_t from = m_edges[i].first;
+      uint32_t to = m_edges[i].second;
+      if (from == to)
+        continue;
+      input.adjacency[fill[from]] = to;
+      input.edgeWeights[fill[from]++] = m_edgeWeights[i];
+      input.adjacency[fill[to]] = from;
+      input.edgeWeights[fill[to]++] = m_edgeWeights[i];
+    }
+
+  //coarsening
+  std::vector<Graph> levels;
+  std::vector<std::vector<uint32_t>> maps;
+  levels.push_back (Contract (input, group, groups));
+  double total = std::accumulate (m_vertexWeights.begin (), m_vertexWeights.end (), 0.0);
+  uint32_t coarsest = parts * COARSEST_PER_PART;
+  double maxMatched = 1.5 * total / coarsest;
+  while (levels.back ().GetN () > coarsest)
+    {
+      std::vector<uint32_t> map;
+      uint32_t coarseN = Match (levels.back (), maxMatched, map);
+      if (coarseN > 0.95 * levels.back ().GetN ())
+        break;
+      levels.push_back (Contract (levels.back (), map, coarseN));
+      maps.push_back (map);
+    }
+  double maxWeight = (1 + m_imbalance) * total / parts;
+  maxWeight = std::max (maxWeight, *std::max_element (levels.front ().vertexWeights.begin (),
+                                                      levels.front ().vertexWeights.end ()));
+  NS_LOG_DEBUG (n << " vertices coarsened to " << levels.back ().GetN () << " in " << levels.size ()
+                  << " levels");
+
+  //initial partition of the coarsest graph, the best of some tries
+  const Graph &top = levels.back ();
+  std::vector<uint32_t> part;
+  double best = std::numeric_limits<double>::infinity ();
+  for (uint32_t i = 0; i < INITIAL_TRIES; i++)
+    {
+      std::vector<uint32_t> candidate = GrowParts (top, parts, maxWeight, m_random () % top.GetN ());
+      Refine (top, parts, maxWeight, candidate);
+      double cut = CutWeight (top, candidate);
+      if (cut < best)
+        {
+          best = cut;
+          part.swap (candidate);
+        }
+    }
+
+  //uncoarsening
+  for (size_t level = maps.size (); level > 0; level--)
+    {
+      const std::vector<uint32_t> &map = maps[level - 1];
+      std::vector<uint32_t> finer (map.size ());
+      for (uint32_t v = 0; v < map.size (); v++)
+        finer[v] = part[map[v]];
+      part.swap (finer);
+      Refine (levels[level - 1], parts, maxWeight, part);
+    }
+  m_cutWeight = CutWeight (levels.front (), part);
+
+  std::vector<uint32_t> result (n);
+  for (uint32_t v = 0; v < n; v++)
+    result[v] = part[group[v]];
+  return result;
+}
+
+IncGraphPartitioner::Graph
+IncGraphPartitioner::Contract (const Graph &fine, const std::vector<uint32_t> &map, uint32_t coarseN)
+{
+  Graph coarse;
+  coarse.vertexWeights.assign (coarseN, 0);
+  std::vector<uint32_t> memberOffsets (coarseN + 1, 0);
+  for (uint32_t v = 0; v < fine.GetN (); v++)
+    {
+      coarse.vertexWeights[map[v]] += fine.vertexWeights[v];
+      memberOffsets[map[v] + 1]++;
+    }
+  std::partial_sum (memberOffsets.begin (), memberOffsets.end (), memberOffsets.begin ());
+  std::vector<uint32_t> members (fine.GetN ());
+  std::vector<uint32_t> fill (memberOffsets.begin (), memberOffsets.end () - 1);
+  for (uint32_t v = 0; v < fine.GetN (); v++)
+    members[fill[map[v]]++] = v;
+
+  //parallel edges merge through the position of the neighbour in the adjacency list of the current vertex
+  std::vector<uint32_t> owner (coarseN, NONE);
+  std::vector<uint32_t> position (coarseN);
+  coarse.offsets.push_back (0);
+  for (uint32_t c = 0; c < coarseN; c++)
+    {
+      for (uint32_t m = memberOffsets[c]; m < memberOffsets[c + 1]; m++)
+        {
+          uint32_t v = members[m];
+          for (uint32_t e = fine.offsets[v]; e < fine.offsets[v + 1]; e++)
+            {
+              uint32_t neighbour = map[fine.adjacency[e]];
+              if (neighbour == c)
+                continue;
+              if (owner[neighbour] != c)
+                {
+                  owner[neighbour] = c;
+                  position[neighbour] = coarse.adjacency.size ();
+                  coarse.adjacency.push_back (neighbour);
+                  coarse.edgeWeights.push_back (fine.edgeWeights[e]);
+                }
+              else
+                coarse.edgeWeights[position[neighbour]] += fine.edgeWeights[e];
+            }
+        }
+      coarse.offsets.push_back (coarse.adjacency.size ());
+    }
+  return coarse;
+}
+
+uint32_t
+IncGraphPartitioner::Match (const Graph &graph, double maxWeight, std::vector<uint32_t> &map)
+{
+  uint32_t n = graph.GetN ();
+  std::vector<uint32_t> order (n);
+  std::iota (order.begin (), order.end (), 0);
+  std::shuffle (order.begin (), order.end (), m_random);
+
+  //heavy edge matching: every vertex is merged with the unmatched neighbour it shares the heaviest edge with
+  map.assign (n, NONE);
+  uint32_t coarseN = 0;
+  for (uint32_t v : order)
+    {
+      if (map[v] != NONE)
+        continue;
+      uint32_t mate = NONE;
+      double heaviest = -1;
+      for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1]; e++)
+        {
+          uint32_t u = graph.adjacency[e];
+          if (map[u] == NONE && graph.edgeWeights[e] > heaviest &&
+              graph.vertexWeights[v] + graph.vertexWeights[u] <= maxWeight)
+            {
+              mate = u;
+              heaviest = graph.edgeWeights[e];
+            }
+        }
+      map[v] = coarseN;
+      if (mate != NONE)
+        map[mate] = coarseN;
+      coarseN++;
+    }
+  return coarseN;
+}
+
+std::vector<uint32_t>
+IncGraphPartitioner::GrowParts (const Graph &graph, uint32_t parts, double maxWeight, uint32_t start) const
+{
+  //every part grows breadth first from the frontier the previous one left, so that parts stay connected
+  uint32_t n = graph.GetN ();
+  std::vector<uint32_t> part (n, parts);
+  double remaining = std::accumulate (graph.vertexWeights.begin (), graph.vertexWeights.end (), 0.0);
+  uint32_t assigned = 0;
+  uint32_t cursor = 0;
+  std::deque<uint32_t> frontier (1, start);
+  for (uint32_t p = 0; p + 1 < parts; p++)
+    {
+      double target = std::min (remaining / (parts - p), maxWeight);
+      double weight = 0;
+      uint32_t size = 0;
+      while ((size == 0 || weight < target) && assigned < n - (parts - p - 1))
+        {
+          uint32_t v;
+          if (!frontier.empty ())
+            {
+              v = frontier.front ();
+              frontier.pop_front ();
+            }
+          else
+            {
+              while (part[cursor] != parts)
+                cursor++;
+              v = cursor;
+            }
+          if (part[v] != parts)
+            continue;
+          part[v] = p;
+          weight += graph.vertexWeights[v];
+          size++;
+          assigned++;
+          for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1]; e++)
+            if (part[graph.adjacency[e]] == parts)
+              frontier.push_back (graph.adjacency[e]);
+        }
+      remaining -= weight;
+    }
+  for (uint32_t v = 0; v < n; v++)
+    if (part[v] == parts)
+      part[v] = parts - 1;
+  return part;
+}
+
+void
+IncGraphPartitioner::Refine (const Graph &graph, uint32_t parts, double maxWeight, std::vector<uint32_t> &part)
+{
+  uint32_t n = graph.GetN ();
+  std::vector<double> weights (parts, 0);
+  std::vector<uint32_t> sizes (parts, 0);
+  for (uint32_t v = 0; v < n; v++)
+    {
+      weights[part[v]] += graph.vertexWeights[v];
+      sizes[part[v]]++;
+    }
+
+  //greedy boundary refinement: a vertex moves to the part it is connected to most, if that reduces the cut without
+  //overloading the part, keeps the cut and improves the balance, or relieves an overloaded part
+  std::vector<double> connection (parts, 0);
+  std::vector<uint32_t> touched;
+  for (uint32_t pass = 0; pass < REFINE_PASSES; pass++)
+    {
+      uint32_t moves = 0;
+      for (uint32_t v = 0; v < n; v++)
+        {
+          uint32_t from = part[v];
+          double weight = graph.vertexWeights[v];
+          if (sizes[from] == 1)
+            continue;
+          touched.clear ();
+          for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1]; e++)
+            {
+              uint32_t p = part[graph.adjacency[e]];
+              if (connection[p] == 0)
+                touched.push_back (p);
+              connection[p] += graph.edgeWeights[e];
+            }
+          bool overloaded = weights[from] > maxWeight;
+          uint32_t to = from;
+          double bestGain = overloaded ? -std::numeric_limits<double>::infinity () : 0;
+          for (uint32_t p : touched)
+            {
+              if (p == from || weights[p] + weight > maxWeight)
+                continue;
+              double gain = connection[p] - connection[from];
+              bool balanced = to == from ? weights[p] + weight < weights[from] : weights[p] < weights[to];
+              if (gain > bestGain || (gain == bestGain && balanced))
+                {
+                  to = p;
+                  bestGain = gain;
+                }
+            }
+          if (overloaded && to == from)
+            {
+              uint32_t lightest = std::min_element (weights.begin (), weights.end ()) - weights.begin ();
+              if (weights[lightest] + weight <= maxWeight)
+                to = lightest;
+            }
+          for (uint32_t p : touched)
+            connection[p] = 0;
+          if (to == from)
+            continue;
+          part[v] = to;
+          weights[from] -= weight;
+          weights[to] += weight;
+          sizes[from]--;
+          sizes[to]++;
+          moves++;
+        }
+      if (moves == 0)
+        break;
+    }
+}
+
+double
+IncGraphPartitioner::CutWeight (const Graph &graph, const std::vector<uint32_t> &part)
+{
+  double cut = 0;
+  for (uint32_t v = 0; v < graph.GetN (); v++)
+    for (uint32_t e = graph.offsets[v]; e < graph.offsets[v + 1]; e++)
+      if (part[graph.adjacency[e]] != part[v])
+        cut += graph.edgeWeights[e];
+  return cut / 2;
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
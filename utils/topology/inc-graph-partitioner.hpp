@@ -0,0 +1,140 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_GRAPH_PARTITIONER_H
+#define INC_GRAPH_PARTITIONER_H
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Multilevel k-way partitioning of a weighted undirected graph
+ *
+ * The graph is coarsened by heavy edge matching, the coarsest graph is partitioned by greedy graph growing and the
+ * partition is projected back level by level, each time improved by greedy boundary refinement. Parts are balanced by
+ * vertex weight within the imbalance and the weight of the cut edges is minimised. Vertices joined with Join always
+ * end up in the same part. Every step is linear in the size of the graph, the result only depends on the graph and
+ * the seed.
+ */
+class IncGraphPartitioner
+{
+public:
+  IncGraphPartitioner();
+
+  /**
+   * \return index of the vertex
+   */
+  uint32_t
+  AddVertex(double weight = 1);
+
+  /**
+   * \brief Add an edge, parallel edges add up
+   */
+  void
+  AddEdge(uint32_t from, uint32_t to, double weight = 1);
+
+  /**
+   * \brief Keep two vertices in the same part
+   */
+  void
+  Join(uint32_t first, uint32_t second);
+
+  /**
+   * \brief Allowed excess of the heaviest part over the average part weight, 0.05 by default
+   */
+  void
+  SetImbalance(double imbalance);
+
+  void
+  SetSeed(uint32_t seed);
+
+  uint32_t
+  GetVertexCount() const;
+
+  /**
+   * \brief Split the graph into parts, aborts if there are fewer vertex groups than parts
+   * \return part of every vertex
+   */
+  std::vector<uint32_t>
+  Partition(uint32_t parts);
+
+  /**
+   * \brief Weight of the edges cut by the last partition
+   */
+  double
+  GetCutWeight() const;
+
+private:
+  /**
+   * \brief Compressed adjacency lists without self loops, every edge is stored in both directions
+   */
+  struct Graph
+  {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> adjacency;
+    std::vector<double> edgeWeights;
+    std::vector<double> vertexWeights;
+
+    uint32_t
+    GetN() const;
+  };
+
+  static Graph
+  Contract(const Graph& fine, const std::vector<uint32_t>& map, uint32_t coarseN);
+
+  uint32_t
+  Match(const Graph& graph, double maxWeight, std::vector<uint32_t>& map);
+
+  std::vector<uint32_t>
+  GrowParts(const Graph& graph, uint32_t parts, double maxWeight, uint32_t start) const;
+
+  static void
+  Refine(const Graph& graph, uint32_t parts, double maxWeight, std::vector<uint32_t>& part);
+
+  static double
+  CutWeight(const Graph& graph, const std::vector<uint32_t>& part);
+
+private:
+  std::vector<double> m_vertexWeights;
+  std::vector<std::pair<uint32_t, uint32_t>> m_edges;
+  std::vector<double> m_edgeWeights;
+  std::vector<std::pair<uint32_t, uint32_t>> m_joins;
+  double m_imbalance;
+  uint32_t m_seed;
+  std::mt19937 m_random;
+  double m_cutWeight;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
@@ -0,0 +1,399 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-scenario.hpp"
+#include "inc-topology-cache.hpp"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncScenario");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+uint32_t
+CountInputs (const std::string &inputs)
+{
+  if (inputs == "null")
+    return 0;
+  uint32_t count = 0;
+  size_t start = 0;
+  while (start <= inputs.size ())
+    {
+      size_t end = inputs.find (',', start);
+      if (end == std::string::npos)
+        end = inputs.size ();
+      if (end > start)
+        count++;
+      start = end + 1;
+    }
+  return count;
+}
+
+//trailing empty optional columns are left out, like in the generated files
+void
+WriteOptional (std::ostream &os, const std::vector<const std::string *> &columns)
+{
+  size_t last = columns.size ();
+  while (last > 0 && columns[last - 1]->empty ())
+    last--;
+  for (size_t i = 0; i < last; i++)
+    os << "\t" << *columns[i];
+}
+
+} // namespace
+
+IncScenario::IncScenario ()
+{
+}
+
+uint32_t
+IncScenario::AddNode (const IncTopologyNode &node)
+{
+  uint32_t index = m_nodes.size ();
+  NS_ABORT_MSG_IF (!m_nodeIndex.emplace (node.name, index).second, "duplicate node " << node.name);
+  m_nodes.push_back (node);
+  return index;
+}
+
+void
+IncScenario::AddLink (const std::string &from, const std::string &to, const std::string &capacity,
+                      const std::string &metric, const std::string &delay, const std::string &maxPackets,
+                      const std::string &lossRate)
+{
+  IncTopologyLink link;
+  link.from = from;
+  link.to = to;
+  link.fromNode = FindNode (from);
+  NS_ABORT_MSG_IF (link.fromNode == IncTopologyParser::NOT_FOUND, "link from unknown node " << from);
+  link.toNode = FindNode (to);
+  NS_ABORT_MSG_IF (link.toNode == IncTopologyParser::NOT_FOUND, "link to unknown node " << to);
+
+  uint64_t low = std::min (link.fromNode, link.toNode);
+  uint64_t high = std::max (link.fromNode, link.toNode);
+  if (!m_processedLinks.insert ((high << 32) | low).second)
+    {
+      NS_LOG_DEBUG ("duplicated link " << from << " <==> " << to);
+      return;
+    }
+
+  link.capacity = capacity;
+  link.metric = metric;
+  link.delay = delay;
+  link.maxPackets = maxPackets;
+  link.lossRate = lossRate;
+  m_links.push_back (link);
+}
+
+uint32_t
+IncScenario::AddFunction (const IncTopologyFunction &function)
+{
+  uint32_t index = m_functions.size ();
+  NS_ABORT_MSG_IF (!m_functionIndex.emplace (function.name, index).second,
+                   "duplicate function " << function.name);
+  m_functions.push_back (function);
+  m_functions.back ().numInputs = CountInputs (function.inputs);
+  return index;
+}
+
+void
+IncScenario::AddPlacement (const std::string &node, const std::string &function)
+{
+  IncFunctionPlacement placement;
+  placement.node = node;
+  placement.function = function;
+  placement.nodeIndex = GetNode (node, IncTopologyNode::Compute, "function placed on");
+  placement.functionIndex = FindFunction (function);
+  NS_ABORT_MSG_IF (placement.functionIndex == IncTopologyParser::NOT_FOUND,
+                   "unknown function " << function << " placed on " << node);
+  m_placements.push_back (placement);
+}
+
+void
+IncScenario::AddRequest (const std::string &consumer, const std::string &function,
+                         const std::string &inputs, const std::string &frequency,
+                         const std::string &lifetime, const std::string &startTime,
+                         const std::string &stopTime)
+{
+  IncConsumerRequest request;
+  request.consumer = consumer;
+  request.function = function;
+  request.consumerIndex = GetNode (consumer, IncTopologyNode::Consumer, "request from");
+  request.functionIndex = FindFunction (function);
+  NS_ABORT_MSG_IF (request.functionIndex == IncTopologyParser::NOT_FOUND,
+                   "request for unknown function " << function);
+  request.inputs = inputs;
+  request.frequency = frequency;
+  request.lifetime = lifetime;
+  request.startTime = startTime;
+  request.stopTime = stopTime;
+  m_requests.push_back (request);
+}
+
+void
+IncScenario::AddData (const std::string &consumer, const std::string &data, const std::string &size,
+                      const std::string &freshness)
+{
+  IncProvidedData provided;
+  provided.consumer = consumer;
+  provided.consumerIndex = GetNode (consumer, IncTopologyNode::Consumer, "data provided by");
+  provided.data = data;
+  provided.size = size;
+  provided.freshness = freshness;
+  m_data.push_back (provided);
+}
+
+uint32_t
+IncScenario::GetNode (const std::string &name, IncTopologyNode::Type type, const char *role) const
+{
+  uint32_t index = FindNode (name);
+  NS_ABORT_MSG_IF (index == IncTopologyParser::NOT_FOUND, role << " unknown node " << name);
+  NS_ABORT_MSG_IF (m_nodes[index].type != type,
+                   role << " " << name << ", which is not a "
+                        << (type == IncTopologyNode::Compute ? "compute node" : "consumer"));
+  return index;
+}
+
+void
+IncScenario::Clear ()
+{
+  m_nodes.clear ();
+  m_links.clear ();
+  m_functions.clear ();
+  m_placements.clear ();
+  m_requests.clear ();
+  m_data.clear ();
+  m_nodeIndex.clear ();
+  m_functionIndex.clear ();
+  m_processedLinks.clear ();
+}
+
+void
+IncScenario::Replay (IncTopologyParser::Handler &handler) const
+{
+  for (uint32_t i = 0; i < m_nodes.size (); i++)
+    handler.OnNode (i, m_nodes[i]);
+  for (auto &link : m_links)
+    handler.OnLink (link);
+  for (uint32_t i = 0; i < m_functions.size (); i++)
+    handler.OnFunction (i, m_functions[i]);
+  for (auto &placement : m_placements)
+    handler.OnPlacement (placement);
+  for (auto &request : m_requests)
+    handler.OnRequest (request);
+  for (auto &data : m_data)
+    handler.OnData (data);
+}
+
+bool
+IncScenario::Load (const std::string &file, std::string &error)
+{
+  Clear ();
+  if (IncTopologyCache::IsCache (file))
+    {
+      IncTopologyCache cache;
+      if (!cache.Open (file) || !cache.Replay (*this))
+        {
+          error = cache.GetError ();
+          return false;
+        }
+    }
+  else
+    {
+      IncTopologyParser parser (*this);
+      if (!parser.Parse (file))
+        {
+          error = parser.GetError ();
+          return false;
+        }
+    }
+  NS_LOG_INFO (file << ": " << m_nodes.size () << " nodes, " << m_links.size () << " links, "
+                    << m_functions.size () << " functions, " << m_requests.size () << " requests");
+  return true;
+}
+
+bool
+IncScenario::Save (const std::string &file) const
+{
+  std::ofstream os (file.c_str ());
+  if (!os.is_open ())
+    {
+      NS_LOG_ERROR ("Cannot open file " << file << " for writing");
+      return false;
+    }
+  Write (os);
+  return os.good ();
+}
+
+void
+IncScenario::Write (std::ostream &os) const
+{
+  //enough digits that generated values come back unchanged
+  std::streamsize precision = os.precision (15);
+
+  os << "router\n";
+  for (auto &node : m_nodes)
+    {
+      os << node.name << "\t" << node.latitude << "\t" << node.longitude;
+      if (node.type == IncTopologyNode::Compute)
+        os << "\t" << node.cores << "\t" << node.clockSpeed << "\t" << node.ram << "\t" << node.rom << "\t"
+           << node.queue << "\t" << node.links << "\t" << node.runtimes;
+      else
+        os << "\tNaN\tNaN\tNaN\tNaN\tNaN\tNaN";
+      os << "\n";
+    }
+
+  os << "\nlinks\n";
+  for (auto &link : m_links)
+    {
+      os << link.from << "\t" << link.to << "\t" << link.capacity << "\t" << link.metric;
+      WriteOptional (os, {&link.delay, &link.maxPackets, &link.lossRate});
+      os << "\n";
+    }
+
+  os << "\nfunctions\n";
+  for (auto &function : m_functions)
+    {
+      std::string runtimes;
+      for (auto &runtime : function.runtimes)
+        runtimes += (runtimes.empty () ? "" : ";") + runtime;
+      os << function.name << "\t" << function.inputs << "\t" << runtimes << "\t" << function.ram << "\t"
+         << function.rom << "\t" << function.cpu << "\t" << function.execTime << "\t"
+         << function.numInstructions << "\t" << function.funcSize << "\t" << function.resultSize << "\n";
+    }
+
+  os << "\ninitial function status\n";
+  for (auto &placement : m_placements)
+    os << placement.node << "\t" << placement.function << "\n";
+
+  os << "\nconsumer section\n";
+  for (auto &request : m_requests)
+    os << request.consumer << "\t" << request.function << "\t" << request.inputs << "\t" << request.frequency
+       << "\t" << request.lifetime << "\t" << request.startTime << "\t" << request.stopTime << "\n";
+
+  os << "\ninitial data section\n";
+  for (auto &data : m_data)
+    os << data.consumer << "\t" << data.data << "\t" << data.size << "\t" << data.freshness << "\n";
+
+  os.precision (precision);
+}
+
+uint32_t
+IncScenario::FindNode (const std::string &name) const
+{
+  auto it = m_nodeIndex.find (name);
+  return it == m_nodeIndex.end () ? IncTopologyParser::NOT_FOUND : it->second;
+}
+
+uint32_t
+IncScenario::FindFunction (const std::string &name) const
+{
+  auto it = m_functionIndex.find (name);
+  return it == m_functionIndex.end () ? IncTopologyParser::NOT_FOUND : it->second;
+}
+
+const std::vector<IncTopologyNode> &
+IncScenario::GetNodes () const
+{
+  return m_nodes;
+}
+
+const std::vector<IncTopologyLink> &
+IncScenario::GetLinks () const
+{
+  return m_links;
+}
+
+const std::vector<IncTopologyFunction> &
+IncScenario::GetFunctions () const
+{
+  return m_functions;
+}
+
+const std::vector<IncFunctionPlacement> &
+IncScenario::GetPlacements () const
+{
+  return m_placements;
+}
+
+const std::vector<IncConsumerRequest> &
+IncScenario::GetRequests () const
+{
+  return m_requests;
+}
+
+const std::vector<IncProvidedData> &
+IncScenario::GetData () const
+{
+  return m_data;
+}
+
+void
+IncScenario::OnNode (uint32_t index, const IncTopologyNode &node)
+{
+  AddNode (node);
+}
+
+void
+IncScenario::OnLink (const IncTopologyLink &link)
+{
+  AddLink (link.from, link.to, link.capacity, link.metric, link.delay, link.maxPackets, link.lossRate);
+}
+
+void
+IncScenario::OnFunction (uint32_t index, const IncTopologyFunction &function)
+{
+  AddFunction (function);
+}
+
+void
+IncScenario::OnPlacement (const IncFunctionPlacement &placement)
+{
+  AddPlacement (placement.node, placement.function);
+}
+
+void
+IncScenario::OnRequest (const IncConsumerRequest &request)
+{
+  AddRequest (request.consumer, request.function, request.inputs, request.frequency, request.lifetime,
+              request.startTime, request.stopTime);
+}
+
+void
+IncScenario::OnData (const IncProvidedData &data)
+{
+  AddData (data.consumer, data.data, data.size, data.freshness);
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
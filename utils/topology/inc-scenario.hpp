@@ -0,0 +1,187 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_SCENARIO_H
+#define INC_SCENARIO_H
+
+#include "ns3/inc-topology-parser.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief In-memory scenario: topology, functions, initial function placement, consumer workload and provided data
+ *
+ * DataGen builds a scenario record by record with the Add methods. Names are resolved when a record is added, so a
+ * scenario is always as consistent as a successfully parsed topology file. IncNdnAnnotatedTopologyReader and
+ * parserNodeInfo consume it through Replay, which hands the records to an IncTopologyParser::Handler in the order
+ * the text parser would. Save writes the annotated text format, Load reads it back from a text file or a topology
+ * cache.
+ */
+class IncScenario : private IncTopologyParser::Handler
+{
+public:
+  IncScenario();
+
+  /**
+   * \brief Add a node, aborts if a node of that name exists
+   * \return index of the node
+   */
+  uint32_t
+  AddNode(const IncTopologyNode& node);
+
+  /**
+   * \brief Add a link between two known nodes, a duplicated or reverse link is ignored like in the text format
+   */
+  void
+  AddLink(const std::string& from, const std::string& to, const std::string& capacity, const std::string& metric,
+          const std::string& delay = "", const std::string& maxPackets = "", const std::string& lossRate = "");
+
+  /**
+   * \brief Add a function, numInputs is derived from its input signature
+   * \return index of the function
+   */
+  uint32_t
+  AddFunction(const IncTopologyFunction& function);
+
+  /**
+   * \brief Initially enable a function on a compute node
+   */
+  void
+  AddPlacement(const std::string& node, const std::string& function);
+
+  /**
+   * \brief Let a consumer request a function
+   */
+  void
+  AddRequest(const std::string& consumer, const std::string& function, const std::string& inputs,
+             const std::string& frequency, const std::string& lifetime, const std::string& startTime,
+             const std::string& stopTime);
+
+  /**
+   * \brief Let a consumer provide a data
+   */
+  void
+  AddData(const std::string& consumer, const std::string& data, const std::string& size,
+          const std::string& freshness);
+
+  void
+  Clear();
+
+  /**
+   * \brief Hand all records to the handler
+   */
+  void
+  Replay(IncTopologyParser::Handler& handler) const;
+
+  /**
+   * \brief Replace the scenario by an annotated topology file or a topology cache
+   *
+   * \return false with the reason in error, if the file cannot be read
+   */
+  bool
+  Load(const std::string& file, std::string& error);
+
+  /**
+   * \brief Write the scenario in the annotated topology format
+   */
+  bool
+  Save(const std::string& file) const;
+
+  void
+  Write(std::ostream& os) const;
+
+  uint32_t
+  FindNode(const std::string& name) const;
+
+  uint32_t
+  FindFunction(const std::string& name) const;
+
+  const std::vector<IncTopologyNode>&
+  GetNodes() const;
+
+  const std::vector<IncTopologyLink>&
+  GetLinks() const;
+
+  const std::vector<IncTopologyFunction>&
+  GetFunctions() const;
+
+  const std::vector<IncFunctionPlacement>&
+  GetPlacements() const;
+
+  const std::vector<IncConsumerRequest>&
+  GetRequests() const;
+
+  const std::vector<IncProvidedData>&
+  GetData() const;
+
+private:
+  virtual void
+  OnNode(uint32_t index, const IncTopologyNode& node);
+
+  virtual void
+  OnLink(const IncTopologyLink& link);
+
+  virtual void
+  OnFunction(uint32_t index, const IncTopologyFunction& function);
+
+  virtual void
+  OnPlacement(const IncFunctionPlacement& placement);
+
+  virtual void
+  OnRequest(const IncConsumerRequest& request);
+
+  virtual void
+  OnData(const IncProvidedData& data);
+
+  uint32_t
+  GetNode(const std::string& name, IncTopologyNode::Type type, const char* role) const;
+
+private:
+  std::vector<IncTopologyNode> m_nodes;
+  std::vector<IncTopologyLink> m_links;
+  std::vector<IncTopologyFunction> m_functions;
+  std::vector<IncFunctionPlacement> m_placements;
+  std::vector<IncConsumerRequest> m_requests;
+  std::vector<IncProvidedData> m_data;
+
+  std::unordered_map<std::string, uint32_t> m_nodeIndex;
+  std::unordered_map<std::string, uint32_t> m_functionIndex;
+  std::unordered_set<uint64_t> m_processedLinks; ///< unordered endpoint pairs, to drop duplicated links
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
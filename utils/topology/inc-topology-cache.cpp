@@ -0,0 +1,671 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-topology-cache.hpp"
+
+#include "ns3/log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncTopologyCache");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+const char MAGIC[8] = {'I', 'N', 'C', 'T', 'O', 'P', 'O', '\0'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+enum Table
+{
+  NODES,
+  LINKS,
+  FUNCTIONS,
+  PLACEMENTS,
+  REQUESTS,
+  DATA,
+  POOL,
+  TABLES
+};
+
+/**
+ * The file starts with the header, followed by the record tables and the string pool, each 8 byte aligned.
+ * count is the number of records, for the pool its size in bytes.
+ */
+struct Header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint64_t key;
+  uint64_t fileSize;
+  uint64_t offset[TABLES];
+  uint64_t count[TABLES];
+};
+
+struct StringRef
+{
+  uint32_t offset;
+  uint32_t size;
+};
+
+struct NodeRecord
+{
+  double latitude;
+  double longitude;
+  uint32_t type;
+  StringRef name;
+  uint32_t cores;
+  uint32_t clockSpeed;
+  uint32_t ram;
+  uint32_t rom;
+  uint32_t queue;
+  StringRef links;
+  StringRef runtimes;
+};
+
+struct LinkRecord
+{
+  uint32_t from;
+  uint32_t to;
+  StringRef capacity;
+  StringRef metric;
+  StringRef delay;
+  StringRef maxPackets;
+  StringRef lossRate;
+};
+
+struct FunctionRecord
+{
+  double execTime;
+  StringRef name;
+  StringRef inputs;
+  StringRef runtimes; ///< joined by ';'
+  uint32_t ram;
+  uint32_t rom;
+  uint32_t cpu;
+  uint32_t numInstructions;
+  uint32_t funcSize;
+  uint32_t resultSize;
+  uint32_t numInputs;
+  uint32_t reserved;
+};
+
+struct PlacementRecord
+{
+  uint32_t node;
+  uint32_t function;
+};
+
+struct RequestRecord
+{
+  uint32_t consumer;
+  uint32_t function;
+  StringRef inputs;
+  StringRef frequency;
+  StringRef lifetime;
+  StringRef startTime;
+  StringRef stopTime;
+};
+
+struct DataRecord
+{
+  uint32_t consumer;
+  uint32_t reserved;
+  StringRef data;
+  StringRef size;
+  StringRef freshness;
+};
+
+const size_t RECORD_SIZE[TABLES] = {sizeof (NodeRecord),      sizeof (LinkRecord),
+                                    sizeof (FunctionRecord),  sizeof (PlacementRecord),
+                                    sizeof (RequestRecord),   sizeof (DataRecord),
+                                    1};
+
+uint64_t
+Align (uint64_t offset)
+{
+  return (offset + 7) & ~uint64_t (7);
+}
+
+/**
+ * \brief Collects the records of the text parser and writes them as cache
+ */
+class CacheWriter : public IncTopologyParser::Handler
+{
+public:
+  virtual void
+  OnNode (uint32_t index, const IncTopologyNode &node)
+  {
+    NodeRecord record = NodeRecord ();
+    record.latitude = node.latitude;
+    record.longitude = node.longitude;
+    record.type = node.type;
+    record.name = Intern (node.name);
+    record.cores = node.cores;
+    record.clockSpeed = node.clockSpeed;
+    record.ram = node.ram;
+    record.rom = node.rom;
+    record.queue = node.queue;
+    record.links = Intern (node.links);
+    record.runtimes = Intern (node.runtimes);
+    m_nodes.push_back (record);
+  }
+
+  virtual void
+  OnLink (const IncTopologyLink &link)
+  {
+    LinkRecord record = LinkRecord ();
+    record.from = link.fromNode;
+    record.to = link.toNode;
+    record.capacity = Intern (link.capacity);
+    record.metric = Intern (link.metric);
+    record.delay = Intern (link.delay);
+    record.maxPackets = Intern (link.maxPackets);
+    record.lossRate = Intern (link.lossRate);
+    m_links.push_back (record);
+  }
+
+  virtual void
+  OnFunction (uint32_t index, const IncTopologyFunction &function)
+  {
+    std::string runtimes;
+    for (auto &runtime : function.runtimes)
+      runtimes.append (runtime + ";");
+
+    FunctionRecord record = FunctionRecord ();
+    record.execTime = function.execTime;
+    record.name = Intern (function.name);
+    record.inputs = Intern (function.inputs);
+    record.runtimes = Intern (runtimes);
+    record.ram = function.ram;
+    record.rom = function.rom;
+    record.cpu = function.cpu;
+    record.numInstructions = function.numInstructions;
+    record.funcSize = function.funcSize;
+    record.resultSize = function.resultSize;
+    record.numInputs = function.numInputs;
+    m_functions.push_back (record);
+  }
+
+  virtual void
+  OnPlacement (const IncFunctionPlacement &placement)
+  {
+    PlacementRecord record;
+    record.node = placement.nodeIndex;
+    record.function = placement.functionIndex;
+    m_placements.push_back (record);
+  }
+
+  virtual void
+  OnRequest (const IncConsumerRequest &request)
+  {
+    RequestRecord record = RequestRecord ();
+    record.consumer = request.consumerIndex;
+    record.function = request.functionIndex;
+    record.inputs = Intern (request.inputs);
+    record.frequency = Intern (request.frequency);
+    record.lifetime = Intern (request.lifetime);
+    record.startTime = Intern (request.startTime);
+    record.stopTime = Intern (request.stopTime);
+    m_requests.push_back (record);
+  }
+
+  virtual void
+  OnData (const IncProvidedData &data)
+  {
+    DataRecord record = DataRecord ();
+    record.consumer = data.consumerIndex;
+    record.data = Intern (data.data);
+    record.size = Intern (data.size);
+    record.freshness = Intern (data.freshness);
+    m_data.push_back (record);
+  }
+
+  bool
+  Write (const std::string &file, uint64_t key, std::string &error)
+  {
+    Header header = Header ();
+    std::memcpy (header.magic, MAGIC, sizeof (MAGIC));
+    header.version = IncTopologyCache::VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.key = key;
+    header.count[NODES] = m_nodes.size ();
+    header.count[LINKS] = m_links.size ();
+    header.count[FUNCTIONS] = m_functions.size ();
+    header.count[PLACEMENTS] = m_placements.size ();
+    header.count[REQUESTS] = m_requests.size ();
+    header.count[DATA] = m_data.size ();
+    header.count[POOL] = m_pool.size ();
+    const char *tables[TABLES] = {
+        reinterpret_cast<const char *> (m_nodes.data ()),
+        reinterpret_cast<const char *> (m_links.data ()),
+        reinterpret_cast<const char *> (m_functions.data ()),
+        reinterpret_cast<const char *> (m_placements.data ()),
+        reinterpret_cast<const char *> (m_requests.data ()),
+        reinterpret_cast<const char *> (m_data.data ()),
+        m_pool.data ()};
+
+    uint64_t offset = Align (sizeof (Header));
+    for (int table = 0; table < TABLES; table++)
+      {
+        header.offset[table] = offset;
+        offset = Align (offset + header.count[table] * RECORD_SIZE[table]);
+      }
+    header.fileSize = offset;
+
+    //write next to the cache and rename, concurrent runs of a sweep may compile the same cache
+    std::string temporary = file + ".tmp" + std::to_string (getpid ());
+    std::ofstream out (temporary.c_str (), std::ios::binary | std::ios::trunc);
+    if (!out.is_open ())
+      {
+        error = "Cannot open file " + temporary + " for writing";
+        return false;
+      }
+    const char padding[8] = {0};
+    out.write (reinterpret_cast<const char *> (&header), sizeof (Header));
+    out.write (padding, Align (sizeof (Header)) - sizeof (Header));
+    for (int table = 0; table < TABLES; table++)
+      {
+        uint64_t size = header.count[table] * RECORD_SIZE[table];
+        out.write (tables[table], size);
+        out.write (padding, Align (size) - size);
+      }
+    out.close ();
+    if (!out || std::rename (temporary.c_str (), file.c_str ()) != 0)
+      {
+        std::remove (temporary.c_str ());
+        error = "Cannot write topology cache " + file;
+        return false;
+      }
+    NS_LOG_INFO ("Topology cache " << file << " written with " << m_nodes.size () << " nodes, "
+                                   << m_links.size () << " links, " << m_requests.size ()
+                                   << " requests and " << m_pool.size () << " bytes of strings");
+    return true;
+  }
+
+private:
+  StringRef
+  Intern (const std::string &value)
+  {
+    auto it = m_strings.find (value);
+    if (it != m_strings.end ())
+      return it->second;
+    StringRef ref;
+    ref.offset = m_pool.size ();
+    ref.size = value.size ();
+    m_pool.append (value);
+    m_strings.emplace (value, ref);
+    return ref;
+  }
+
+private:
+  std::vector<NodeRecord> m_nodes;
+  std::vector<LinkRecord> m_links;
+  std::vector<FunctionRecord> m_functions;
+  std::vector<PlacementRecord> m_placements;
+  std::vector<RequestRecord> m_requests;
+  std::vector<DataRecord> m_data;
+  std::string m_pool;
+  std::unordered_map<std::string, StringRef> m_strings;
+};
+
+} // namespace
+
+const uint32_t IncTopologyCache::VERSION = 1;
+
+IncTopologyCache::IncTopologyCache () : m_data (0), m_size (0)
+{
+}
+
+IncTopologyCache::~IncTopologyCache ()
+{
+  Close ();
+}
+
+uint64_t
+IncTopologyCache::HashKey (const std::string &parameters)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : parameters)
+    {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+    }
+  return hash;
+}
+
+bool
+IncTopologyCache::IsCache (const std::string &file)
+{
+  char magic[sizeof (MAGIC)];
+  std::ifstream in (file.c_str (), std::ios::binary);
+  return in.read (magic, sizeof (magic)) && std::memcmp (magic, MAGIC, sizeof (MAGIC)) == 0;
+}
+
+bool
+IncTopologyCache::Compile (const std::string &textFile, const std::string &cacheFile, uint64_t key,
+                           std::string &error)
+{
+  CacheWriter writer;
+  IncTopologyParser parser (writer);
+  if (!parser.Parse (textFile))
+    {
+      error = parser.GetError ();
+      return false;
+    }
+  return writer.Write (cacheFile, key, error);
+}
+
+bool
+IncTopologyCache::Compile (const IncScenario &scenario, const std::string &cacheFile, uint64_t key,
+                           std::string &error)
+{
+  CacheWriter writer;
+  scenario.Replay (writer);
+  return writer.Write (cacheFile, key, error);
+}
+
+bool
+IncTopologyCache::Open (const std::string &file)
+{
+  Close ();
+  m_file = file;
+  int fd = open (file.c_str (), O_RDONLY);
+  if (fd < 0)
+    return Fail ("Cannot open file " + file + " for reading");
+  struct stat status;
+  if (fstat (fd, &status) != 0 || status.st_size < (off_t) sizeof (Header))
+    {
+      close (fd);
+      return Fail ("file too small for a topology cache");
+    }
+  void *data = mmap (0, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (data == MAP_FAILED)
+    return Fail ("cannot map the file");
+  m_data = static_cast<const uint8_t *> (data);
+  m_size = status.st_size;
+
+  const Header *header = reinterpret_cast<const Header *> (m_data);
+  bool valid = std::memcmp (header->magic, MAGIC, sizeof (MAGIC)) == 0;
+  if (!valid || header->version != VERSION || header->byteOrder != BYTE_ORDER_MARK)
+    valid = Fail ("not a topology cache of version " + std::to_string (VERSION) + " and this byte order");
+  else if (header->fileSize != m_size)
+    valid = Fail ("truncated topology cache");
+  for (int table = 0; valid && table < TABLES; table++)
+    {
+      if (header->offset[table] % 8 != 0 || header->offset[table] > m_size ||
+          header->count[table] > (m_size - header->offset[table]) / RECORD_SIZE[table])
+        valid = Fail ("corrupt table offsets");
+    }
+  if (!valid)
+    {
+      Close ();
+      return false;
+    }
+  NS_LOG_INFO ("Topology cache " << file << " opened, key " << header->key);
+  return true;
+}
+
+void
+IncTopologyCache::Close ()
+{
+  if (m_data != 0)
+    munmap (const_cast<uint8_t *> (m_data), m_size);
+  m_data = 0;
+  m_size = 0;
+}
+
+namespace {
+
+/**
+ * \brief Bounds checked view on the tables of a mapped cache
+ */
+class CacheReader
+{
+public:
+  CacheReader (const uint8_t *data) : m_data (data), m_valid (true)
+  {
+    m_header = reinterpret_cast<const Header *> (data);
+    m_pool = reinterpret_cast<const char *> (data + m_header->offset[POOL]);
+  }
+
+  template <class RECORD>
+  const RECORD *
+  Records (Table table) const
+  {
+    return reinterpret_cast<const RECORD *> (m_data + m_header->offset[table]);
+  }
+
+  uint32_t
+  Count (Table table) const
+  {
+    return m_header->count[table];
+  }
+
+  std::string
+  String (const StringRef &ref)
+  {
+    if (ref.offset > m_header->count[POOL] || ref.size > m_header->count[POOL] - ref.offset)
+      {
+        m_valid = false;
+        return std::string ();
+      }
+    return std::string (m_pool + ref.offset, ref.size);
+  }
+
+  bool
+  Check (uint32_t index, Table table)
+  {
+    if (index >= Count (table))
+      m_valid = false;
+    return m_valid;
+  }
+
+  bool
+  IsValid () const
+  {
+    return m_valid;
+  }
+
+private:
+  const uint8_t *m_data;
+  const Header *m_header;
+  const char *m_pool;
+  bool m_valid;
+};
+
+} // namespace
+
+bool
+IncTopologyCache::Replay (IncTopologyParser::Handler &handler) const
+{
+  if (m_data == 0)
+    return Fail ("topology cache is not open");
+  CacheReader reader (m_data);
+
+  const NodeRecord *nodes = reader.Records<NodeRecord> (NODES);
+  for (uint32_t i = 0; i < reader.Count (NODES); i++)
+    {
+      IncTopologyNode node;
+      node.type = nodes[i].type == IncTopologyNode::Consumer ? IncTopologyNode::Consumer
+                                                             : IncTopologyNode::Compute;
+      node.name = reader.String (nodes[i].name);
+      node.latitude = nodes[i].latitude;
+      node.longitude = nodes[i].longitude;
+      node.cores = nodes[i].cores;
+      node.clockSpeed = nodes[i].clockSpeed;
+      node.ram = nodes[i].ram;
+      node.rom = nodes[i].rom;
+      node.queue = nodes[i].queue;
+      node.links = reader.String (nodes[i].links);
+      node.runtimes = reader.String (nodes[i].runtimes);
+      if (!reader.IsValid ())
+        return Fail ("corrupt node record " + std::to_string (i));
+      handler.OnNode (i, node);
+    }
+
+  const LinkRecord *links = reader.Records<LinkRecord> (LINKS);
+  for (uint32_t i = 0; i < reader.Count (LINKS); i++)
+    {
+      IncTopologyLink link;
+      if (!reader.Check (links[i].from, NODES) || !reader.Check (links[i].to, NODES))
+        return Fail ("corrupt link record " + std::to_string (i));
+      link.fromNode = links[i].from;
+      link.toNode = links[i].to;
+      link.from = reader.String (nodes[link.fromNode].name);
+      link.to = reader.String (nodes[link.toNode].name);
+      link.capacity = reader.String (links[i].capacity);
+      link.metric = reader.String (links[i].metric);
+      link.delay = reader.String (links[i].delay);
+      link.maxPackets = reader.String (links[i].maxPackets);
+      link.lossRate = reader.String (links[i].lossRate);
+      if (!reader.IsValid ())
+        return Fail ("corrupt link record " + std::to_string (i));
+      handler.OnLink (link);
+    }
+
+  const FunctionRecord *functions = reader.Records<FunctionRecord> (FUNCTIONS);
+  for (uint32_t i = 0; i < reader.Count (FUNCTIONS); i++)
+    {
+      IncTopologyFunction function;
+      function.name = reader.String (functions[i].name);
+      function.inputs = reader.String (functions[i].inputs);
+      std::string runtimes = reader.String (functions[i].runtimes);
+      for (size_t start = 0, end; (end = runtimes.find (';', start)) != std::string::npos; start = end + 1)
+        function.runtimes.push_back (runtimes.substr (start, end - start));
+      function.ram = functions[i].ram;
+      function.rom = functions[i].rom;
+      function.cpu = functions[i].cpu;
+      function.execTime = functions[i].execTime;
+      function.numInstructions = functions[i].numInstructions;
+      function.funcSize = functions[i].funcSize;
+      function.resultSize = functions[i].resultSize;
+      function.numInputs = functions[i].numInputs;
+      if (!reader.IsValid ())
+        return Fail ("corrupt function record " + std::to_string (i));
+      handler.OnFunction (i, function);
+    }
+
+  const PlacementRecord *placements = reader.Records<PlacementRecord> (PLACEMENTS);
+  for (uint32_t i = 0; i < reader.Count (PLACEMENTS); i++)
+    {
+      IncFunctionPlacement placement;
+      if (!reader.Check (placements[i].node, NODES) ||
+          !reader.Check (placements[i].function, FUNCTIONS))
+        return Fail ("corrupt placement record " + std::to_string (i));
+      placement.nodeIndex = placements[i].node;
+      placement.functionIndex = placements[i].function;
+      placement.node = reader.String (nodes[placement.nodeIndex].name);
+      placement.function = reader.String (functions[placement.functionIndex].name);
+      handler.OnPlacement (placement);
+    }
+
+  const RequestRecord *requests = reader.Records<RequestRecord> (REQUESTS);
+  for (uint32_t i = 0; i < reader.Count (REQUESTS); i++)
+    {
+      IncConsumerRequest request;
+      if (!reader.Check (requests[i].consumer, NODES) ||
+          !reader.Check (requests[i].function, FUNCTIONS))
+        return Fail ("corrupt request record " + std::to_string (i));
+      request.consumerIndex = requests[i].consumer;
+      request.functionIndex = requests[i].function;
+      request.consumer = reader.String (nodes[request.consumerIndex].name);
+      request.function = reader.String (functions[request.functionIndex].name);
+      request.inputs = reader.String (requests[i].inputs);
+      request.frequency = reader.String (requests[i].frequency);
+      request.lifetime = reader.String (requests[i].lifetime);
+      request.startTime = reader.String (requests[i].startTime);
+      request.stopTime = reader.String (requests[i].stopTime);
+      if (!reader.IsValid ())
+        return Fail ("corrupt request record " + std::to_string (i));
+      handler.OnRequest (request);
+    }
+
+  const DataRecord *data = reader.Records<DataRecord> (DATA);
+  for (uint32_t i = 0; i < reader.Count (DATA); i++)
+    {
+      IncProvidedData provided;
+      if (!reader.Check (data[i].consumer, NODES))
+        return Fail ("corrupt data record " + std::to_string (i));
+      provided.consumerIndex = data[i].consumer;
+      provided.consumer = reader.String (nodes[provided.consumerIndex].name);
+      provided.data = reader.String (data[i].data);
+      provided.size = reader.String (data[i].size);
+      provided.freshness = reader.String (data[i].freshness);
+      if (!reader.IsValid ())
+        return Fail ("corrupt data record " + std::to_string (i));
+      handler.OnData (provided);
+    }
+  return true;
+}
+
+uint64_t
+IncTopologyCache::GetKey () const
+{
+  return m_data == 0 ? 0 : reinterpret_cast<const Header *> (m_data)->key;
+}
+
+uint32_t
+IncTopologyCache::GetNodeCount () const
+{
+  return m_data == 0 ? 0 : reinterpret_cast<const Header *> (m_data)->count[NODES];
+}
+
+uint32_t
+IncTopologyCache::GetFunctionCount () const
+{
+  return m_data == 0 ? 0 : reinterpret_cast<const Header *> (m_data)->count[FUNCTIONS];
+}
+
+const std::string &
+IncTopologyCache::GetError () const
+{
+  return m_error;
+}
+
+bool
+IncTopologyCache::Fail (const std::string &reason) const
+{
+  m_error = m_file + ": " + reason;
+  NS_LOG_ERROR (m_error);
+  return false;
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,134 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_TOPOLOGY_CACHE_H
+#define INC_TOPOLOGY_CACHE_H
+
+#include "ns3/inc-topology-parser.hpp"
+#include "ns3/inc-scenario.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Precompiled binary form of an annotated topology file (topology and consumer workload)
+ *
+ * Compile parses the text file (or takes an IncScenario) once and writes fixed size record tables plus a pool of
+ * interned strings. Open maps such a file read-only into memory and Replay hands its records to an
+ * IncTopologyParser::Handler in the same order as the text parser would. IncNdnAnnotatedTopologyReader and
+ * parserNodeInfo accept a cache wherever they accept a topology file.
+ *
+ * The cache carries a key, typically HashKey of the generator parameters. A parameter sweep can use the key to find
+ * an existing cache and reuse it.
+ * The layout is native endian and versioned, Open rejects caches written by another version or byte order.
+ */
+class IncTopologyCache
+{
+public:
+  static const uint32_t VERSION;
+
+  IncTopologyCache();
+  ~IncTopologyCache();
+
+  /**
+   * \brief 64 bit FNV-1a hash of a parameter string, used as cache key
+   */
+  static uint64_t
+  HashKey(const std::string& parameters);
+
+  /**
+   * \brief Whether file starts like a topology cache
+   */
+  static bool
+  IsCache(const std::string& file);
+
+  /**
+   * \brief Parse the annotated topology textFile and write it as cache with the given key
+   *
+   * The cache is written to a temporary file first and renamed, so concurrent runs never see a partial cache.
+   *
+   * \return false with the reason in error, if the text does not parse or the cache cannot be written
+   */
+  static bool
+  Compile(const std::string& textFile, const std::string& cacheFile, uint64_t key, std::string& error);
+
+  /**
+   * \brief Write an in-memory scenario as cache with the given key, without a text round trip
+   */
+  static bool
+  Compile(const IncScenario& scenario, const std::string& cacheFile, uint64_t key, std::string& error);
+
+  /**
+   * \brief Map a cache read-only into memory and check its header
+   */
+  bool
+  Open(const std::string& file);
+
+  void
+  Close();
+
+  /**
+   * \brief Hand all records to the handler, returns false if the cache is corrupt
+   */
+  bool
+  Replay(IncTopologyParser::Handler& handler) const;
+
+  uint64_t
+  GetKey() const;
+
+  uint32_t
+  GetNodeCount() const;
+
+  uint32_t
+  GetFunctionCount() const;
+
+  const std::string&
+  GetError() const;
+
+private:
+  IncTopologyCache(const IncTopologyCache&);
+  IncTopologyCache&
+  operator=(const IncTopologyCache&);
+
+  bool
+  Fail(const std::string& reason) const;
+
+private:
+  const uint8_t* m_data;
+  size_t m_size;
+  std::string m_file;
+  mutable std::string m_error;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
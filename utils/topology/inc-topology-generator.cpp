@@ -0,0 +1,458 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-topology-generator.hpp"
+
+#include "ns3/inc-random-streams.hpp"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncTopologyGenerator");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+//resources of the tiers of the generated hierarchical scenario (cloud server, ISP gateway, tier 2, tier 3)
+const IncTierProfile DEFAULT_TIERS[IncTopologyGenerator::TIERS] = {
+    {1000, 40000, 81920, 10000, 1000, "10000Mbps", "5ms"},
+    {500, 20000, 40960, 5000, 500, "10000Mbps", "200ms"},
+    {40, 8000, 8192, 800, 40, "10000Mbps", "25ms"},
+    {20, 4000, 6144, 400, 20, "10000Mbps", "5ms"}};
+
+uint64_t
+Cell (double x, double y, double size)
+{
+  uint64_t column = static_cast<uint32_t> (static_cast<int32_t> (std::floor (x / size)));
+  uint64_t row = static_cast<uint32_t> (static_cast<int32_t> (std::floor (y / size)));
+  return (column << 32) | row;
+}
+
+} // namespace
+
+const uint32_t IncTopologyGenerator::TIERS;
+
+IncTopologyGenerator::IncTopologyGenerator (uint32_t seed)
+    : m_random (IncRandomStreams (seed).Create<UniformRandomVariable> ("topology")),
+      m_spread (0.25),
+      m_orchestrator (true),
+      m_consumerCapacity ("250Mbps"),
+      m_consumerDelay ("2ms"),
+      m_delayPerDistance (0.01),
+      m_computeCount (0),
+      m_consumerCount (0)
+{
+  std::copy (DEFAULT_TIERS, DEFAULT_TIERS + TIERS, m_tiers);
+}
+
+void
+IncTopologyGenerator::SetTierProfile (uint32_t tier, const IncTierProfile &profile)
+{
+  NS_ABORT_MSG_IF (tier >= TIERS, "there are only " << TIERS << " tiers");
+  m_tiers[tier] = profile;
+}
+
+const IncTierProfile &
+IncTopologyGenerator::GetTierProfile (uint32_t tier) const
+{
+  NS_ABORT_MSG_IF (tier >= TIERS, "there are only " << TIERS << " tiers");
+  return m_tiers[tier];
+}
+
+void
+IncTopologyGenerator::SetSpread (double spread)
+{
+  NS_ABORT_MSG_IF (spread < 0 || spread >= 1, "spread must be in [0, 1)");
+  m_spread = spread;
+}
+
+void
+IncTopologyGenerator::SetOrchestrator (bool enable)
+{
+  m_orchestrator = enable;
+}
+
+void
+IncTopologyGenerator::SetConsumerLink (const std::string &capacity, const std::string &delay)
+{
+  m_consumerCapacity = capacity;
+  m_consumerDelay = delay;
+}
+
+void
+IncTopologyGenerator::SetDelayPerDistance (double milliseconds)
+{
+  m_delayPerDistance = milliseconds;
+}
+
+void
+IncTopologyGenerator::FatTree (IncScenario &scenario, uint32_t k, uint32_t hostsPerEdge)
+{
+  NS_ABORT_MSG_IF (k < 2 || k % 2 != 0, "fat-tree arity must be even, got " << k);
+  uint32_t half = k / 2;
+  Begin (scenario);
+
+  std::vector<uint32_t> core;
+  for (uint32_t c = 0; c < half * half; c++)
+    core.push_back (AddCompute (scenario, 1));
+  std::vector<uint32_t> edge;
+  for (uint32_t pod = 0; pod < k; pod++)
+    {
+      std::vector<uint32_t> aggregation;
+      for (uint32_t a = 0; a < half; a++)
+        {
+          aggregation.push_back (AddCompute (scenario, 2));
+          for (uint32_t c = 0; c < half; c++)
+            AddUplink (scenario, aggregation.back (), core[a * half + c], 2);
+        }
+      for (uint32_t e = 0; e < half; e++)
+        {
+          edge.push_back (AddCompute (scenario, 3));
+          for (uint32_t a : aggregation)
+            AddUplink (scenario, edge.back (), a, 3);
+        }
+    }
+  AddConsumers (scenario, edge, hostsPerEdge * edge.size ());
+  End (scenario, core);
+}
+
+void
+IncTopologyGenerator::BarabasiAlbert (IncScenario &scenario, uint32_t n, uint32_t m, uint32_t consumers)
+{
+  NS_ABORT_MSG_IF (m == 0 || n <= m, "Barabasi-Albert needs 0 < m < n, got n=" << n << " m=" << m);
+
+  //every link puts both endpoints into the list, a uniform pick from it is proportional to the degree
+  std::vector<std::pair<uint32_t, uint32_t>> links;
+  std::vector<uint32_t> endpoints;
+  links.reserve (static_cast<size_t> (n) * m);
+  endpoints.reserve (2 * static_cast<size_t> (n) * m);
+  for (uint32_t i = 0; i <= m; i++)
+    for (uint32_t j = 0; j < i; j++)
+      {
+        links.push_back (std::make_pair (i, j));
+        endpoints.push_back (i);
+        endpoints.push_back (j);
+      }
+  std::vector<uint32_t> targets;
+  for (uint32_t node = m + 1; node < n; node++)
+    {
+      targets.clear ();
+      size_t candidates = endpoints.size ();
+      while (targets.size () < m)
+        {
+          uint32_t target = endpoints[m_random->GetInteger (0, candidates - 1)];
+          if (std::find (targets.begin (), targets.end (), target) == targets.end ())
+            targets.push_back (target);
+        }
+      for (uint32_t target : targets)
+        {
+          links.push_back (std::make_pair (node, target));
+          endpoints.push_back (node);
+          endpoints.push_back (target);
+        }
+    }
+
+  //rank by degree with a counting sort, the degree is bounded by n
+  std::vector<uint32_t> degree (n, 0);
+  for (uint32_t endpoint : endpoints)
+    degree[endpoint]++;
+  endpoints.clear ();
+  endpoints.shrink_to_fit ();
+  std::vector<uint32_t> count (n + 1, 0);
+  for (uint32_t d : degree)
+    count[d]++;
+  std::vector<uint32_t> above (n + 1, 0); ///< nodes of a higher degree
+  for (uint32_t d = n; d > 0; d--)
+    above[d - 1] = above[d] + count[d];
+  uint32_t coreSize = std::max<uint32_t> (1, n / 100);
+  uint32_t aggregationSize = coreSize + n / 10;
+
+  Begin (scenario);
+  std::vector<uint32_t> ids (n);
+  std::vector<uint32_t> core;
+  std::vector<uint32_t> edge;
+  std::vector<uint32_t> tiers (n);
+  for (uint32_t node = 0; node < n; node++)
+    {
+      uint32_t rank = above[degree[node]];
+      tiers[node] = rank < coreSize ? 1 : rank < aggregationSize ? 2 : 3;
+      ids[node] = AddCompute (scenario, tiers[node]);
+      if (tiers[node] == 1)
+        core.push_back (ids[node]);
+      else if (tiers[node] == 3)
+        edge.push_back (ids[node]);
+    }
+  for (auto &link : links)
+    AddUplink (scenario, ids[link.first], ids[link.second],
+               std::max (tiers[link.first], tiers[link.second]));
+  AddConsumers (scenario, edge.empty () ? ids : edge, consumers);
+  End (scenario, core);
+}
+
+void
+IncTopologyGenerator::GeometricClusters (IncScenario &scenario, uint32_t clusters,
+                                         uint32_t nodesPerCluster, double area, double clusterRadius,
+                                         double linkRadius, uint32_t consumers)
+{
+  NS_ABORT_MSG_IF (clusters == 0 || area <= 0 || clusterRadius < 0,
+                   "geometric clusters need clusters, an area and a cluster radius");
+  Begin (scenario);
+
+  double centre = area / 2;
+  uint32_t cloud = AddCompute (scenario, 0, centre, centre);
+  std::vector<uint32_t> heads;
+  std::vector<uint32_t> edge;
+  std::vector<double> x (nodesPerCluster);
+  std::vector<double> y (nodesPerCluster);
+  std::unordered_map<uint64_t, std::vector<uint32_t>> grid;
+  for (uint32_t c = 0; c < clusters; c++)
+    {
+      double headX = m_random->GetValue (0, area);
+      double headY = m_random->GetValue (0, area);
+      heads.push_back (AddCompute (scenario, 2, headX, headY));
+      AddUplink (scenario, heads.back (), cloud, 2,
+                 DistanceDelay (std::hypot (headX - centre, headY - centre)));
+
+      //members link to the head and, through a grid of linkRadius cells, to the members close to them
+      grid.clear ();
+      uint32_t first = edge.size ();
+      for (uint32_t i = 0; i < nodesPerCluster; i++)
+        {
+          double radius = clusterRadius * std::sqrt (m_random->GetValue ());
+          double angle = m_random->GetValue (0, 2 * M_PI);
+          x[i] = headX + radius * std::cos (angle);
+          y[i] = headY + radius * std::sin (angle);
+          edge.push_back (AddCompute (scenario, 3, x[i], y[i]));
+          AddUplink (scenario, edge.back (), heads.back (), 3, DistanceDelay (radius));
+          if (linkRadius <= 0)
+            continue;
+          uint64_t cell = Cell (x[i], y[i], linkRadius);
+          for (int64_t dx = -1; dx <= 1; dx++)
+            for (int64_t dy = -1; dy <= 1; dy++)
+              {
+                uint64_t neighbour = Cell (x[i] + dx * linkRadius, y[i] + dy * linkRadius, linkRadius);
+                auto it = grid.find (neighbour);
+                if (it == grid.end ())
+                  continue;
+                for (uint32_t j : it->second)
+                  {
+                    double distance = std::hypot (x[i] - x[j], y[i] - y[j]);
+                    if (distance <= linkRadius)
+                      AddUplink (scenario, edge.back (), edge[first + j], 3, DistanceDelay (distance));
+                  }
+              }
+          grid[cell].push_back (i);
+        }
+    }
+  AddConsumers (scenario, edge.empty () ? heads : edge, consumers);
+  End (scenario, heads);
+}
+
+bool
+IncTopologyGenerator::ImportRocketfuel (IncScenario &scenario, const std::string &file,
+                                        uint32_t consumers, std::string &error)
+{
+  std::ifstream input (file.c_str ());
+  if (!input.is_open ())
+    {
+      error = "Cannot open file " + file + " for reading";
+      return false;
+    }
+
+  //uid @location [+] [bb] (neighbours) [&external] -> <uid> <uid> ... {-external} ... =name[!] rn
+  std::vector<int64_t> uids;
+  std::vector<bool> backbone;
+  std::vector<std::vector<int64_t>> neighbours;
+  std::string line;
+  uint32_t lineNumber = 0;
+  while (std::getline (input, line))
+    {
+      lineNumber++;
+      std::istringstream tokens (line);
+      std::string token;
+      if (!(tokens >> token) || token[0] == '#')
+        continue;
+      char *end;
+      int64_t uid = std::strtoll (token.c_str (), &end, 10);
+      if (*end != '\0')
+        {
+          error = file + ":" + std::to_string (lineNumber) + ": invalid router id " + token;
+          return false;
+        }
+      if (uid < 0)
+        continue; // external router of another AS
+      uids.push_back (uid);
+      backbone.push_back (false);
+      neighbours.push_back (std::vector<int64_t> ());
+      while (tokens >> token && token[0] != '=')
+        {
+          if (token == "bb")
+            backbone.back () = true;
+          else if (token.size () > 2 && token.front () == '<' && token.back () == '>')
+            neighbours.back ().push_back (std::strtoll (token.c_str () + 1, nullptr, 10));
+        }
+    }
+  if (uids.empty ())
+    {
+      error = file + ": no routers";
+      return false;
+    }
+
+  std::unordered_map<int64_t, size_t> routers;
+  for (size_t i = 0; i < uids.size (); i++)
+    if (!routers.emplace (uids[i], i).second)
+      {
+        error = file + ": duplicate router id " + std::to_string (uids[i]);
+        return false;
+      }
+
+  Begin (scenario);
+  std::vector<uint32_t> ids (uids.size ());
+  std::vector<uint32_t> core;
+  std::vector<uint32_t> edge;
+  for (size_t i = 0; i < uids.size (); i++)
+    {
+      ids[i] = AddCompute (scenario, backbone[i] ? 1 : 2);
+      (backbone[i] ? core : edge).push_back (ids[i]);
+    }
+  //links to routers outside the map are dropped, the reverse direction of a listed link is skipped by the scenario
+  for (size_t i = 0; i < uids.size (); i++)
+    for (int64_t neighbour : neighbours[i])
+      {
+        auto it = routers.find (neighbour);
+        if (it != routers.end ())
+          AddUplink (scenario, ids[i], ids[it->second], backbone[i] && backbone[it->second] ? 1 : 2);
+      }
+  AddConsumers (scenario, edge.empty () ? core : edge, consumers);
+  End (scenario, core.empty () ? edge : core);
+  NS_LOG_INFO (file << ": " << uids.size () << " routers, " << core.size () << " in the backbone");
+  return true;
+}
+
+void
+IncTopologyGenerator::Begin (IncScenario &scenario)
+{
+  NS_ABORT_MSG_IF (!scenario.GetNodes ().empty (), "topologies are generated into an empty scenario");
+  m_computeCount = 0;
+  m_consumerCount = 0;
+  if (m_orchestrator)
+    {
+      IncTopologyNode orchestrator = IncTopologyNode ();
+      orchestrator.type = IncTopologyNode::Compute;
+      orchestrator.name = "orchestrator";
+      orchestrator.latitude = 100;
+      orchestrator.longitude = 30;
+      orchestrator.cores = 10;
+      orchestrator.clockSpeed = 4000;
+      orchestrator.ram = 40960;
+      orchestrator.rom = 2000;
+      orchestrator.queue = 10;
+      orchestrator.links = "l1,l2,l3";
+      orchestrator.runtimes = "docker,python,java";
+      scenario.AddNode (orchestrator);
+    }
+}
+
+uint32_t
+IncTopologyGenerator::AddCompute (IncScenario &scenario, uint32_t tier, double x, double y)
+{
+  const IncTierProfile &profile = m_tiers[tier];
+  IncTopologyNode node = IncTopologyNode ();
+  node.type = IncTopologyNode::Compute;
+  node.name = "compute_node_" + std::to_string (m_computeCount++);
+  node.latitude = y;
+  node.longitude = x;
+  node.cores = Vary (profile.cores);
+  node.clockSpeed = Vary (profile.clockSpeed);
+  node.ram = Vary (profile.ram);
+  node.rom = Vary (profile.rom);
+  node.queue = Vary (profile.queue);
+  node.links = "l2,l3";
+  node.runtimes = "docker,python,java";
+  return scenario.AddNode (node);
+}
+
+void
+IncTopologyGenerator::AddUplink (IncScenario &scenario, uint32_t from, uint32_t to, uint32_t tier,
+                                 const std::string &delay)
+{
+  const std::vector<IncTopologyNode> &nodes = scenario.GetNodes ();
+  const IncTierProfile &profile = m_tiers[tier];
+  scenario.AddLink (nodes[from].name, nodes[to].name, profile.capacity, "1",
+                    delay.empty () ? profile.delay : delay, "1000");
+}
+
+void
+IncTopologyGenerator::AddConsumers (IncScenario &scenario, const std::vector<uint32_t> &edge,
+                                    uint32_t consumers)
+{
+  for (uint32_t i = 0; i < consumers && !edge.empty (); i++)
+    {
+      IncTopologyNode consumer = IncTopologyNode ();
+      consumer.type = IncTopologyNode::Consumer;
+      consumer.name = "consumer_" + std::to_string (m_consumerCount++);
+      scenario.AddNode (consumer);
+      scenario.AddLink (scenario.GetNodes ()[edge[i % edge.size ()]].name, consumer.name,
+                        m_consumerCapacity, "1", m_consumerDelay, "10");
+    }
+}
+
+void
+IncTopologyGenerator::End (IncScenario &scenario, const std::vector<uint32_t> &top)
+{
+  if (m_orchestrator)
+    for (uint32_t node : top)
+      scenario.AddLink ("orchestrator", scenario.GetNodes ()[node].name, "10000Mbps", "50", "5ms", "1000");
+  NS_LOG_INFO ("generated " << m_computeCount << " compute nodes, " << m_consumerCount << " consumers and "
+                            << scenario.GetLinks ().size () << " links");
+}
+
+uint32_t
+IncTopologyGenerator::Vary (uint32_t value)
+{
+  if (m_spread == 0)
+    return value;
+  double factor = 1 + m_spread * (2 * m_random->GetValue () - 1);
+  return std::max<uint32_t> (1, std::lround (value * factor));
+}
+
+std::string
+IncTopologyGenerator::DistanceDelay (double distance) const
+{
+  return std::to_string (std::max<long> (1, std::lround (distance * m_delayPerDistance))) + "ms";
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,170 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_TOPOLOGY_GENERATOR_H
+#define INC_TOPOLOGY_GENERATOR_H
+
+#include "ns3/inc-scenario.hpp"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Resources of the compute nodes of one tier and the links towards the tier above
+ */
+struct IncTierProfile
+{
+  uint32_t cores;
+  uint32_t clockSpeed;
+  uint32_t ram;
+  uint32_t rom;
+  uint32_t queue;
+  std::string capacity; ///< of the uplinks
+  std::string delay;    ///< of the uplinks, geometric topologies derive it from the distance instead
+};
+
+/**
+ * \brief Synthetic topologies of compute nodes and consumers as IncScenario
+ *
+ * Compute nodes are named compute_node_<i> and consumers consumer_<i>. Every compute node belongs to one of four tiers
+ * (0 cloud, 1 ISP core, 2 aggregation, 3 edge). Its resources are those of the tier profile, each varied uniformly by
+ * up to +-spread. Consumers attach to edge nodes. An orchestrator is added in front of the topology and linked to the
+ * nodes of its top tier, with OSPF metric 50 so that it never carries transit traffic, as in the generated
+ * hierarchical scenario.
+ *
+ * All generators run in time linear in the number of nodes and links, the random draws come from the "topology"
+ * stream of the seed. Functions and workload are not generated, they can be added to the scenario afterwards, and
+ * IncScenario::Save writes the annotated topology file.
+ */
+class IncTopologyGenerator
+{
+public:
+  static const uint32_t TIERS = 4;
+
+  explicit IncTopologyGenerator(uint32_t seed = 1);
+
+  void
+  SetTierProfile(uint32_t tier, const IncTierProfile& profile);
+
+  const IncTierProfile&
+  GetTierProfile(uint32_t tier) const;
+
+  /**
+   * \brief Relative variation of the node resources within a tier, 0 makes the tiers homogeneous
+   */
+  void
+  SetSpread(double spread);
+
+  void
+  SetOrchestrator(bool enable);
+
+  void
+  SetConsumerLink(const std::string& capacity, const std::string& delay);
+
+  /**
+   * \brief Delay in milliseconds per unit of distance of geometric topologies
+   */
+  void
+  SetDelayPerDistance(double milliseconds);
+
+  /**
+   * \brief k-ary fat-tree: (k/2)^2 core (tier 1), k^2/2 aggregation (tier 2) and k^2/2 edge (tier 3) nodes, each
+   * edge node serving hostsPerEdge consumers
+   */
+  void
+  FatTree(IncScenario& scenario, uint32_t k, uint32_t hostsPerEdge);
+
+  /**
+   * \brief Barabasi-Albert preferential attachment graph of n nodes, each new node linking to m existing ones
+   *
+   * The 1% best connected nodes form the core (tier 1), the next 10% the aggregation (tier 2), the rest the edge.
+   */
+  void
+  BarabasiAlbert(IncScenario& scenario, uint32_t n, uint32_t m, uint32_t consumers);
+
+  /**
+   * \brief Edge clusters scattered over a square area around a cloud node (tier 0)
+   *
+   * Every cluster has a head (tier 2) at its centre and nodesPerCluster edge nodes (tier 3) within clusterRadius.
+   * Edge nodes link to their head and to all nodes of their cluster within linkRadius, heads link to the cloud.
+   * Link delays follow the distance.
+   */
+  void
+  GeometricClusters(IncScenario& scenario, uint32_t clusters, uint32_t nodesPerCluster, double area,
+                    double clusterRadius, double linkRadius, uint32_t consumers);
+
+  /**
+   * \brief Import a Rocketfuel router level map (.cch), backbone routers become tier 1, the others tier 2
+   *
+   * \return false with the reason in error, if the map cannot be read
+   */
+  bool
+  ImportRocketfuel(IncScenario& scenario, const std::string& file, uint32_t consumers, std::string& error);
+
+private:
+  void
+  Begin(IncScenario& scenario);
+
+  uint32_t
+  AddCompute(IncScenario& scenario, uint32_t tier, double x = 0, double y = 0);
+
+  void
+  AddUplink(IncScenario& scenario, uint32_t from, uint32_t to, uint32_t tier, const std::string& delay = "");
+
+  void
+  AddConsumers(IncScenario& scenario, const std::vector<uint32_t>& edge, uint32_t consumers);
+
+  void
+  End(IncScenario& scenario, const std::vector<uint32_t>& top);
+
+  uint32_t
+  Vary(uint32_t value);
+
+  std::string
+  DistanceDelay(double distance) const;
+
+  Ptr<UniformRandomVariable> m_random;
+  IncTierProfile m_tiers[TIERS];
+  double m_spread;
+  bool m_orchestrator;
+  std::string m_consumerCapacity;
+  std::string m_consumerDelay;
+  double m_delayPerDistance;
+  uint32_t m_computeCount;
+  uint32_t m_consumerCount;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
@@ -0,0 +1,543 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-topology-parser.hpp"
+
+#include "ns3/log.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncTopologyParser");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+const uint32_t MAX_FIELDS = 16;
+
+/**
+ * \brief Whitespace separated field of a line, points into the line buffer
+ */
+struct Field
+{
+  const char *data;
+  size_t size;
+
+  std::string
+  str () const
+  {
+    return std::string (data, size);
+  }
+};
+
+uint32_t
+Split (const std::string &line, Field *fields)
+{
+  uint32_t count = 0;
+  const char *p = line.data ();
+  const char *end = p + line.size ();
+  while (p < end)
+    {
+      while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p++;
+      if (p == end)
+        break;
+      const char *start = p;
+      while (p < end && *p != ' ' && *p != '\t' && *p != '\r')
+        p++;
+      if (count < MAX_FIELDS)
+        {
+          fields[count].data = start;
+          fields[count].size = p - start;
+        }
+      count++;
+    }
+  return count;
+}
+
+bool
+ParseUnsigned (const Field &field, uint32_t &value)
+{
+  if (field.size == 0 || field.size > 10)
+    return false;
+  uint64_t result = 0;
+  for (size_t i = 0; i < field.size; i++)
+    {
+      if (field.data[i] < '0' || field.data[i] > '9')
+        return false;
+      result = result * 10 + (field.data[i] - '0');
+    }
+  if (result > std::numeric_limits<uint32_t>::max ())
+    return false;
+  value = result;
+  return true;
+}
+
+bool
+ParseDouble (const Field &field, double &value)
+{
+  //the line is NUL terminated and fields end at a separator, so strtod stops at the end of the field
+  char *end;
+  value = std::strtod (field.data, &end);
+  return end == field.data + field.size;
+}
+
+bool
+Contains (const Field &field, const char *text)
+{
+  size_t size = std::strlen (text);
+  for (size_t i = 0; i + size <= field.size; i++)
+    {
+      if (std::memcmp (field.data + i, text, size) == 0)
+        return true;
+    }
+  return false;
+}
+
+std::vector<std::string>
+SplitList (const Field &field, char delim)
+{
+  std::vector<std::string> list;
+  size_t start = 0;
+  for (size_t i = 0; i <= field.size; i++)
+    {
+      if (i == field.size || field.data[i] == delim)
+        {
+          if (i > start)
+            list.push_back (std::string (field.data + start, i - start));
+          start = i + 1;
+        }
+    }
+  return list;
+}
+
+} // namespace
+
+const uint32_t IncTopologyParser::NOT_FOUND = std::numeric_limits<uint32_t>::max ();
+
+IncTopologyParser::Handler::~Handler ()
+{
+}
+
+void
+IncTopologyParser::Handler::OnNode (uint32_t index, const IncTopologyNode &node)
+{
+}
+
+void
+IncTopologyParser::Handler::OnLink (const IncTopologyLink &link)
+{
+}
+
+void
+IncTopologyParser::Handler::OnFunction (uint32_t index, const IncTopologyFunction &function)
+{
+}
+
+void
+IncTopologyParser::Handler::OnPlacement (const IncFunctionPlacement &placement)
+{
+}
+
+void
+IncTopologyParser::Handler::OnRequest (const IncConsumerRequest &request)
+{
+}
+
+void
+IncTopologyParser::Handler::OnData (const IncProvidedData &data)
+{
+}
+
+IncTopologyParser::IncTopologyParser (Handler &handler)
+    : m_handler (handler), m_line (0), m_section (NONE), m_links (0)
+{
+}
+
+bool
+IncTopologyParser::Parse (const std::string &file)
+{
+  std::ifstream input (file.c_str ());
+  if (!input.is_open () || !input.good ())
+    {
+      m_source = file;
+      m_line = 0;
+      m_error = "Cannot open file " + file + " for reading";
+      return false;
+    }
+  return Parse (input, file);
+}
+
+bool
+IncTopologyParser::Parse (std::istream &input, const std::string &source)
+{
+  m_source = source;
+  m_error.clear ();
+  m_line = 0;
+  m_section = NONE;
+  m_nodeIndex.clear ();
+  m_nodeTypes.clear ();
+  m_functionIndex.clear ();
+  m_processedLinks.clear ();
+  m_links = 0;
+
+  std::string line;
+  while (std::getline (input, line))
+    {
+      m_line++;
+      if (!ParseLine (line))
+        return false;
+    }
+  if (m_section == NONE)
+    return Fail ("topology does not have a \"router\" section");
+
+  NS_LOG_INFO (m_source << ": " << m_nodeIndex.size () << " nodes, " << m_links << " links, "
+                        << m_functionIndex.size () << " functions in " << m_line << " lines");
+  return true;
+}
+
+bool
+IncTopologyParser::ParseLine (const std::string &line)
+{
+  size_t begin = line.find_first_not_of (" \t");
+  if (begin == std::string::npos || line[begin] == '#')
+    return true; // blank lines and comments
+  size_t end = line.find_last_not_of (" \t\r");
+
+  Section next = NONE;
+  const char *header = line.c_str () + begin;
+  size_t size = end - begin + 1;
+  for (int section = ROUTER; section <= INITIAL_DATA; section++)
+    {
+      const char *name = GetSectionName (static_cast<Section> (section));
+      if (std::strlen (name) == size && std::memcmp (header, name, size) == 0)
+        {
+          next = static_cast<Section> (section);
+          break;
+        }
+    }
+  if (next != NONE)
+    {
+      if (next <= m_section)
+        return Fail (std::string ("section \"") + GetSectionName (next) + "\" after section \"" +
+                     GetSectionName (m_section) + "\"");
+      if (m_section == NONE && next != ROUTER)
+        return Fail (std::string ("section \"") + GetSectionName (next) +
+                     "\" before the \"router\" section");
+      m_section = next;
+      return true;
+    }
+
+  switch (m_section)
+    {
+    case ROUTER:
+      return ParseNode (line);
+    case LINKS:
+      return ParseLink (line);
+    case FUNCTIONS:
+      return ParseFunction (line);
+    case INITIAL_STATUS:
+      return ParsePlacement (line);
+    case CONSUMERS:
+      return ParseRequest (line);
+    case INITIAL_DATA:
+      return ParseData (line);
+    default:
+      return Fail ("content before the \"router\" section");
+    }
+}
+
+bool
+IncTopologyParser::ParseNode (const std::string &line)
+{
+  Field fields[MAX_FIELDS];
+  uint32_t count = Split (line, fields);
+  if (count < 3)
+    return Fail ("node needs at least name, latitude and longitude");
+
+  IncTopologyNode node = IncTopologyNode ();
+  node.name = fields[0].str ();
+  if (Contains (fields[0], "orchestrator") || Contains (fields[0], "compute"))
+    node.type = IncTopologyNode::Compute;
+  else if (Contains (fields[0], "consumer"))
+    node.type = IncTopologyNode::Consumer;
+  else
+    return Fail ("node " + node.name + " is neither an orchestrator/compute node nor a consumer");
+
+  if (!ParseDouble (fields[1], node.latitude) || !ParseDouble (fields[2], node.longitude))
+    return Fail ("invalid position of node " + node.name);
+
+  if (node.type == IncTopologyNode::Compute)
+    {
+      //the queue size column is optional
+      if (count != 9 && count != 10)
+        return Fail ("compute node " + node.name + " has " + std::to_string (count) +
+                     " fields, expected name, latitude, longitude, cores, clock speed, RAM, ROM, "
+                     "[queue], links, runtimes");
+      if (!ParseUnsigned (fields[3], node.cores) || !ParseUnsigned (fields[4], node.clockSpeed) ||
+          !ParseUnsigned (fields[5], node.ram) || !ParseUnsigned (fields[6], node.rom) ||
+          (count == 10 && !ParseUnsigned (fields[7], node.queue)))
+        return Fail ("invalid resources of compute node " + node.name);
+      node.links = fields[count - 2].str ();
+      node.runtimes = fields[count - 1].str ();
+    }
+
+  uint32_t index = m_nodeTypes.size ();
+  if (!m_nodeIndex.emplace (node.name, index).second)
+    return Fail ("duplicate node " + node.name);
+  m_nodeTypes.push_back (node.type);
+  m_handler.OnNode (index, node);
+  return true;
+}
+
+bool
+IncTopologyParser::ParseLink (const std::string &line)
+{
+  Field fields[MAX_FIELDS];
+  uint32_t count = Split (line, fields);
+  if (count < 4 || count > 7)
+    return Fail ("link has " + std::to_string (count) +
+                 " fields, expected from, to, capacity, metric, [delay], [max packets], [loss rate]");
+
+  IncTopologyLink link = IncTopologyLink ();
+  link.from = fields[0].str ();
+  link.to = fields[1].str ();
+  link.fromNode = FindNode (link.from);
+  if (link.fromNode == NOT_FOUND)
+    return Fail ("link from unknown node " + link.from);
+  link.toNode = FindNode (link.to);
+  if (link.toNode == NOT_FOUND)
+    return Fail ("link to unknown node " + link.to);
+
+  uint32_t metric;
+  if (!ParseUnsigned (fields[3], metric) || metric > std::numeric_limits<uint16_t>::max ())
+    return Fail ("invalid OSPF metric " + fields[3].str ());
+
+  uint64_t low = std::min (link.fromNode, link.toNode);
+  uint64_t high = std::max (link.fromNode, link.toNode);
+  if (!m_processedLinks.insert ((high << 32) | low).second)
+    {
+      NS_LOG_DEBUG (m_source << ":" << m_line << ": duplicated link " << link.from << " <==> " << link.to);
+      return true;
+    }
+
+  link.capacity = fields[2].str ();
+  link.metric = fields[3].str ();
+  if (count > 4)
+    link.delay = fields[4].str ();
+  if (count > 5)
+    link.maxPackets = fields[5].str ();
+  if (count > 6)
+    link.lossRate = fields[6].str ();
+  m_links++;
+  m_handler.OnLink (link);
+  return true;
+}
+
+bool
+IncTopologyParser::ParseFunction (const std::string &line)
+{
+  Field fields[MAX_FIELDS];
+  uint32_t count = Split (line, fields);
+  //the number of instructions column is optional
+  if (count != 9 && count != 10)
+    return Fail ("function has " + std::to_string (count) +
+                 " fields, expected name, inputs, runtimes, RAM, ROM, cores, execution time, "
+                 "[instructions], function size, result size");
+
+  IncTopologyFunction function = IncTopologyFunction ();
+  function.name = fields[0].str ();
+  function.inputs = fields[1].str ();
+  function.runtimes = SplitList (fields[2], ';');
+  if (!ParseUnsigned (fields[3], function.ram) || !ParseUnsigned (fields[4], function.rom) ||
+      !ParseUnsigned (fields[5], function.cpu) || !ParseDouble (fields[6], function.execTime) ||
+      (count == 10 && !ParseUnsigned (fields[7], function.numInstructions)) ||
+      !ParseUnsigned (fields[count - 2], function.funcSize) ||
+      !ParseUnsigned (fields[count - 1], function.resultSize))
+    return Fail ("invalid requirements of function " + function.name);
+  if (function.inputs != "null")
+    function.numInputs = SplitList (fields[1], ',').size ();
+
+  uint32_t index = m_functionIndex.size ();
+  if (!m_functionIndex.emplace (function.name, index).second)
+    return Fail ("duplicate function " + function.name);
+  m_handler.OnFunction (index, function);
+  return true;
+}
+
+bool
+IncTopologyParser::ParsePlacement (const std::string &line)
+{
+  Field fields[MAX_FIELDS];
+  if (Split (line, fields) != 2)
+    return Fail ("initial function status expects node and function");
+
+  IncFunctionPlacement placement;
+  placement.node = fields[0].str ();
+  placement.function = fields[1].str ();
+  placement.nodeIndex = FindNode (placement.node);
+  if (placement.nodeIndex == NOT_FOUND)
+    return Fail ("function placed on unknown node " + placement.node);
+  if (m_nodeTypes[placement.nodeIndex] != IncTopologyNode::Compute)
+    return Fail ("function placed on " + placement.node + ", which is not a compute node");
+  placement.functionIndex = FindFunction (placement.function);
+  if (placement.functionIndex == NOT_FOUND)
+    return Fail ("unknown function " + placement.function + " placed on " + placement.node);
+  m_handler.OnPlacement (placement);
+  return true;
+}
+
+bool
+IncTopologyParser::ParseRequest (const std::string &line)
+{
+  Field fields[MAX_FIELDS];
+  uint32_t count = Split (line, fields);
+  if (count != 7)
+    return Fail ("consumer request has " + std::to_string (count) +
+                 " fields, expected consumer, function, inputs, frequency, lifetime, start, stop");
+
+  IncConsumerRequest request;
+  request.consumer = fields[0].str ();
+  request.function = fields[1].str ();
+  request.consumerIndex = FindNode (request.consumer);
+  if (request.consumerIndex == NOT_FOUND)
+    return Fail ("request from unknown node " + request.consumer);
+  if (m_nodeTypes[request.consumerIndex] != IncTopologyNode::Consumer)
+    return Fail ("request from " + request.consumer + ", which is not a consumer");
+  request.functionIndex = FindFunction (request.function);
+  if (request.functionIndex == NOT_FOUND)
+    return Fail ("request for unknown function " + request.function);
+  request.inputs = fields[2].str ();
+  request.frequency = fields[3].str ();
+  request.lifetime = fields[4].str ();
+  request.startTime = fields[5].str ();
+  request.stopTime = fields[6].str ();
+  m_handler.OnRequest (request);
+  return true;
+}
+
+bool
+IncTopologyParser::ParseData (const std::string &line)
+{
+  Field fields[MAX_FIELDS];
+  if (Split (line, fields) != 4)
+    return Fail ("initial data expects consumer, data, size, freshness");
+
+  IncProvidedData data;
+  data.consumer = fields[0].str ();
+  data.consumerIndex = FindNode (data.consumer);
+  if (data.consumerIndex == NOT_FOUND)
+    return Fail ("data provided by unknown node " + data.consumer);
+  if (m_nodeTypes[data.consumerIndex] != IncTopologyNode::Consumer)
+    return Fail ("data provided by " + data.consumer + ", which is not a consumer");
+  data.data = fields[1].str ();
+  data.size = fields[2].str ();
+  data.freshness = fields[3].str ();
+  m_handler.OnData (data);
+  return true;
+}
+
+bool
+IncTopologyParser::Fail (const std::string &reason)
+{
+  m_error = m_source + ":" + std::to_string (m_line) + ": " + reason;
+  NS_LOG_ERROR (m_error);
+  return false;
+}
+
+const std::string &
+IncTopologyParser::GetError () const
+{
+  return m_error;
+}
+
+uint32_t
+IncTopologyParser::FindNode (const std::string &name) const
+{
+  auto it = m_nodeIndex.find (name);
+  return it == m_nodeIndex.end () ? NOT_FOUND : it->second;
+}
+
+uint32_t
+IncTopologyParser::FindFunction (const std::string &name) const
+{
+  auto it = m_functionIndex.find (name);
+  return it == m_functionIndex.end () ? NOT_FOUND : it->second;
+}
+
+uint32_t
+IncTopologyParser::GetNodeCount () const
+{
+  return m_nodeTypes.size ();
+}
+
+uint32_t
+IncTopologyParser::GetLinkCount () const
+{
+  return m_links;
+}
+
+uint32_t
+IncTopologyParser::GetFunctionCount () const
+{
+  return m_functionIndex.size ();
+}
+
+uint32_t
+IncTopologyParser::GetLineCount () const
+{
+  return m_line;
+}
+
+const char *
+IncTopologyParser::GetSectionName (Section section)
+{
+  switch (section)
+    {
+    case ROUTER:
+      return "router";
+    case LINKS:
+      return "links";
+    case FUNCTIONS:
+      return "functions";
+    case INITIAL_STATUS:
+      return "initial function status";
+    case CONSUMERS:
+      return "consumer section";
+    case INITIAL_DATA:
+      return "initial data section";
+    default:
+      return "";
+    }
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,277 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_TOPOLOGY_PARSER_H
+#define INC_TOPOLOGY_PARSER_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief A node of the "router" section
+ *
+ * Compute lines carry name, latitude, longitude, cores, clock speed, RAM, ROM, queue size, links and runtimes
+ * (the queue column is optional). Consumer lines only use name, latitude and longitude.
+ */
+struct IncTopologyNode
+{
+  enum Type
+  {
+    Compute,
+    Consumer
+  };
+
+  Type type;
+  std::string name;
+  double latitude;
+  double longitude;
+  uint32_t cores;
+  uint32_t clockSpeed;
+  uint32_t ram;
+  uint32_t rom;
+  uint32_t queue;
+  std::string links;
+  std::string runtimes;
+};
+
+/**
+ * \brief A link of the "links" section, the endpoints are also given as node indices in reading order
+ */
+struct IncTopologyLink
+{
+  std::string from;
+  std::string to;
+  uint32_t fromNode;
+  uint32_t toNode;
+  std::string capacity;
+  std::string metric;
+  std::string delay;
+  std::string maxPackets;
+  std::string lossRate;
+};
+
+/**
+ * \brief A function of the "functions" section
+ */
+struct IncTopologyFunction
+{
+  std::string name;
+  std::string inputs; ///< input signature, "null" if the function takes no input
+  std::vector<std::string> runtimes;
+  uint32_t ram;
+  uint32_t rom;
+  uint32_t cpu;
+  double execTime;
+  uint32_t numInstructions;
+  uint32_t funcSize;
+  uint32_t resultSize;
+  uint32_t numInputs;
+};
+
+/**
+ * \brief A line of the "initial function status" section
+ */
+struct IncFunctionPlacement
+{
+  std::string node;
+  std::string function;
+  uint32_t nodeIndex;
+  uint32_t functionIndex;
+};
+
+/**
+ * \brief A line of the "consumer section": a consumer requesting a function with the given inputs
+ */
+struct IncConsumerRequest
+{
+  std::string consumer;
+  std::string function;
+  uint32_t consumerIndex;
+  uint32_t functionIndex;
+  std::string inputs; ///< comma separated input list, "null" if there is none
+  std::string frequency;
+  std::string lifetime;
+  std::string startTime;
+  std::string stopTime;
+};
+
+/**
+ * \brief A line of the "initial data section": data a consumer provides
+ */
+struct IncProvidedData
+{
+  std::string consumer;
+  uint32_t consumerIndex;
+  std::string data;
+  std::string size;
+  std::string freshness;
+};
+
+/**
+ * \brief Single pass, validating parser for the annotated incSIM topology format
+ *
+ * The file is read line by line. A section header ("router", "links", "functions", "initial function status",
+ * "consumer section", "initial data section") moves the parser to that section. Sections must appear in this order.
+ * Only "router" is mandatory. Every line is handed to the Handler as soon as it is parsed and validated, so nothing
+ * is buffered. Node and function references are resolved through hash indices.
+ *
+ * The first malformed line stops the parser. GetError then returns a "file:line: reason" diagnostic.
+ */
+class IncTopologyParser
+{
+public:
+  static const uint32_t NOT_FOUND;
+
+  enum Section
+  {
+    NONE,
+    ROUTER,
+    LINKS,
+    FUNCTIONS,
+    INITIAL_STATUS,
+    CONSUMERS,
+    INITIAL_DATA
+  };
+
+  /**
+   * \brief Receives the records of a topology file in reading order
+   */
+  class Handler
+  {
+  public:
+    virtual ~Handler();
+
+    virtual void
+    OnNode(uint32_t index, const IncTopologyNode& node);
+
+    virtual void
+    OnLink(const IncTopologyLink& link);
+
+    virtual void
+    OnFunction(uint32_t index, const IncTopologyFunction& function);
+
+    virtual void
+    OnPlacement(const IncFunctionPlacement& placement);
+
+    virtual void
+    OnRequest(const IncConsumerRequest& request);
+
+    virtual void
+    OnData(const IncProvidedData& data);
+  };
+
+  explicit IncTopologyParser(Handler& handler);
+
+  /**
+   * \brief Parse the topology file, returns false on the first error
+   */
+  bool
+  Parse(const std::string& file);
+
+  /**
+   * \brief Parse a topology from a stream, source is only used in diagnostics
+   */
+  bool
+  Parse(std::istream& input, const std::string& source);
+
+  /**
+   * \brief "file:line: reason" of the error that stopped the last Parse
+   */
+  const std::string&
+  GetError() const;
+
+  uint32_t
+  FindNode(const std::string& name) const;
+
+  uint32_t
+  FindFunction(const std::string& name) const;
+
+  uint32_t
+  GetNodeCount() const;
+
+  uint32_t
+  GetLinkCount() const;
+
+  uint32_t
+  GetFunctionCount() const;
+
+  uint32_t
+  GetLineCount() const;
+
+  static const char*
+  GetSectionName(Section section);
+
+private:
+  bool
+  ParseLine(const std::string& line);
+
+  bool
+  ParseNode(const std::string& line);
+
+  bool
+  ParseLink(const std::string& line);
+
+  bool
+  ParseFunction(const std::string& line);
+
+  bool
+  ParsePlacement(const std::string& line);
+
+  bool
+  ParseRequest(const std::string& line);
+
+  bool
+  ParseData(const std::string& line);
+
+  bool
+  Fail(const std::string& reason);
+
+private:
+  Handler& m_handler;
+  std::string m_source;
+  std::string m_error;
+  uint32_t m_line;
+  Section m_section;
+
+  std::unordered_map<std::string, uint32_t> m_nodeIndex;
+  std::vector<IncTopologyNode::Type> m_nodeTypes;
+  std::unordered_map<std::string, uint32_t> m_functionIndex;
+  std::unordered_set<uint64_t> m_processedLinks; ///< unordered endpoint pairs, to drop duplicated links
+  uint32_t m_links;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
@@ -0,0 +1,222 @@
+ /*
+  * ******************************************************************************
+  * Copyright (c) 2021 Robert Bosch GmbH.
+  *
+  * This program is free software; you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License version 3 as
+  * published by the Free Software Foundation;
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * All rights reserved. This program and the accompanying materials
+  * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+  * which accompanies this distribution, and is available at
+  * https://www.gnu.org/licenses/gpl-3.0.de.html
+  *
+  *  Date: November 8th, 2021
+  *  Contributors:
+  *      Robert Bosch GmbH - initial API and functionality
+  *          Dennis Grewe <dennis.grewe@de.bosch.com>
+  *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+  * *****************************************************************************
+  */
+
+
+#include "inc-deadline-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+#include "ns3/NFN-producer-app.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.IncDeadlineTracer");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<IncDeadlineTracer>>>> g_tracers;
+
+namespace {
+
+shared_ptr<std::ostream>
+OpenOutput(const std::string& file)
+{
+  if (file == "-")
+    return shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+  return os;
+}
+
+} // namespace
+
+void
+IncDeadlineTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+IncDeadlineTracer::InstallAll(const std::string& file, Time averagingPeriod)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++)
+    nodes.Add(*node);
+  Install(nodes, file, averagingPeriod);
+}
+
+void
+IncDeadlineTracer::Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod)
+{
+  shared_ptr<std::ostream> outputStream = OpenOutput(file);
+  if (outputStream == nullptr)
+    return;
+
+  std::list<Ptr<IncDeadlineTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++)
+    tracers.push_back(Install(*node, outputStream, averagingPeriod));
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+IncDeadlineTracer::Install(Ptr<Node> node, const std::string& file, Time averagingPeriod)
+{
+  Install(NodeContainer(node), file, averagingPeriod);
+}
+
+Ptr<IncDeadlineTracer>
+IncDeadlineTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time averagingPeriod)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<IncDeadlineTracer> trace = Create<IncDeadlineTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+IncDeadlineTracer::IncDeadlineTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+  Connect();
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+}
+
+IncDeadlineTracer::~IncDeadlineTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+IncDeadlineTracer::Connect()
+{
+  for (uint32_t i = 0; i < m_nodePtr->GetNApplications(); i++) {
+    Ptr<NfnProducerApp> producer = DynamicCast<NfnProducerApp>(m_nodePtr->GetApplication(i));
+    if (producer != 0) {
+      producer->TraceConnectWithoutContext("NFN_Deadline", MakeCallback(&IncDeadlineTracer::Deadline, this));
+      producer->TraceConnectWithoutContext("NFN_Abandoned", MakeCallback(&IncDeadlineTracer::Abandoned, this));
+    }
+  }
+}
+
+void
+IncDeadlineTracer::SetAveragingPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &IncDeadlineTracer::PeriodicPrinter, this);
+}
+
+void
+IncDeadlineTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time,"
+     << "Node,"
+     << "Function,"
+     << "Executed,"
+     << "Dropped,"
+     << "DropRatio,"
+     << "MeanSlack,"
+     << "MeanLateness,"
+     << "Abandoned,"
+     << "Wasted";
+}
+
+void
+IncDeadlineTracer::PeriodicPrinter()
+{
+  for (auto& function : m_stats) {
+    const Stats& stats = function.second;
+    uint64_t deadlines = stats.executed + stats.dropped;
+    *m_os << Simulator::Now().ToDouble(Time::S) << "," << m_node << "," << function.first << ","
+          << stats.executed << "," << stats.dropped << ","
+          << (deadlines > 0 ? static_cast<double>(stats.dropped) / deadlines : 0) << ","
+          << (stats.executed > 0 ? stats.slack.ToDouble(Time::S) / stats.executed : 0) << ","
+          << (stats.dropped > 0 ? stats.lateness.ToDouble(Time::S) / stats.dropped : 0) << ","
+          << stats.abandoned << "," << stats.wasted << "\n";
+  }
+  m_stats.clear();
+
+  m_printEvent = Simulator::Schedule(m_period, &IncDeadlineTracer::PeriodicPrinter, this);
+}
+
+void
+IncDeadlineTracer::Deadline(std::string function, Time slack, bool dropped)
+{
+  Stats& stats = m_stats.emplace(function, Stats{0, 0, Time(), Time(), 0, 0}).first->second;
+  if (dropped) {
+    stats.dropped++;
+    stats.lateness -= slack;
+  }
+  else {
+    stats.executed++;
+    stats.slack += slack;
+  }
+}
+
+void
+IncDeadlineTracer::Abandoned(std::string function, bool executed)
+{
+  Stats& stats = m_stats.emplace(function, Stats{0, 0, Time(), Time(), 0, 0}).first->second;
+  if (executed)
+    stats.wasted++;
+  else
+    stats.abandoned++;
+}
+
+} //namespace inc
+} // namespace ndn
+} // namespace ns3
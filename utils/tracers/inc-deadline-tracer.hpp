@@ -0,0 +1,164 @@
+ /*
+  * ******************************************************************************
+  * Copyright (c) 2021 Robert Bosch GmbH.
+  *
+  * This program is free software; you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License version 3 as
+  * published by the Free Software Foundation;
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * All rights reserved. This program and the accompanying materials
+  * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+  * which accompanies this distribution, and is available at
+  * https://www.gnu.org/licenses/gpl-3.0.de.html
+  *
+  *  Date: November 8th, 2021
+  *  Contributors:
+  *      Robert Bosch GmbH - initial API and functionality
+  *          Dennis Grewe <dennis.grewe@de.bosch.com>
+  *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+  * *****************************************************************************
+  */
+
+
+#ifndef INC_DEADLINE_TRACER_H
+#define INC_DEADLINE_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+#include "ns3/ndnSIM/apps/ndn-app.hpp"
+
+#include <tuple>
+#include <list>
+#include <map>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn{
+namespace inc{
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer of the deadline misses of the compute requests handled by a node, per function
+ *
+ * Every averaging period it writes one line per function the NfnProducerApps of the node saw requests with a
+ * deadline for: how many started executing in time and how many were dropped because they could not meet their
+ * deadline anymore, with the mean slack of the executed ones and the mean lateness of the dropped ones. Next to them
+ * it counts the work nobody waits for anymore, e.g. the losing copy of a hedged request: requests dropped before they
+ * executed because their PIT entry was gone, and executions that finished after it was gone.
+ */
+class IncDeadlineTracer : public SimpleRefCount<IncDeadlineTracer> {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static Ptr<IncDeadlineTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to the producer apps of the node
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  IncDeadlineTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  ~IncDeadlineTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+private:
+  void
+  Connect();
+
+  void
+  Deadline(std::string function, Time slack, bool dropped);
+
+  void
+  Abandoned(std::string function, bool executed);
+
+  void
+  SetAveragingPeriod(const Time& period);
+
+  void
+  PeriodicPrinter();
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+  struct Stats {
+    uint64_t executed;
+    uint64_t dropped;
+    Time slack;    ///< summed slack of the executed requests
+    Time lateness; ///< summed lateness of the dropped requests
+    uint64_t abandoned; ///< dropped before executing, nobody waited for them anymore
+    uint64_t wasted;    ///< executed although nobody waited for the result anymore
+  };
+  std::map<std::string, Stats> m_stats; ///< per function, for the current period
+};
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif // INC_DEADLINE_TRACER_H
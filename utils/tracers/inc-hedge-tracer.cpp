@@ -0,0 +1,254 @@
+ /*
+  * ******************************************************************************
+  * Copyright (c) 2021 Robert Bosch GmbH.
+  *
+  * This program is free software; you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License version 3 as
+  * published by the Free Software Foundation;
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * All rights reserved. This program and the accompanying materials
+  * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+  * which accompanies this distribution, and is available at
+  * https://www.gnu.org/licenses/gpl-3.0.de.html
+  *
+  *  Date: November 8th, 2021
+  *  Contributors:
+  *      Robert Bosch GmbH - initial API and functionality
+  *          Dennis Grewe <dennis.grewe@de.bosch.com>
+  *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+  * *****************************************************************************
+  */
+
+
+#include "inc-hedge-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+#include "ns3/inc-consumer-base-app.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.IncHedgeTracer");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<IncHedgeTracer>>>> g_tracers;
+
+namespace {
+
+shared_ptr<std::ostream>
+OpenOutput(const std::string& file)
+{
+  if (file == "-")
+    return shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+  return os;
+}
+
+double
+Percentile(std::vector<Time>& times, double percentile)
+{
+  if (times.empty())
+    return 0;
+  size_t rank = std::ceil(percentile / 100 * times.size());
+  auto element = times.begin() + std::min(times.size(), std::max<size_t>(rank, 1)) - 1;
+  std::nth_element(times.begin(), element, times.end());
+  return element->ToDouble(Time::S);
+}
+
+double
+Mean(const std::vector<Time>& times)
+{
+  if (times.empty())
+    return 0;
+  Time sum;
+  for (const Time& time : times)
+    sum += time;
+  return sum.ToDouble(Time::S) / times.size();
+}
+
+} // namespace
+
+void
+IncHedgeTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+IncHedgeTracer::InstallAll(const std::string& file, Time averagingPeriod)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++)
+    nodes.Add(*node);
+  Install(nodes, file, averagingPeriod);
+}
+
+void
+IncHedgeTracer::Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod)
+{
+  shared_ptr<std::ostream> outputStream = OpenOutput(file);
+  if (outputStream == nullptr)
+    return;
+
+  std::list<Ptr<IncHedgeTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++)
+    tracers.push_back(Install(*node, outputStream, averagingPeriod));
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+IncHedgeTracer::Install(Ptr<Node> node, const std::string& file, Time averagingPeriod)
+{
+  Install(NodeContainer(node), file, averagingPeriod);
+}
+
+Ptr<IncHedgeTracer>
+IncHedgeTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time averagingPeriod)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<IncHedgeTracer> trace = Create<IncHedgeTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+IncHedgeTracer::IncHedgeTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+  , m_hedges(0)
+  , m_unpinned(0)
+  , m_hedgeWins(0)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+  Connect();
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+}
+
+IncHedgeTracer::~IncHedgeTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+IncHedgeTracer::Connect()
+{
+  for (uint32_t i = 0; i < m_nodePtr->GetNApplications(); i++) {
+    Ptr<INC_ConsumerBaseApp> consumer = DynamicCast<INC_ConsumerBaseApp>(m_nodePtr->GetApplication(i));
+    if (consumer != 0) {
+      consumer->TraceConnectWithoutContext("FirstInterestDataDelayInc",
+                                           MakeCallback(&IncHedgeTracer::Answered, this));
+      consumer->TraceConnectWithoutContext("HedgeInc", MakeCallback(&IncHedgeTracer::Hedge, this));
+      consumer->TraceConnectWithoutContext("HedgeUnpinnedInc", MakeCallback(&IncHedgeTracer::HedgeUnpinned, this));
+      consumer->TraceConnectWithoutContext("HedgeResultInc", MakeCallback(&IncHedgeTracer::HedgeResult, this));
+    }
+  }
+}
+
+void
+IncHedgeTracer::SetAveragingPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &IncHedgeTracer::PeriodicPrinter, this);
+}
+
+void
+IncHedgeTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time,"
+     << "Node,"
+     << "Requests,"
+     << "Hedges,"
+     << "Unpinned,"
+     << "HedgeRate,"
+     << "HedgeWins,"
+     << "MeanDelay,"
+     << "P99Delay,"
+     << "HedgedMeanDelay,"
+     << "HedgedP99Delay";
+}
+
+void
+IncHedgeTracer::PeriodicPrinter()
+{
+  *m_os << Simulator::Now().ToDouble(Time::S) << "," << m_node << "," << m_delays.size() << "," << m_hedges << ","
+        << m_unpinned << ","
+        << (m_delays.empty() ? 0 : static_cast<double>(m_hedges) / m_delays.size()) << "," << m_hedgeWins << ","
+        << Mean(m_delays) << "," << Percentile(m_delays, 99) << "," << Mean(m_hedgedDelays) << ","
+        << Percentile(m_hedgedDelays, 99) << "\n";
+  m_hedges = 0;
+  m_unpinned = 0;
+  m_hedgeWins = 0;
+  m_delays.clear();
+  m_hedgedDelays.clear();
+
+  m_printEvent = Simulator::Schedule(m_period, &IncHedgeTracer::PeriodicPrinter, this);
+}
+
+void
+IncHedgeTracer::Answered(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount)
+{
+  m_delays.push_back(delay);
+}
+
+void
+IncHedgeTracer::Hedge(Ptr<App> app, uint32_t seqno, Time delay)
+{
+  m_hedges++;
+}
+
+void
+IncHedgeTracer::HedgeUnpinned(Ptr<App> app, uint32_t seqno, Time delay)
+{
+  m_unpinned++;
+}
+
+void
+IncHedgeTracer::HedgeResult(Ptr<App> app, uint32_t seqno, Time delay, bool hedgeWon)
+{
+  m_hedgedDelays.push_back(delay);
+  if (hedgeWon)
+    m_hedgeWins++;
+}
+
+} //namespace inc
+} // namespace ndn
+} // namespace ns3
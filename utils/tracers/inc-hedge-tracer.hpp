@@ -0,0 +1,166 @@
+ /*
+  * ******************************************************************************
+  * Copyright (c) 2021 Robert Bosch GmbH.
+  *
+  * This program is free software; you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License version 3 as
+  * published by the Free Software Foundation;
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * All rights reserved. This program and the accompanying materials
+  * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+  * which accompanies this distribution, and is available at
+  * https://www.gnu.org/licenses/gpl-3.0.de.html
+  *
+  *  Date: November 8th, 2021
+  *  Contributors:
+  *      Robert Bosch GmbH - initial API and functionality
+  *          Dennis Grewe <dennis.grewe@de.bosch.com>
+  *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+  * *****************************************************************************
+  */
+
+
+#ifndef INC_HEDGE_TRACER_H
+#define INC_HEDGE_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+#include "ns3/ndnSIM/apps/ndn-app.hpp"
+
+#include <tuple>
+#include <list>
+#include <vector>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn{
+namespace inc{
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer of the hedged requests of the consumer apps of a node
+ *
+ * Every averaging period it writes the requests the node's consumers got answered, the hedges they sent, how many
+ * of them found no alternate next hop at the node and went unpinned, and how many pinned hedges answered their
+ * request before the first Interest did, together with the mean and 99th
+ * percentile delay of all answered requests and of the hedged ones. The tail gain of a HedgePercentile shows by
+ * comparing P99Delay with a run without hedging.
+ */
+class IncHedgeTracer : public SimpleRefCount<IncHedgeTracer> {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param averagingPeriod How often data will be written into the trace file
+   */
+  static Ptr<IncHedgeTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time averagingPeriod = Seconds(1));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to the consumer apps of the node
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  IncHedgeTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  ~IncHedgeTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+private:
+  void
+  Connect();
+
+  void
+  Answered(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount);
+
+  void
+  Hedge(Ptr<App> app, uint32_t seqno, Time delay);
+
+  void
+  HedgeUnpinned(Ptr<App> app, uint32_t seqno, Time delay);
+
+  void
+  HedgeResult(Ptr<App> app, uint32_t seqno, Time delay, bool hedgeWon);
+
+  void
+  SetAveragingPeriod(const Time& period);
+
+  void
+  PeriodicPrinter();
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+  uint64_t m_hedges;               ///< hedges sent in the current period
+  uint64_t m_unpinned;             ///< hedges without an alternate next hop at the node in the current period
+  uint64_t m_hedgeWins;            ///< pinned hedges that answered their request in the current period
+  std::vector<Time> m_delays;      ///< delays of the requests answered in the current period
+  std::vector<Time> m_hedgedDelays; ///< delays of the hedged requests answered in the current period
+};
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif // INC_HEDGE_TRACER_H
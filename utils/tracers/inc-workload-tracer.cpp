@@ -0,0 +1,202 @@
+ /*
+  * ******************************************************************************
+  * Copyright (c) 2021 Robert Bosch GmbH.
+  *
+  * This program is free software; you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License version 3 as
+  * published by the Free Software Foundation;
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * All rights reserved. This program and the accompanying materials
+  * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+  * which accompanies this distribution, and is available at
+  * https://www.gnu.org/licenses/gpl-3.0.de.html
+  *
+  *  Date: November 8th, 2021
+  *  Contributors:
+  *      Robert Bosch GmbH - initial API and functionality
+  *          Dennis Grewe <dennis.grewe@de.bosch.com>
+  *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+  * *****************************************************************************
+  */
+
+
+#include "inc-workload-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+#include "ns3/inc-consumer-app.hpp"
+#include "ns3/inc-multi-flow-consumer-app.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.inc.IncWorkloadTracer");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<IncWorkloadTracer>>>> g_tracers;
+
+namespace {
+
+shared_ptr<std::ostream>
+OpenOutput(const std::string& file)
+{
+  if (file == "-")
+    return shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+  return os;
+}
+
+} // namespace
+
+void
+IncWorkloadTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+IncWorkloadTracer::InstallAll(const std::string& file, Time averagingPeriod)
+{
+  NodeContainer nodes;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++)
+    nodes.Add(*node);
+  Install(nodes, file, averagingPeriod);
+}
+
+void
+IncWorkloadTracer::Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod)
+{
+  shared_ptr<std::ostream> outputStream = OpenOutput(file);
+  if (outputStream == nullptr)
+    return;
+
+  std::list<Ptr<IncWorkloadTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++)
+    tracers.push_back(Install(*node, outputStream, averagingPeriod));
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+IncWorkloadTracer::Install(Ptr<Node> node, const std::string& file, Time averagingPeriod)
+{
+  Install(NodeContainer(node), file, averagingPeriod);
+}
+
+Ptr<IncWorkloadTracer>
+IncWorkloadTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream, Time averagingPeriod)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<IncWorkloadTracer> trace = Create<IncWorkloadTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+IncWorkloadTracer::IncWorkloadTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+  , m_arrivals(0)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+  Connect();
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+}
+
+IncWorkloadTracer::~IncWorkloadTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+IncWorkloadTracer::Connect()
+{
+  for (uint32_t i = 0; i < m_nodePtr->GetNApplications(); i++) {
+    Ptr<Application> app = m_nodePtr->GetApplication(i);
+    if (DynamicCast<ConsumerApp>(app) != 0 || DynamicCast<MultiFlowConsumerApp>(app) != 0)
+      app->TraceConnectWithoutContext("ArrivalInc", MakeCallback(&IncWorkloadTracer::Arrival, this));
+  }
+}
+
+void
+IncWorkloadTracer::SetAveragingPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &IncWorkloadTracer::PeriodicPrinter, this);
+}
+
+void
+IncWorkloadTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time,"
+     << "Node,"
+     << "Arrivals,"
+     << "ArrivalRate,"
+     << "OfferedRate";
+}
+
+void
+IncWorkloadTracer::PeriodicPrinter()
+{
+  // rate the arrival processes offer at this instant, e.g. the current state of an MMPP
+  double offered = 0;
+  for (uint32_t i = 0; i < m_nodePtr->GetNApplications(); i++) {
+    Ptr<ConsumerApp> consumer = DynamicCast<ConsumerApp>(m_nodePtr->GetApplication(i));
+    if (consumer != 0)
+      offered += consumer->GetOfferedRate();
+    Ptr<MultiFlowConsumerApp> multiFlow = DynamicCast<MultiFlowConsumerApp>(m_nodePtr->GetApplication(i));
+    if (multiFlow != 0)
+      offered += multiFlow->GetOfferedRate();
+  }
+
+  *m_os << Simulator::Now().ToDouble(Time::S) << "," << m_node << "," << m_arrivals << ","
+        << m_arrivals / m_period.ToDouble(Time::S) << "," << offered << "\n";
+  m_arrivals = 0;
+
+  m_printEvent = Simulator::Schedule(m_period, &IncWorkloadTracer::PeriodicPrinter, this);
+}
+
+void
+IncWorkloadTracer::Arrival(Ptr<App> app)
+{
+  m_arrivals++;
+}
+
+} //namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,464 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-arrival-process.hpp"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/object-factory.h"
+#include "ns3/inc-random-streams.hpp"
+
+#include <cmath>
+#include <map>
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncArrivalProcess");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+std::vector<double>
+ParseList (const std::string &list, const std::string &attribute)
+{
+  std::vector<double> values;
+  std::istringstream is (list);
+  std::string item;
+  while (std::getline (is, item, ','))
+    {
+      std::istringstream value (item);
+      double number;
+      NS_ABORT_MSG_IF (!(value >> number) || number < 0, "bad value '" << item << "' in " << attribute);
+      values.push_back (number);
+    }
+  NS_ABORT_MSG_IF (values.empty (), attribute << " is empty");
+  return values;
+}
+
+} // namespace
+
+NS_OBJECT_ENSURE_REGISTERED (IncArrivalProcess);
+NS_OBJECT_ENSURE_REGISTERED (IncPeriodicArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncUniformArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncPoissonArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncSwitchingArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncMmppArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncOnOffArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncDiurnalArrivals);
+NS_OBJECT_ENSURE_REGISTERED (IncFlashCrowdArrivals);
+
+TypeId
+IncArrivalProcess::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ndn::inc::IncArrivalProcess").SetParent<Object> ();
+  return tid;
+}
+
+IncArrivalProcess::IncArrivalProcess () : m_uniform (CreateObject<UniformRandomVariable> ())
+{
+}
+
+IncArrivalProcess::~IncArrivalProcess ()
+{
+}
+
+Ptr<IncArrivalProcess>
+IncArrivalProcess::CreateProcess (const std::string &spec)
+{
+  static const std::map<std::string, std::string> names = {
+      {"none", "ns3::ndn::inc::IncPeriodicArrivals"},
+      {"uniform", "ns3::ndn::inc::IncUniformArrivals"},
+      {"exponential", "ns3::ndn::inc::IncPoissonArrivals"},
+      {"mmpp", "ns3::ndn::inc::IncMmppArrivals"},
+      {"on-off", "ns3::ndn::inc::IncOnOffArrivals"},
+      {"diurnal", "ns3::ndn::inc::IncDiurnalArrivals"},
+      {"flash-crowd", "ns3::ndn::inc::IncFlashCrowdArrivals"}};
+
+  std::string name = spec;
+  std::string attributes;
+  size_t bracket = spec.find ('[');
+  if (bracket != std::string::npos)
+    {
+      NS_ABORT_MSG_IF (spec.back () != ']', "unterminated attributes in arrival process " << spec);
+      name = spec.substr (0, bracket);
+      attributes = spec.substr (bracket + 1, spec.size () - bracket - 2);
+    }
+  auto known = names.find (name);
+  std::string typeName = known != names.end () ? known->second : name;
+
+  TypeId tid;
+  if (!TypeId::LookupByNameFailSafe (typeName, &tid) || !tid.IsChildOf (IncArrivalProcess::GetTypeId ()) ||
+      !tid.HasConstructor ())
+    {
+      NS_FATAL_ERROR ("Unknown arrival process " << spec);
+    }
+  ObjectFactory factory;
+  factory.SetTypeId (tid);
+  std::istringstream is (attributes);
+  std::string attribute;
+  while (std::getline (is, attribute, '|'))
+    {
+      size_t equals = attribute.find ('=');
+      NS_ABORT_MSG_IF (equals == std::string::npos, "bad attribute '" << attribute << "' of " << spec);
+      factory.Set (attribute.substr (0, equals), StringValue (attribute.substr (equals + 1)));
+    }
+  return factory.Create<IncArrivalProcess> ();
+}
+
+double
+IncArrivalProcess::GetRate (double interval) const
+{
+  return GetRateFactor (Simulator::Now ()) / interval;
+}
+
+void
+IncArrivalProcess::AssignStreams (uint64_t index)
+{
+  IncRandomStreams::Get ().Assign (m_uniform, "consumers", index);
+}
+
+double
+IncArrivalProcess::GetRateFactor (Time t) const
+{
+  return 1;
+}
+
+double
+IncArrivalProcess::DrawExponential (double mean)
+{
+  return -mean * std::log (1 - m_uniform->GetValue ());
+}
+
+Time
+IncArrivalProcess::DrawThinned (double interval, double maxFactor)
+{
+  // candidates of the process at maxFactor times the base rate, each kept with the current share of that rate
+  Time now = Simulator::Now ();
+  double gap = 0;
+  while (true)
+    {
+      gap += DrawExponential (interval / maxFactor);
+      if (m_uniform->GetValue () * maxFactor < GetRateFactor (now + Seconds (gap)))
+        return Seconds (gap);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+TypeId
+IncPeriodicArrivals::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ndn::inc::IncPeriodicArrivals")
+                          .SetParent<IncArrivalProcess> ()
+                          .AddConstructor<IncPeriodicArrivals> ();
+  return tid;
+}
+
+Time
+IncPeriodicArrivals::GetNextGap (double interval)
+{
+  return Seconds (interval);
+}
+
+TypeId
+IncUniformArrivals::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ndn::inc::IncUniformArrivals")
+                          .SetParent<IncArrivalProcess> ()
+                          .AddConstructor<IncUniformArrivals> ();
+  return tid;
+}
+
+Time
+IncUniformArrivals::GetNextGap (double interval)
+{
+  return Seconds (m_uniform->GetValue (0, 2 * interval));
+}
+
+TypeId
+IncPoissonArrivals::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncPoissonArrivals")
+          .SetParent<IncArrivalProcess> ()
+          .AddConstructor<IncPoissonArrivals> ()
+          .AddAttribute ("Bound", "Longest gap in intervals, longer gaps are drawn again, 0 for unbounded",
+                         DoubleValue (50), MakeDoubleAccessor (&IncPoissonArrivals::m_bound),
+                         MakeDoubleChecker<double> (0));
+  return tid;
+}
+
+Time
+IncPoissonArrivals::GetNextGap (double interval)
+{
+  double gap = DrawExponential (interval);
+  while (m_bound > 0 && gap > m_bound * interval)
+    gap = DrawExponential (interval);
+  return Seconds (gap);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+TypeId
+IncSwitchingArrivals::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ndn::inc::IncSwitchingArrivals").SetParent<IncArrivalProcess> ();
+  return tid;
+}
+
+IncSwitchingArrivals::IncSwitchingArrivals ()
+{
+}
+
+Time
+IncSwitchingArrivals::GetNextGap (double interval)
+{
+  Time now = Simulator::Now ();
+  if (m_switches.empty ())
+    {
+      m_factors = GetFactors ();
+      double highest = 0;
+      for (double factor : m_factors)
+        highest = std::max (highest, factor);
+      NS_ABORT_MSG_IF (highest <= 0, "arrival process without a state of positive rate");
+      m_switches.push_back (std::make_pair (now, 0));
+    }
+  while (m_switches.size () > 1 && m_switches[1].first <= now)
+    m_switches.pop_front ();
+
+  // the rate is constant between switches, memorylessness allows drawing afresh at every switch
+  Time t = now;
+  for (uint32_t i = 0;; i++)
+    {
+      if (i + 1 == m_switches.size ())
+        {
+          uint32_t state = m_switches.back ().second;
+          Time leave = m_switches.back ().first + DrawSojourn (state);
+          m_switches.push_back (std::make_pair (leave, DrawNextState (state)));
+        }
+      double factor = m_factors[m_switches[i].second];
+      Time end = m_switches[i + 1].first;
+      if (factor > 0)
+        {
+          Time arrival = t + Seconds (DrawExponential (interval / factor));
+          if (arrival < end)
+            return arrival - now;
+        }
+      t = end;
+    }
+}
+
+double
+IncSwitchingArrivals::GetRateFactor (Time t) const
+{
+  if (m_switches.empty ())
+    return GetFactors ().front (); // not started yet
+  for (auto it = m_switches.rbegin (); it != m_switches.rend (); it++)
+    if (it->first <= t)
+      return m_factors[it->second];
+  return m_factors[m_switches.front ().second];
+}
+
+TypeId
+IncMmppArrivals::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncMmppArrivals")
+          .SetParent<IncSwitchingArrivals> ()
+          .AddConstructor<IncMmppArrivals> ()
+          .AddAttribute ("RateFactors", "Comma separated factors of the base rate in every state",
+                         StringValue ("0.5,3"), MakeStringAccessor (&IncMmppArrivals::m_rateFactors),
+                         MakeStringChecker ())
+          .AddAttribute ("MeanSojourns", "Comma separated mean sojourn times in seconds of every state",
+                         StringValue ("80,20"), MakeStringAccessor (&IncMmppArrivals::m_meanSojourns),
+                         MakeStringChecker ());
+  return tid;
+}
+
+std::vector<double>
+IncMmppArrivals::GetFactors () const
+{
+  return ParseList (m_rateFactors, "RateFactors");
+}
+
+Time
+IncMmppArrivals::DrawSojourn (uint32_t state)
+{
+  if (m_sojourns.empty ())
+    {
+      m_sojourns = ParseList (m_meanSojourns, "MeanSojourns");
+      NS_ABORT_MSG_IF (m_sojourns.size () != GetFactors ().size (), "RateFactors and MeanSojourns differ in length");
+      for (double sojourn : m_sojourns)
+        NS_ABORT_MSG_IF (sojourn <= 0, "mean sojourn times must be positive");
+    }
+  return Seconds (DrawExponential (m_sojourns[state]));
+}
+
+uint32_t
+IncMmppArrivals::DrawNextState (uint32_t state)
+{
+  uint32_t states = m_sojourns.size ();
+  if (states == 1)
+    return 0;
+  uint32_t next = m_uniform->GetInteger (0, states - 2);
+  return next < state ? next : next + 1;
+}
+
+TypeId
+IncOnOffArrivals::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncOnOffArrivals")
+          .SetParent<IncSwitchingArrivals> ()
+          .AddConstructor<IncOnOffArrivals> ()
+          .AddAttribute ("OnTime", "Length of the bursts in seconds",
+                         StringValue ("ns3::ExponentialRandomVariable[Mean=10]"),
+                         MakePointerAccessor (&IncOnOffArrivals::m_onTime),
+                         MakePointerChecker<RandomVariableStream> ())
+          .AddAttribute ("OffTime", "Length of the silence between bursts in seconds",
+                         StringValue ("ns3::ExponentialRandomVariable[Mean=40]"),
+                         MakePointerAccessor (&IncOnOffArrivals::m_offTime),
+                         MakePointerChecker<RandomVariableStream> ())
+          .AddAttribute ("BurstFactor", "Factor of the base rate during bursts", DoubleValue (5),
+                         MakeDoubleAccessor (&IncOnOffArrivals::m_burstFactor),
+                         MakeDoubleChecker<double> (0));
+  return tid;
+}
+
+IncOnOffArrivals::IncOnOffArrivals ()
+{
+}
+
+void
+IncOnOffArrivals::AssignStreams (uint64_t index)
+{
+  IncArrivalProcess::AssignStreams (index);
+  IncRandomStreams::Get ().Assign (m_onTime, "consumers-on", index);
+  IncRandomStreams::Get ().Assign (m_offTime, "consumers-off", index);
+}
+
+std::vector<double>
+IncOnOffArrivals::GetFactors () const
+{
+  return {m_burstFactor, 0};
+}
+
+Time
+IncOnOffArrivals::DrawSojourn (uint32_t state)
+{
+  return Seconds (std::max (0.0, (state == 0 ? m_onTime : m_offTime)->GetValue ()));
+}
+
+uint32_t
+IncOnOffArrivals::DrawNextState (uint32_t state)
+{
+  return 1 - state;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+TypeId
+IncDiurnalArrivals::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncDiurnalArrivals")
+          .SetParent<IncArrivalProcess> ()
+          .AddConstructor<IncDiurnalArrivals> ()
+          .AddAttribute ("Period", "Length of one cycle of the rate", TimeValue (Hours (24)),
+                         MakeTimeAccessor (&IncDiurnalArrivals::m_period), MakeTimeChecker (NanoSeconds (1)))
+          .AddAttribute ("Phase", "Time at which the rate crosses the base rate upwards", TimeValue (Seconds (0)),
+                         MakeTimeAccessor (&IncDiurnalArrivals::m_phase), MakeTimeChecker ())
+          .AddAttribute ("Amplitude", "Relative swing of the rate around the base rate", DoubleValue (0.5),
+                         MakeDoubleAccessor (&IncDiurnalArrivals::m_amplitude),
+                         MakeDoubleChecker<double> (0, 1));
+  return tid;
+}
+
+Time
+IncDiurnalArrivals::GetNextGap (double interval)
+{
+  return DrawThinned (interval, 1 + m_amplitude);
+}
+
+double
+IncDiurnalArrivals::GetRateFactor (Time t) const
+{
+  return 1 + m_amplitude * std::sin (2 * M_PI * (t - m_phase).GetSeconds () / m_period.GetSeconds ());
+}
+
+TypeId
+IncFlashCrowdArrivals::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncFlashCrowdArrivals")
+          .SetParent<IncArrivalProcess> ()
+          .AddConstructor<IncFlashCrowdArrivals> ()
+          .AddAttribute ("Start", "Simulation time the flash crowd begins", TimeValue (Seconds (100)),
+                         MakeTimeAccessor (&IncFlashCrowdArrivals::m_start), MakeTimeChecker ())
+          .AddAttribute ("RampUp", "Time until the rate reaches its peak", TimeValue (Seconds (10)),
+                         MakeTimeAccessor (&IncFlashCrowdArrivals::m_rampUp), MakeTimeChecker (Seconds (0)))
+          .AddAttribute ("Duration", "Time the rate stays at its peak", TimeValue (Seconds (60)),
+                         MakeTimeAccessor (&IncFlashCrowdArrivals::m_duration), MakeTimeChecker (Seconds (0)))
+          .AddAttribute ("RampDown", "Time until the rate is back at the base rate", TimeValue (Seconds (30)),
+                         MakeTimeAccessor (&IncFlashCrowdArrivals::m_rampDown), MakeTimeChecker (Seconds (0)))
+          .AddAttribute ("PeakFactor", "Factor of the base rate at the peak", DoubleValue (10),
+                         MakeDoubleAccessor (&IncFlashCrowdArrivals::m_peakFactor),
+                         MakeDoubleChecker<double> (0));
+  return tid;
+}
+
+Time
+IncFlashCrowdArrivals::GetNextGap (double interval)
+{
+  // once the crowd is gone only the base rate is left
+  if (Simulator::Now () >= m_start + m_rampUp + m_duration + m_rampDown)
+    return Seconds (DrawExponential (interval));
+  return DrawThinned (interval, std::max (1.0, m_peakFactor));
+}
+
+double
+IncFlashCrowdArrivals::GetRateFactor (Time t) const
+{
+  Time peak = m_start + m_rampUp;
+  Time fall = peak + m_duration;
+  Time end = fall + m_rampDown;
+  if (t < m_start || t >= end)
+    return 1;
+  if (t < peak)
+    return 1 + (m_peakFactor - 1) * (t - m_start).GetSeconds () / m_rampUp.GetSeconds ();
+  if (t < fall)
+    return m_peakFactor;
+  return m_peakFactor + (1 - m_peakFactor) * (t - fall).GetSeconds () / m_rampDown.GetSeconds ();
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,302 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_ARRIVAL_PROCESS_H
+#define INC_ARRIVAL_PROCESS_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Arrival process of the requests of a consumer
+ *
+ * A process modulates the base rate 1/interval of its consumer over time. Every consumer owns its process, the
+ * process keeps the state it needs between arrivals. Processes are created by name with CreateProcess and configured
+ * through their attributes, either as defaults (Config::SetDefault) or inline, e.g. "mmpp[RateFactors=1,8]".
+ */
+class IncArrivalProcess : public Object
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  IncArrivalProcess();
+  virtual ~IncArrivalProcess();
+
+  /**
+   * \brief Create a process from its short name (none, uniform, exponential, mmpp, diurnal, on-off, flash-crowd) or
+   * its TypeId name, optionally followed by attributes in brackets; aborts on unknown processes
+   */
+  static Ptr<IncArrivalProcess>
+  CreateProcess(const std::string& spec);
+
+  /**
+   * \brief Time from now until the next request
+   * \param interval mean time between requests of the consumer at base rate, in seconds
+   */
+  virtual Time
+  GetNextGap(double interval) = 0;
+
+  /**
+   * \brief Expected request rate of the consumer now, in requests per second
+   */
+  double
+  GetRate(double interval) const;
+
+  /**
+   * \brief Let the random variables of the process draw from the "consumers" stream of the app index
+   */
+  virtual void
+  AssignStreams(uint64_t index);
+
+protected:
+  /**
+   * \brief Factor of the base rate at time t, not before now
+   */
+  virtual double
+  GetRateFactor(Time t) const;
+
+  /**
+   * \brief Gap of a Poisson process whose rate follows GetRateFactor, by thinning a process of maxFactor times the
+   * base rate
+   */
+  Time
+  DrawThinned(double interval, double maxFactor);
+
+  double
+  DrawExponential(double mean);
+
+  Ptr<UniformRandomVariable> m_uniform;
+};
+
+/**
+ * \brief Requests at exactly the interval ("none")
+ */
+class IncPeriodicArrivals : public IncArrivalProcess
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  virtual Time
+  GetNextGap(double interval);
+};
+
+/**
+ * \brief Gaps uniform between 0 and twice the interval ("uniform")
+ */
+class IncUniformArrivals : public IncArrivalProcess
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  virtual Time
+  GetNextGap(double interval);
+};
+
+/**
+ * \brief Poisson arrivals at the base rate ("exponential"), gaps are bounded to Bound intervals
+ */
+class IncPoissonArrivals : public IncArrivalProcess
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  virtual Time
+  GetNextGap(double interval);
+
+private:
+  double m_bound;
+};
+
+/**
+ * \brief Poisson arrivals whose rate switches between the factors of a set of states
+ *
+ * The state sequence is generated lazily alongside the arrivals, switches up to the next arrival are remembered so
+ * that the rate can be looked up for any time until then.
+ */
+class IncSwitchingArrivals : public IncArrivalProcess
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  IncSwitchingArrivals();
+
+  virtual Time
+  GetNextGap(double interval);
+
+protected:
+  virtual double
+  GetRateFactor(Time t) const;
+
+  /**
+   * \brief Rate factor of every state, the process starts in state 0
+   */
+  virtual std::vector<double>
+  GetFactors() const = 0;
+
+  virtual Time
+  DrawSojourn(uint32_t state) = 0;
+
+  virtual uint32_t
+  DrawNextState(uint32_t state) = 0;
+
+private:
+  std::vector<double> m_factors;
+  std::deque<std::pair<Time, uint32_t>> m_switches; ///< switch times and the states entered, the first one in force
+};
+
+/**
+ * \brief Markov-modulated Poisson process ("mmpp")
+ *
+ * Every state has a rate factor and an exponentially distributed sojourn time. Leaving a state, the process enters
+ * one of the other states with equal probability, with two states it alternates.
+ */
+class IncMmppArrivals : public IncSwitchingArrivals
+{
+public:
+  static TypeId
+  GetTypeId();
+
+protected:
+  virtual std::vector<double>
+  GetFactors() const;
+
+  virtual Time
+  DrawSojourn(uint32_t state);
+
+  virtual uint32_t
+  DrawNextState(uint32_t state);
+
+private:
+  std::string m_rateFactors;
+  std::string m_meanSojourns;
+  std::vector<double> m_sojourns;
+};
+
+/**
+ * \brief Bursts of Poisson arrivals at BurstFactor times the base rate, separated by silence ("on-off")
+ *
+ * The lengths of the on and off periods are drawn from the OnTime and OffTime random variables. The mean rate is
+ * BurstFactor * E[OnTime] / (E[OnTime] + E[OffTime]) times the base rate.
+ */
+class IncOnOffArrivals : public IncSwitchingArrivals
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  IncOnOffArrivals();
+
+  virtual void
+  AssignStreams(uint64_t index);
+
+protected:
+  virtual std::vector<double>
+  GetFactors() const;
+
+  virtual Time
+  DrawSojourn(uint32_t state);
+
+  virtual uint32_t
+  DrawNextState(uint32_t state);
+
+private:
+  Ptr<RandomVariableStream> m_onTime;
+  Ptr<RandomVariableStream> m_offTime;
+  double m_burstFactor;
+};
+
+/**
+ * \brief Poisson arrivals with a sinusoidal rate, 1 + Amplitude * sin(2 pi (t - Phase) / Period) times the base rate
+ * ("diurnal")
+ *
+ * The default Period of a day suits long runs only, a run of a few minutes sees a flat rate unless Period is set
+ * to the scale of the simulation.
+ */
+class IncDiurnalArrivals : public IncArrivalProcess
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  virtual Time
+  GetNextGap(double interval);
+
+protected:
+  virtual double
+  GetRateFactor(Time t) const;
+
+private:
+  Time m_period;
+  Time m_phase;
+  double m_amplitude;
+};
+
+/**
+ * \brief Poisson arrivals at the base rate with one scheduled flash crowd ("flash-crowd")
+ *
+ * From Start the rate rises linearly to PeakFactor times the base rate within RampUp, stays there for Duration and
+ * falls back within RampDown. Start is a simulation time, the flash crowd hits all consumers at once.
+ */
+class IncFlashCrowdArrivals : public IncArrivalProcess
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  virtual Time
+  GetNextGap(double interval);
+
+protected:
+  virtual double
+  GetRateFactor(Time t) const;
+
+private:
+  Time m_start;
+  Time m_rampUp;
+  Time m_duration;
+  Time m_rampDown;
+  double m_peakFactor;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
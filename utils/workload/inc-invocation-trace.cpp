@@ -0,0 +1,151 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-invocation-trace.hpp"
+
+#include "ns3/log.h"
+
+#include <cstdlib>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncInvocationTrace");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+namespace {
+
+const size_t BUFFER_SIZE = 1 << 20;
+
+const uint32_t MAX_FIELDS = 5;
+
+uint32_t
+Split (const std::string &line, const char **fields, size_t *sizes)
+{
+  uint32_t count = 0;
+  const char *p = line.data ();
+  const char *end = p + line.size ();
+  while (p < end)
+    {
+      while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p++;
+      if (p == end)
+        break;
+      const char *start = p;
+      while (p < end && *p != ' ' && *p != '\t' && *p != '\r')
+        p++;
+      if (count < MAX_FIELDS)
+        {
+          fields[count] = start;
+          sizes[count] = p - start;
+        }
+      count++;
+    }
+  return count;
+}
+
+bool
+ParseSeconds (const char *field, size_t size, double &value)
+{
+  char *end;
+  value = std::strtod (field, &end);
+  return end == field + size && value >= 0;
+}
+
+} // namespace
+
+IncInvocationTrace::IncInvocationTrace () : m_buffer (BUFFER_SIZE), m_lineCount (0), m_lastTimestamp (0)
+{
+}
+
+bool
+IncInvocationTrace::Open (const std::string &file)
+{
+  m_input.rdbuf ()->pubsetbuf (m_buffer.data (), m_buffer.size ());
+  m_input.open (file.c_str ());
+  m_file = file;
+  m_error.clear ();
+  m_lineCount = 0;
+  m_lastTimestamp = 0;
+  if (!m_input.is_open ())
+    return Fail ("cannot open file for reading");
+  return true;
+}
+
+bool
+IncInvocationTrace::Next (IncTraceInvocation &invocation)
+{
+  if (!m_error.empty ())
+    return false;
+  while (std::getline (m_input, m_line))
+    {
+      m_lineCount++;
+      const char *fields[MAX_FIELDS];
+      size_t sizes[MAX_FIELDS];
+      uint32_t count = Split (m_line, fields, sizes);
+      if (count == 0 || fields[0][0] == '#')
+        continue;
+      if (count < 4 || count > 5)
+        return Fail ("expected timestamp, entity, function, arguments and an optional deadline, got " +
+                     std::to_string (count) + " fields");
+      if (!ParseSeconds (fields[0], sizes[0], invocation.timestamp))
+        return Fail ("invalid timestamp " + std::string (fields[0], sizes[0]));
+      if (invocation.timestamp < m_lastTimestamp)
+        return Fail ("timestamp " + std::string (fields[0], sizes[0]) + " is before the one of the previous line");
+      invocation.deadline = 0;
+      if (count == 5 && !ParseSeconds (fields[4], sizes[4], invocation.deadline))
+        return Fail ("invalid deadline " + std::string (fields[4], sizes[4]));
+      invocation.entity.assign (fields[1], sizes[1]);
+      invocation.function.assign (fields[2], sizes[2]);
+      invocation.arguments.assign (fields[3], sizes[3]);
+      m_lastTimestamp = invocation.timestamp;
+      return true;
+    }
+  NS_LOG_INFO (m_file << ": end of trace after " << m_lineCount << " lines");
+  return false;
+}
+
+const std::string &
+IncInvocationTrace::GetError () const
+{
+  return m_error;
+}
+
+uint64_t
+IncInvocationTrace::GetLineCount () const
+{
+  return m_lineCount;
+}
+
+bool
+IncInvocationTrace::Fail (const std::string &reason)
+{
+  m_error = m_file + ":" + std::to_string (m_lineCount) + ": " + reason;
+  return false;
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
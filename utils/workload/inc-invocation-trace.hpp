@@ -0,0 +1,106 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_INVOCATION_TRACE_H
+#define INC_INVOCATION_TRACE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief One function invocation of a workload trace
+ */
+struct IncTraceInvocation
+{
+  double timestamp;      ///< seconds since the start of the trace
+  std::string entity;    ///< issuer of the invocation (user, application, device), mapped onto a consumer node
+  std::string function;
+  std::string arguments; ///< comma separated input list, "null" if there is none
+  double deadline;       ///< seconds after the timestamp the result is useful for, 0 if the trace has none
+};
+
+/**
+ * \brief Streaming reader of function invocation traces
+ *
+ * A trace is a text file with one invocation per line, fields separated by whitespace:
+ *
+ *   timestamp entity function arguments [deadline]
+ *
+ * Timestamps are in seconds and must not decrease, the optional deadline is relative to the timestamp. Empty lines
+ * and lines starting with '#' are skipped. The file is read line by line through a fixed size buffer, so traces of
+ * any length are replayed in constant memory.
+ */
+class IncInvocationTrace
+{
+public:
+  IncInvocationTrace();
+
+  /**
+   * \return false with the reason in GetError, if the file cannot be opened
+   */
+  bool
+  Open(const std::string& file);
+
+  /**
+   * \brief Read the next invocation
+   * \return false at the end of the trace or on a malformed line, which GetError tells apart
+   */
+  bool
+  Next(IncTraceInvocation& invocation);
+
+  /**
+   * \brief "file:line: reason" of the error that stopped the trace, empty at its regular end
+   */
+  const std::string&
+  GetError() const;
+
+  uint64_t
+  GetLineCount() const;
+
+private:
+  bool
+  Fail(const std::string& reason);
+
+private:
+  std::ifstream m_input;
+  std::vector<char> m_buffer; ///< stream buffer of m_input
+  std::string m_file;
+  std::string m_line;
+  std::string m_error;
+  uint64_t m_lineCount;
+  double m_lastTimestamp;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif
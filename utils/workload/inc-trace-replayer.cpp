@@ -0,0 +1,174 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#include "inc-trace-replayer.hpp"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/hier-parser-node-info.hpp"
+
+#include <functional>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.inc.IncTraceReplayer");
+
+namespace ns3 {
+namespace ndn {
+namespace inc {
+
+NS_OBJECT_ENSURE_REGISTERED (IncTraceReplayer);
+
+TypeId
+IncTraceReplayer::GetTypeId ()
+{
+  static TypeId tid =
+      TypeId ("ns3::ndn::inc::IncTraceReplayer")
+          .SetParent<Object> ()
+          .AddConstructor<IncTraceReplayer> ()
+          .AddAttribute ("File", "Invocation trace to replay", StringValue (""),
+                         MakeStringAccessor (&IncTraceReplayer::m_file), MakeStringChecker ())
+          .AddAttribute ("ReadAhead", "Maximum number of invocations buffered from the trace", UintegerValue (4096),
+                         MakeUintegerAccessor (&IncTraceReplayer::m_readAhead), MakeUintegerChecker<uint32_t> (2))
+          .AddAttribute ("TimeScale", "Simulated seconds per second of trace time, below 1 compresses the trace",
+                         DoubleValue (1.0), MakeDoubleAccessor (&IncTraceReplayer::m_timeScale),
+                         MakeDoubleChecker<double> (0.0))
+          .AddAttribute ("StartTime", "Simulation time of the trace timestamp 0", TimeValue (Seconds (0)),
+                         MakeTimeAccessor (&IncTraceReplayer::m_startTime), MakeTimeChecker ())
+          .AddAttribute ("EntityMapping", "Mapping of trace entities onto consumers: round-robin or hash",
+                         StringValue ("round-robin"), MakeStringAccessor (&IncTraceReplayer::m_entityMapping),
+                         MakeStringChecker ());
+  return tid;
+}
+
+IncTraceReplayer::IncTraceReplayer () : m_traceEnded (false), m_dispatched (0), m_dropped (0)
+{
+}
+
+IncTraceReplayer::~IncTraceReplayer ()
+{
+}
+
+void
+IncTraceReplayer::DoDispose ()
+{
+  Simulator::Cancel (m_dispatchEvent);
+  m_consumers.clear ();
+  Object::DoDispose ();
+}
+
+void
+IncTraceReplayer::AddConsumer (Ptr<TraceReplayConsumerApp> consumer)
+{
+  m_consumers.push_back (consumer);
+}
+
+uint64_t
+IncTraceReplayer::GetDispatched () const
+{
+  return m_dispatched;
+}
+
+uint64_t
+IncTraceReplayer::GetDropped () const
+{
+  return m_dropped;
+}
+
+void
+IncTraceReplayer::Start ()
+{
+  NS_ABORT_MSG_IF (m_consumers.empty (), "no consumer to replay " << m_file << " through");
+  NS_ABORT_MSG_IF (m_entityMapping != "round-robin" && m_entityMapping != "hash",
+                   "unknown entity mapping " << m_entityMapping);
+  if (!m_trace.Open (m_file))
+    NS_FATAL_ERROR (m_trace.GetError ());
+  Fill ();
+  if (!m_buffer.empty ())
+    m_dispatchEvent = Simulator::Schedule (Max (GetDueTime (m_buffer.front ()) - Simulator::Now (), Seconds (0)),
+                                           &IncTraceReplayer::Dispatch, this);
+}
+
+void
+IncTraceReplayer::Fill ()
+{
+  while (!m_traceEnded && m_buffer.size () < m_readAhead)
+    {
+      m_buffer.emplace_back ();
+      if (!m_trace.Next (m_buffer.back ()))
+        {
+          m_buffer.pop_back ();
+          m_traceEnded = true;
+          if (!m_trace.GetError ().empty ())
+            NS_FATAL_ERROR (m_trace.GetError ());
+        }
+    }
+}
+
+void
+IncTraceReplayer::Dispatch ()
+{
+  Time now = Simulator::Now ();
+  while (!m_buffer.empty () && GetDueTime (m_buffer.front ()) <= now)
+    {
+      const IncTraceInvocation &invocation = m_buffer.front ();
+      Name name (parserNodeInfo::generate_func_first_prefix (invocation.function, invocation.arguments));
+      Time deadline = invocation.deadline > 0 ? now + Seconds (invocation.deadline) : Time ();
+      if (GetConsumer (invocation.entity)->Invoke (name, deadline))
+        m_dispatched++;
+      else
+        m_dropped++;
+      m_buffer.pop_front ();
+      if (m_buffer.size () < m_readAhead / 2)
+        Fill ();
+    }
+
+  if (!m_buffer.empty ())
+    m_dispatchEvent = Simulator::Schedule (GetDueTime (m_buffer.front ()) - now, &IncTraceReplayer::Dispatch, this);
+  else
+    NS_LOG_INFO (m_file << " replayed: " << m_dispatched << " invocations dispatched, " << m_dropped
+                        << " dropped, " << m_entities.size () << " entities");
+}
+
+Time
+IncTraceReplayer::GetDueTime (const IncTraceInvocation &invocation) const
+{
+  return m_startTime + Seconds (invocation.timestamp * m_timeScale);
+}
+
+Ptr<TraceReplayConsumerApp>
+IncTraceReplayer::GetConsumer (const std::string &entity)
+{
+  if (m_entityMapping == "hash")
+    return m_consumers[std::hash<std::string> () (entity) % m_consumers.size ()];
+  auto mapped = m_entities.emplace (entity, m_entities.size () % m_consumers.size ());
+  return m_consumers[mapped.first->second];
+}
+
+} // namespace inc
+} // namespace ndn
+} // namespace ns3
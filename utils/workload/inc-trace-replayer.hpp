@@ -0,0 +1,117 @@
+/*
+ * ******************************************************************************
+ * Copyright (c) 2021 Robert Bosch GmbH.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU GENERAL PUBLIC LICENSE v3
+ * which accompanies this distribution, and is available at
+ * https://www.gnu.org/licenses/gpl-3.0.de.html
+ *
+ *  Date: November 8th, 2021
+ *  Contributors:
+ *      Robert Bosch GmbH - initial functionality
+ *          Uthra Ambalavanan <uthra.ambalavanan@de.bosch.com>
+ * *****************************************************************************
+ */
+
+#ifndef INC_TRACE_REPLAYER_H
+#define INC_TRACE_REPLAYER_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/inc-invocation-trace.hpp"
+#include "ns3/inc-trace-replay-app.hpp"
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3{
+namespace ndn{
+namespace inc{
+
+/**
+ * \brief Replays a function invocation trace (see IncInvocationTrace) through TraceReplayConsumerApps
+ *
+ * The trace is streamed from disk: at most ReadAhead invocations are buffered, the buffer is refilled once half of it
+ * has been dispatched. One event is pending at a time, at the timestamp of the next invocation. Trace entities are
+ * mapped onto the consumers either in order of appearance (round-robin) or by a hash of their name, an entity always
+ * invokes from the same consumer.
+ */
+class IncTraceReplayer : public Object
+{
+public:
+  static TypeId
+  GetTypeId();
+
+  IncTraceReplayer();
+  virtual ~IncTraceReplayer();
+
+  void
+  AddConsumer(Ptr<TraceReplayConsumerApp> consumer);
+
+  /**
+   * \brief Open the trace and schedule its first invocation, aborts if the trace cannot be read
+   */
+  void
+  Start();
+
+  uint64_t
+  GetDispatched() const;
+
+  /**
+   * \brief Invocations whose consumer was not running at their timestamp
+   */
+  uint64_t
+  GetDropped() const;
+
+protected:
+  virtual void
+  DoDispose();
+
+private:
+  void
+  Fill();
+
+  void
+  Dispatch();
+
+  Time
+  GetDueTime(const IncTraceInvocation& invocation) const;
+
+  Ptr<TraceReplayConsumerApp>
+  GetConsumer(const std::string& entity);
+
+private:
+  std::string m_file;
+  uint32_t m_readAhead;
+  double m_timeScale;
+  Time m_startTime;
+  std::string m_entityMapping;
+
+  IncInvocationTrace m_trace;
+  bool m_traceEnded;
+  std::deque<IncTraceInvocation> m_buffer;
+  EventId m_dispatchEvent;
+  std::vector<Ptr<TraceReplayConsumerApp>> m_consumers;
+  std::unordered_map<std::string, uint32_t> m_entities; ///< consumer of every entity with round-robin mapping
+  uint64_t m_dispatched;
+  uint64_t m_dropped;
+};
+
+}//namespace inc
+} // namespace ndn
+} // namespace ns3
+
+#endif